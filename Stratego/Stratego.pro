@@ -3,11 +3,24 @@ SUBDIRS += \
     src/core \
     src/tui \
     src/gui \
-    test/unitTests
+    src/setupdb \
+    src/setupeval \
+    src/engine \
+    src/tournament \
+    test/unitTests \
+    test/bench
+
+unix: SUBDIRS += src/server src/randomplugin
 
 src-tui.depends = src/core
 src-gui.depends = src/core
+src-setupdb.depends = src/core
+src-setupeval.depends = src/core
+src-engine.depends = src/core
+src-tournament.depends = src/core
+src-server.depends = src/core
 test-unitTests.depends = src/core
+test-bench.depends = src/core
 
 OTHER_FILES += config.pri
 
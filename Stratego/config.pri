@@ -14,6 +14,16 @@ win32-g++*{
 
 QMAKE_CXXFLAGS += -Wall -Wextra
 
+# qmake CONFIG+=trace: enregistre les intervalles STRATEGO_TRACE_SCOPE (cf. trace.h)
+CONFIG(trace){
+    DEFINES += STRATEGO_TRACE
+}
+
+# qmake CONFIG+=alloctrack: comptabilise les allocations par sous-système et phase (cf. allocTracker.h)
+CONFIG(alloctrack){
+    DEFINES += STRATEGO_ALLOC_TRACK
+}
+
 lessThan(QT_MAJOR_VERSION, 5){
     error("Qt version 5 or higher is required");
 }
@@ -0,0 +1,209 @@
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <new>
+
+#include "allocTracker.h"
+
+using namespace stratego;
+
+namespace{
+
+    struct Counter{
+        std::atomic<std::uint64_t> count;
+        std::atomic<std::uint64_t> bytes;
+    };
+
+    /*
+     * Compteurs d'un thread: seul son thread propriétaire les incrémente. Les blocs sont alloués
+     * par malloc (sans passer par l'opérateur new comptabilisé) et chaînés dans une liste globale,
+     * jamais libérée, afin de conserver les compteurs des threads terminés.
+     */
+    struct Block{
+        std::array<std::array<Counter, alloc::PHASE_COUNT>, alloc::SUBSYSTEM_COUNT> usage;
+        std::atomic<std::uint64_t> turns;
+        Block* next;
+    };
+
+    std::atomic<Block*> blocks {nullptr};
+    std::mutex baselineMutex {};
+    alloc::Snapshot baseline {};
+
+    thread_local alloc::Subsystem currentSubsystem {alloc::OTHER};
+    thread_local alloc::Phase currentPhase {alloc::IDLE};
+
+    Block* localBlock() noexcept{
+        thread_local Block* local {};
+        if(!local){
+            if(void* memory {std::calloc(1, sizeof(Block))}){
+                local = new (memory) Block{};
+                local -> next = blocks.load(std::memory_order_relaxed);
+                while(!blocks.compare_exchange_weak(local -> next, local, std::memory_order_release, std::memory_order_relaxed));
+            }
+        }
+
+        return local;
+    }
+
+    void increment(std::atomic<std::uint64_t>& value, std::uint64_t n) noexcept{
+        value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    alloc::Snapshot totals() noexcept{
+        alloc::Snapshot snapshot {};
+        for(Block* block {blocks.load(std::memory_order_acquire)}; block; block = block -> next){
+            for(int s = 0; s < alloc::SUBSYSTEM_COUNT; s++){
+                for(int p = 0; p < alloc::PHASE_COUNT; p++){
+                    snapshot.usage[s][p].count += block -> usage[s][p].count.load(std::memory_order_relaxed);
+                    snapshot.usage[s][p].bytes += block -> usage[s][p].bytes.load(std::memory_order_relaxed);
+                }
+            }
+
+            snapshot.turns += block -> turns.load(std::memory_order_relaxed);
+        }
+
+        return snapshot;
+    }
+
+    void writeUsage(std::ostream& out, const alloc::Usage& usage, std::uint64_t turns){
+        out << std::setw(12) << usage.count << std::setw(14) << usage.bytes;
+        if(turns)
+            out << std::setw(12) << std::fixed << std::setprecision(1) << static_cast<double>(usage.count) / turns
+                << std::setw(14) << static_cast<double>(usage.bytes) / turns;
+        out << std::endl;
+    }
+}
+
+/* ========================== Snapshot =========================== */
+alloc::Usage alloc::Snapshot::total(Phase phase) const noexcept{
+    Usage result {};
+    for(const auto& subsystem : usage){
+        result.count += subsystem[phase].count;
+        result.bytes += subsystem[phase].bytes;
+    }
+
+    return result;
+}
+
+alloc::Usage alloc::Snapshot::total(Subsystem subsystem) const noexcept{
+    Usage result {};
+    for(const Usage& phase : usage[subsystem]){
+        result.count += phase.count;
+        result.bytes += phase.bytes;
+    }
+
+    return result;
+}
+
+
+/* ========================== Tracker =========================== */
+void alloc::record(std::size_t bytes) noexcept{
+    if(Block* block {localBlock()}){
+        Counter& counter {block -> usage[currentSubsystem][currentPhase]};
+        increment(counter.count, 1);
+        increment(counter.bytes, bytes);
+    }
+}
+
+void alloc::endTurn() noexcept{
+    if(Block* block {localBlock()})
+        increment(block -> turns, 1);
+}
+
+alloc::Snapshot alloc::snapshot() noexcept{
+    Snapshot snapshot {totals()};
+    std::lock_guard<std::mutex> lock {baselineMutex};
+    for(int s = 0; s < SUBSYSTEM_COUNT; s++){
+        for(int p = 0; p < PHASE_COUNT; p++){
+            snapshot.usage[s][p].count -= baseline.usage[s][p].count;
+            snapshot.usage[s][p].bytes -= baseline.usage[s][p].bytes;
+        }
+    }
+
+    snapshot.turns -= baseline.turns;
+    return snapshot;
+}
+
+void alloc::reset() noexcept{
+    Snapshot snapshot {totals()};
+    std::lock_guard<std::mutex> lock {baselineMutex};
+    baseline = snapshot;
+}
+
+void alloc::report(std::ostream& out){
+    Snapshot snap {snapshot()};
+    out << "Allocations (" << snap.turns << " tours)" << std::endl
+        << std::left << std::setw(20) << "sous-système/phase" << std::right << std::setw(12) << "nombre"
+        << std::setw(14) << "octets" << std::setw(12) << "nombre/tour" << std::setw(14) << "octets/tour" << std::endl;
+
+    for(int s = 0; s < SUBSYSTEM_COUNT; s++){
+        for(int p = 0; p < PHASE_COUNT; p++){
+            const Usage& usage {snap.usage[s][p]};
+            if(!usage.count)
+                continue;
+
+            out << std::left << std::setw(20) << std::string{subsystemNames[s]} + "/" + std::string{phaseNames[p]} << std::right;
+            writeUsage(out, usage, snap.turns);
+        }
+    }
+
+    for(int p = 0; p < PHASE_COUNT; p++){
+        out << std::left << std::setw(20) << "total/" + std::string{phaseNames[p]} << std::right;
+        writeUsage(out, snap.total(static_cast<Phase>(p)), snap.turns);
+    }
+}
+
+
+/* ========================== Scopes =========================== */
+alloc::SubsystemScope::SubsystemScope(Subsystem subsystem) noexcept :
+    previous_ {currentSubsystem}
+{
+    currentSubsystem = subsystem;
+}
+
+alloc::SubsystemScope::~SubsystemScope() noexcept{
+    currentSubsystem = previous_;
+}
+
+alloc::PhaseScope::PhaseScope(Phase phase) noexcept :
+    previous_ {currentPhase}
+{
+    currentPhase = phase;
+}
+
+alloc::PhaseScope::~PhaseScope() noexcept{
+    currentPhase = previous_;
+}
+
+
+/* ========================== Global operators =========================== */
+#ifdef STRATEGO_ALLOC_TRACK
+void* operator new(std::size_t size){
+    alloc::record(size);
+    if(void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size){
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept{
+    std::free(ptr);
+}
+#endif
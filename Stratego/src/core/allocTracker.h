@@ -0,0 +1,262 @@
+#ifndef ALLOCTRACKER_H
+#define ALLOCTRACKER_H
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+/*========================================
+* Comptabilité des allocations dynamiques
+* par sous-système et phase de jeu
+*=========================================
+*/
+
+namespace stratego::alloc {
+
+    /**
+     * Regroupe l'ensemble des sous-systèmes auxquels une allocation peut être attribuée.
+     */
+    enum Subsystem{
+
+        /**
+         * Allocation n'étant attribuée à aucun sous-système en particulier.
+         */
+        OTHER,
+
+        /**
+         * Modèle de jeu (ModelAdapter et ses joueurs).
+         */
+        MODEL,
+
+        /**
+         * Création des pions (PieceFactory).
+         */
+        PIECES,
+
+        /**
+         * Analyse des dispositions (ConfigFileParser et LayoutParser).
+         */
+        PARSER,
+
+        /**
+         * Historique des actions.
+         */
+        HISTORY,
+
+        /**
+         * Commandes de l'interface console.
+         */
+        COMMANDS,
+
+        /**
+         * Vues (console ou widgets Qt).
+         */
+        VIEW,
+
+        /**
+         * Joueurs automatiques.
+         */
+        BOT,
+
+        SUBSYSTEM_COUNT
+    };
+
+    /**
+     * Regroupe l'ensemble des phases de jeu durant lesquelles une allocation peut avoir lieu.
+     */
+    enum Phase{
+
+        /**
+         * En dehors d'une partie.
+         */
+        IDLE,
+
+        /**
+         * Mise en place d'une partie (initialisation, chargement des dispositions).
+         */
+        SETUP,
+
+        /**
+         * Tour de jeu.
+         */
+        TURN,
+
+        /**
+         * Rendu du plateau de jeu.
+         */
+        RENDER,
+
+        PHASE_COUNT
+    };
+
+    /**
+     * Tableau de noms permettant de récupérer la valeur textuelle d'un sous-système.
+     */
+    constexpr std::array<std::string_view, SUBSYSTEM_COUNT> subsystemNames {
+        "other", "model", "pieces", "parser", "history", "commands", "view", "bot"
+    };
+
+    /**
+     * Tableau de noms permettant de récupérer la valeur textuelle d'une phase.
+     */
+    constexpr std::array<std::string_view, PHASE_COUNT> phaseNames {"idle", "setup", "turn", "render"};
+
+    /**
+     * Nombre et taille cumulée d'allocations.
+     */
+    struct Usage{
+        std::uint64_t count;
+        std::uint64_t bytes;
+    };
+
+    /**
+     * Allocations comptabilisées depuis la dernière remise à zéro.
+     */
+    struct Snapshot{
+
+        /**
+         * Allocations par sous-système puis par phase.
+         */
+        std::array<std::array<Usage, PHASE_COUNT>, SUBSYSTEM_COUNT> usage;
+
+        /**
+         * Nombre de tours de jeu terminés.
+         */
+        std::uint64_t turns;
+
+        /**
+         * Calcule le total des allocations de la phase donnée, tous sous-systèmes confondus.
+         *
+         * @param phase la phase
+         * @return le total des allocations de la phase donnée.
+         */
+        Usage total(Phase phase) const noexcept;
+
+        /**
+         * Calcule le total des allocations du sous-système donné, toutes phases confondues.
+         *
+         * @param subsystem le sous-système
+         * @return le total des allocations du sous-système donné.
+         */
+        Usage total(Subsystem subsystem) const noexcept;
+    };
+
+    /**
+     * Vérifie si le suivi des allocations est compilé (STRATEGO_ALLOC_TRACK, qmake CONFIG+=alloctrack),
+     * c'est-à-dire si les opérateurs new globaux sont remplacés.
+     *
+     * @return true si le suivi des allocations est actif, false si non.
+     */
+    constexpr bool enabled() noexcept{
+#ifdef STRATEGO_ALLOC_TRACK
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Comptabilise une allocation de la taille donnée pour le sous-système et la phase courants du
+     * thread courant. Chaque thread possède ses propres compteurs, agrégés par snapshot().
+     *
+     * @param bytes la taille de l'allocation
+     */
+    void record(std::size_t bytes) noexcept;
+
+    /**
+     * Signale la fin d'un tour de jeu.
+     */
+    void endTurn() noexcept;
+
+    /**
+     * Agrège les allocations comptabilisées par l'ensemble des threads.
+     *
+     * @return les allocations depuis la dernière remise à zéro.
+     */
+    Snapshot snapshot() noexcept;
+
+    /**
+     * Remet à zéro l'ensemble des compteurs.
+     */
+    void reset() noexcept;
+
+    /**
+     * Écrit un rapport des allocations (nombre et taille, au total et par tour) par sous-système et
+     * par phase dans le flux donné.
+     *
+     * @param out le flux dans lequel écrire
+     */
+    void report(std::ostream& out);
+
+    /**
+     * Attribue les allocations du thread courant au sous-système donné, depuis sa construction
+     * jusqu'à sa destruction.
+     */
+    class SubsystemScope{
+
+        Subsystem previous_;
+
+        public:
+
+            /**
+             * Change le sous-système courant.
+             *
+             * @param subsystem le sous-système à utiliser
+             */
+            explicit SubsystemScope(Subsystem subsystem) noexcept;
+
+            SubsystemScope(const SubsystemScope&) = delete;
+            SubsystemScope& operator=(const SubsystemScope&) = delete;
+
+            /**
+             * Restaure le sous-système précédent.
+             */
+            ~SubsystemScope() noexcept;
+    };
+
+    /**
+     * Attribue les allocations du thread courant à la phase donnée, depuis sa construction jusqu'à
+     * sa destruction.
+     */
+    class PhaseScope{
+
+        Phase previous_;
+
+        public:
+
+            /**
+             * Change la phase courante.
+             *
+             * @param phase la phase à utiliser
+             */
+            explicit PhaseScope(Phase phase) noexcept;
+
+            PhaseScope(const PhaseScope&) = delete;
+            PhaseScope& operator=(const PhaseScope&) = delete;
+
+            /**
+             * Restaure la phase précédente.
+             */
+            ~PhaseScope() noexcept;
+    };
+}
+
+#define STRATEGO_ALLOC_CONCAT_(a, b) a##b
+#define STRATEGO_ALLOC_CONCAT(a, b) STRATEGO_ALLOC_CONCAT_(a, b)
+
+#ifdef STRATEGO_ALLOC_TRACK
+#define STRATEGO_ALLOC_SUBSYSTEM(subsystem) \
+    ::stratego::alloc::SubsystemScope STRATEGO_ALLOC_CONCAT(allocSubsystem_, __LINE__) {::stratego::alloc::subsystem}
+#define STRATEGO_ALLOC_PHASE(phase) \
+    ::stratego::alloc::PhaseScope STRATEGO_ALLOC_CONCAT(allocPhase_, __LINE__) {::stratego::alloc::phase}
+#define STRATEGO_ALLOC_END_TURN() ::stratego::alloc::endTurn()
+#define STRATEGO_ALLOC_REPORT(out) ::stratego::alloc::report(out)
+#else
+#define STRATEGO_ALLOC_SUBSYSTEM(subsystem) static_cast<void>(0)
+#define STRATEGO_ALLOC_PHASE(phase) static_cast<void>(0)
+#define STRATEGO_ALLOC_END_TURN() static_cast<void>(0)
+#define STRATEGO_ALLOC_REPORT(out) static_cast<void>(0)
+#endif
+
+#endif // ALLOCTRACKER_H
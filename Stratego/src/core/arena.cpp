@@ -0,0 +1,142 @@
+#include <cmath>
+#include <optional>
+
+#include "allocTracker.h"
+#include "arena.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+Interval stratego::wilsonInterval(double score, int games, double z) noexcept{
+    if(games <= 0)
+        return {0, 1};
+
+    double n {static_cast<double>(games)};
+    double p {score / n};
+    double denom {1 + z * z / n};
+    double center {(p + z * z / (2 * n)) / denom};
+    double margin {z * std::sqrt(p * (1 - p) / n + z * z / (4 * n * n)) / denom};
+    return {std::max(0.0, center - margin), std::min(1.0, center + margin)};
+}
+
+BotFailure::BotFailure(Color color, const std::string& what) :
+    std::runtime_error {what},
+    color_ {color}
+{}
+
+Color BotFailure::color() const noexcept{
+    return color_;
+}
+
+namespace{
+
+    /*
+     * Exécute une action d'un bot, toute exception étant imputée au bot de couleur donnée.
+     */
+    template<class Action>
+    auto guarded(Color color, Action&& action){
+        try{
+            return action();
+        } catch(const BotFailure&){
+            throw;
+        } catch(const std::exception& e){
+            throw BotFailure{color, e.what()};
+        }
+    }
+
+    /*
+     * Issue d'une partie arbitrée: le joueur ayant perdu au moins margin pions de moins que son
+     * adversaire l'emporte.
+     */
+    GameOutcome adjudicate(const Observation& obs, int margin) noexcept{
+        if(margin <= 0)
+            return GameOutcome::DRAW;
+
+        int lost[Config::PLAYER_COUNT] {};
+        for(int c = 0; c < Config::PLAYER_COUNT; c++){
+            for(std::uint8_t count : obs.captured[c])
+                lost[c] += count;
+        }
+
+        if(lost[1] - lost[0] >= margin)
+            return GameOutcome::RED_WIN;
+        if(lost[0] - lost[1] >= margin)
+            return GameOutcome::BLUE_WIN;
+
+        return GameOutcome::DRAW;
+    }
+
+    /*
+     * Joue une partie sur le modèle de type donné: les appels ne passent pas par la table virtuelle.
+     */
+    template<class Game>
+    GameOutcome playOn(const Layout& red, const Layout& blue, Bot& redBot, Bot& blueBot,
+                       int maxTurns, const TimeControl& timeControl, int materialMargin){
+        Game model {};
+        model.setTimeControl(timeControl);
+        model.init();
+        for(auto [layout, color] : {std::pair{&red, Color::RED}, std::pair{&blue, Color::BLUE}}){
+            model.load(*layout, color);
+            if(model.currentState() != StateGraph::SET_UP)
+                throw std::invalid_argument("The given layout cannot be loaded");
+        }
+
+        guarded(Color::RED, [&]{ redBot.start(red, Color::RED); });
+        guarded(Color::BLUE, [&]{ blueBot.start(blue, Color::BLUE); });
+        model.setup(redBot.name(), blueBot.name());
+        std::optional<GameOutcome> outcome {};
+        for(int turn = 0; turn < maxTurns && !outcome; turn++){
+            STRATEGO_ALLOC_PHASE(TURN);
+            model.nextPlayer();
+            Color color {model.currentPlayer().color()};
+            Bot& bot {color == Color::RED ? redBot : blueBot};
+            BotMove move {guarded(color, [&]{ return bot.play(model); })};
+            guarded(color, [&]{ model.moveAttack(move.start, move.end); }); // un coup hors du plateau lève une exception
+            if(model.currentState() != StateGraph::GAME_TURN)
+                throw BotFailure{color, "The bot played an invalid move"};
+
+            model.nextTurn();
+            model.history().clear(); // l'historique est borné: seule l'issue de la partie importe ici
+            if(model.currentState() == StateGraph::GAME_OVER){
+                outcome = GameOutcome::DRAW;
+                if(model.hasWon(Color::RED) != model.hasWon(Color::BLUE))
+                    outcome = model.hasWon(Color::RED) ? GameOutcome::RED_WIN : GameOutcome::BLUE_WIN;
+            }
+        }
+
+        // les pions capturés sont connus des deux joueurs: l'observation rouge suffit
+        GameOutcome result {outcome.value_or(adjudicate(model.observation(Color::RED), materialMargin))};
+        guarded(Color::RED, [&]{ redBot.finish(result); });
+        guarded(Color::BLUE, [&]{ blueBot.finish(result); });
+        return result;
+    }
+}
+
+Arena::Arena(int maxTurns, const TimeControl& timeControl, bool reveal, int materialMargin) noexcept :
+    maxTurns_ {maxTurns},
+    timeControl_ {timeControl},
+    reveal_ {reveal},
+    materialMargin_ {materialMargin}
+{}
+
+GameOutcome Arena::play(const Layout& red, const Layout& blue, Bot& redBot, Bot& blueBot) const{
+    if(reveal_)
+        return playOn<StrategoReveal>(red, blue, redBot, blueBot, maxTurns_, timeControl_, materialMargin_);
+
+    return playOn<Stratego>(red, blue, redBot, blueBot, maxTurns_, timeControl_, materialMargin_);
+}
+
+bool Arena::playable(const Layout& layout){
+    if(!LayoutParser::isArmy(layout))
+        return false;
+
+    for(Color color : {Color::RED, Color::BLUE}){
+        Stratego model {};
+        model.init();
+        model.load(layout, color);
+        if(model.currentState() != StateGraph::SET_UP)
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,109 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "bot.h"
+
+namespace stratego{
+
+    /**
+     * Intervalle de confiance d'une proportion.
+     */
+    struct Interval{
+        double low;
+        double high;
+    };
+
+    /**
+     * Calcule l'intervalle de confiance de Wilson d'un taux de réussite.
+     *
+     * @param score le nombre de réussites (une égalité pouvant compter pour une demi-réussite)
+     * @param games le nombre d'essais
+     * @param z le quantile de la loi normale correspondant au niveau de confiance (1.96 pour 95%)
+     * @return l'intervalle de confiance du taux de réussite ([0, 1] si aucun essai n'a été réalisé).
+     */
+    Interval wilsonInterval(double score, int games, double z = 1.96) noexcept;
+
+    /**
+     * Échec d'un bot lors d'une partie jouée dans l'Arena: le bot a levé une exception (moteur
+     * terminé, temps de réponse dépassé, ...) ou a joué un coup invalide. La partie est perdue par
+     * forfait par le joueur de la couleur donnée.
+     */
+    class BotFailure : public std::runtime_error{
+
+        model::Color color_;
+
+        public:
+
+            /**
+             * Construit l'échec du bot de couleur donnée.
+             *
+             * @param color la couleur du bot ayant échoué
+             * @param what la cause de l'échec
+             */
+            BotFailure(model::Color color, const std::string& what);
+
+            /**
+             * Récupère la couleur du bot ayant échoué.
+             *
+             * @return la couleur du bot ayant échoué.
+             */
+            model::Color color() const noexcept;
+    };
+
+    /**
+     * Arène faisant s'affronter deux bots sur le modèle de jeu classique ou Reveal, sans vue ni
+     * contrôleur. Les parties peuvent être chronométrées: un bot dont le temps s'écoule perd la partie.
+     */
+    class Arena{
+
+        int maxTurns_;
+        model::TimeControl timeControl_;
+        bool reveal_;
+        int materialMargin_;
+
+        public:
+
+            /**
+             * Nombre de tours par défaut au bout duquel une partie est arbitrée.
+             */
+            static constexpr int DEFAULT_MAX_TURNS = 2000;
+
+            /**
+             * Construit une arène.
+             *
+             * @param maxTurns le nombre de tours au bout duquel une partie est arbitrée
+             * @param timeControl le contrôle du temps des parties (non chronométrées par défaut)
+             * @param reveal true pour jouer la variante Reveal (cf. model::StrategoReveal), false
+             * pour la version classique
+             * @param materialMargin l'écart de pions capturés à partir duquel une partie arbitrée est
+             * attribuée au joueur ayant perdu le moins de pions (0: toute partie arbitrée est nulle)
+             */
+            explicit Arena(int maxTurns = DEFAULT_MAX_TURNS, const model::TimeControl& timeControl = {},
+                           bool reveal = false, int materialMargin = 0) noexcept;
+
+            /**
+             * Joue une partie complète entre deux bots.
+             *
+             * @throw std::invalid_argument si l'une des dispositions ne peut être chargée (cf. playable())
+             * @throw BotFailure si l'un des bots échoue à jouer ou joue un coup invalide
+             *
+             * @param red la disposition du joueur rouge
+             * @param blue la disposition du joueur bleu
+             * @param redBot le bot du joueur rouge
+             * @param blueBot le bot du joueur bleu
+             * @return l'issue de la partie.
+             */
+            GameOutcome play(const model::Layout& red, const model::Layout& blue, Bot& redBot, Bot& blueBot) const;
+
+            /**
+             * Vérifie si une disposition peut être jouée: elle décrit une armée complète et au moins un
+             * de ses pions peut se déplacer.
+             *
+             * @param layout la disposition à vérifier
+             * @return true si la disposition peut être jouée par chacun des joueurs, false si non.
+             */
+            static bool playable(const model::Layout& layout);
+    };
+}
+
+#endif // ARENA_H
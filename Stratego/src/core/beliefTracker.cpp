@@ -0,0 +1,250 @@
+#include <cstdlib>
+#include <stdexcept>
+
+#include "beliefTracker.h"
+#include "variant.h"
+
+using namespace stratego::model;
+
+namespace{
+
+    int enemyIndex(Color viewer) noexcept{
+        return viewer == Color::RED ? 1 : 0;
+    }
+
+    constexpr int LANES = 8;
+
+    static_assert(BeliefTracker::MAX_PIECES % LANES == 0, "Pieces must fill whole vector lanes");
+
+    int combatCount(const Observation& obs) noexcept{
+        int count {};
+        for(const auto& captured : obs.captured){
+            for(std::uint8_t c : captured)
+                count += c;
+        }
+
+        return count;
+    }
+}
+
+BeliefTracker::BeliefTracker(Color viewer) noexcept :
+    viewer_ {viewer},
+    probs_ {},
+    hidden_ {},
+    slots_ {},
+    squares_ {},
+    remaining_ {},
+    captured_ {},
+    combats_ {},
+    plies_ {}
+{
+    slots_.fill(-1);
+}
+
+/* ===== Reconstruction ===== */
+
+void BeliefTracker::reset(const Observation& obs){
+    if(obs.viewer != viewer_)
+        throw std::invalid_argument("The observation does not belong to the tracked player");
+
+    std::array<int, RANKS> remaining {};
+    for(int rank = 0; rank < RANKS; rank++)
+        remaining[rank] = ClassicVariant::ARMY[rank] - obs.captured[enemyIndex(viewer_)][rank];
+
+    rebuild(obs, remaining);
+}
+
+void BeliefTracker::reset(const Observation& obs, const std::map<int, int>& remaining){
+    if(obs.viewer != viewer_)
+        throw std::invalid_argument("The observation does not belong to the tracked player");
+
+    std::array<int, RANKS> counts {};
+    for(auto [rank, count] : remaining){
+        if(rank >= 0 && rank < RANKS)
+            counts[rank] = count;
+    }
+
+    rebuild(obs, counts);
+}
+
+void BeliefTracker::rebuild(const Observation& obs, const std::array<int, RANKS>& remaining) noexcept{
+    for(auto& probs : probs_)
+        probs.fill(0);
+    hidden_.fill(0);
+    slots_.fill(-1);
+    remaining_ = remaining;
+    captured_ = obs.captured[enemyIndex(viewer_)];
+    combats_ = combatCount(obs);
+    plies_ = obs.plies;
+
+    int count {};
+    for(int square = 0; square < Observation::SQUARES && count < MAX_PIECES; square++){
+        if(!(obs.flags[square] & Observation::ENEMY))
+            continue;
+
+        int slot {count++};
+        slots_[square] = static_cast<std::int8_t>(slot);
+        squares_[slot] = static_cast<std::uint8_t>(square);
+        hidden_[slot] = 1;
+        if(obs.ranks[square] >= 0){
+            reveal(slot, obs.ranks[square]);
+            continue;
+        }
+
+        for(int rank = 0; rank < RANKS; rank++)
+            probs_[rank][slot] = static_cast<float>(remaining_[rank]);
+        if(obs.flags[square] & Observation::MOVED){
+            exclude(slot, Config::PIECE_FLAG_INFO.rank);
+            exclude(slot, Config::PIECE_BOMB_INFO.rank);
+        }
+    }
+
+    project();
+}
+
+/* ===== Mises à jour ===== */
+
+void BeliefTracker::update(const Observation& obs){
+    if(obs.viewer != viewer_)
+        throw std::invalid_argument("The observation does not belong to the tracked player");
+    if(obs.plies == plies_)
+        return;
+    if(obs.plies != plies_ + 1){
+        reset(obs);
+        return;
+    }
+
+    int from {obs.lastFrom}, to {obs.lastTo};
+    int attacker {slots_[from]};
+    int combats {combatCount(obs)};
+    if(combats == combats_){ // déplacement simple
+        if(attacker >= 0){
+            relocate(attacker, to);
+            exclude(attacker, Config::PIECE_FLAG_INFO.rank);
+            exclude(attacker, Config::PIECE_BOMB_INFO.rank);
+            if(std::abs(to - from) != 1 && std::abs(to - from) != Config::BOARD_SIZE)
+                reveal(attacker, Config::PIECE_SCOUT_INFO.rank);
+        }
+    } else{ // combat: le pion adverse impliqué est révélé, qu'il survive ou non
+        const auto& captured {obs.captured[enemyIndex(viewer_)]};
+        int slot {attacker >= 0 ? attacker : slots_[to]};
+        int dead {-1};
+        for(int rank = 0; rank < RANKS; rank++){
+            if(captured[rank] != captured_[rank])
+                dead = rank;
+        }
+
+        if(slot >= 0 && dead >= 0){
+            reveal(slot, dead);
+            drop(slot);
+        } else if(slot >= 0){
+            reveal(slot, obs.ranks[to]);
+            relocate(slot, to);
+        }
+
+        captured_ = captured;
+        combats_ = combats;
+    }
+
+    plies_ = obs.plies;
+    project();
+}
+
+void BeliefTracker::reveal(int slot, int rank) noexcept{
+    if(hidden_[slot] != 0 && remaining_[rank] > 0)
+        remaining_[rank]--;
+
+    hidden_[slot] = 0;
+    for(int r = 0; r < RANKS; r++)
+        probs_[r][slot] = r == rank ? 1.f : 0.f;
+}
+
+void BeliefTracker::drop(int slot) noexcept{
+    slots_[squares_[slot]] = -1;
+    hidden_[slot] = 0;
+    for(auto& probs : probs_)
+        probs[slot] = 0;
+}
+
+void BeliefTracker::relocate(int slot, int square) noexcept{
+    slots_[squares_[slot]] = -1;
+    slots_[square] = static_cast<std::int8_t>(slot);
+    squares_[slot] = static_cast<std::uint8_t>(square);
+}
+
+void BeliefTracker::exclude(int slot, int rank) noexcept{
+    probs_[rank][slot] = 0;
+}
+
+void BeliefTracker::project() noexcept{
+    for(int it = 0; it < ITERATIONS; it++){
+        // chaque rang: l'espérance sur les pions cachés doit valoir le nombre de pions cachés restants
+        for(int rank = 0; rank < RANKS; rank++){
+            std::array<float, MAX_PIECES>& probs {probs_[rank]};
+            // accumulateurs par voie: la réduction reste vectorisable sans réassocier les flottants
+            std::array<float, LANES> lanes {};
+            for(int i = 0; i < MAX_PIECES; i += LANES){
+                for(int lane = 0; lane < LANES; lane++)
+                    lanes[lane] += probs[i + lane] * hidden_[i + lane];
+            }
+
+            float expected {};
+            for(float lane : lanes)
+                expected += lane;
+
+            float scale {expected > 0 ? remaining_[rank] / expected : 1.f};
+            for(int i = 0; i < MAX_PIECES; i++)
+                probs[i] *= 1 + hidden_[i] * (scale - 1);
+        }
+
+        // chaque pion: les probabilités de ses rangs doivent sommer à 1
+        alignas(32) std::array<float, MAX_PIECES> totals {};
+        for(const auto& probs : probs_){
+            for(int i = 0; i < MAX_PIECES; i++)
+                totals[i] += probs[i];
+        }
+
+        for(int i = 0; i < MAX_PIECES; i++)
+            totals[i] = totals[i] > 0 ? 1 / totals[i] : 1.f;
+        for(auto& probs : probs_){
+            for(int i = 0; i < MAX_PIECES; i++)
+                probs[i] *= totals[i];
+        }
+    }
+}
+
+/* ===== Consultation ===== */
+
+float BeliefTracker::probability(const Position& pos, int rank) const noexcept{
+    int slot {slots_[Observation::toSquare(pos)]};
+    return slot < 0 || rank < 0 || rank >= RANKS ? 0.f : probs_[rank][slot];
+}
+
+BeliefTracker::Distribution BeliefTracker::distribution(const Position& pos) const noexcept{
+    Distribution dist {};
+    int slot {slots_[Observation::toSquare(pos)]};
+    if(slot >= 0){
+        for(int rank = 0; rank < RANKS; rank++)
+            dist[rank] = probs_[rank][slot];
+    }
+
+    return dist;
+}
+
+int BeliefTracker::mostLikely(const Position& pos) const noexcept{
+    int slot {slots_[Observation::toSquare(pos)]};
+    if(slot < 0)
+        return Observation::EMPTY;
+
+    int best {};
+    for(int rank = 1; rank < RANKS; rank++){
+        if(probs_[rank][slot] > probs_[best][slot])
+            best = rank;
+    }
+
+    return best;
+}
+
+const std::array<int, BeliefTracker::RANKS>& BeliefTracker::remaining() const noexcept{
+    return remaining_;
+}
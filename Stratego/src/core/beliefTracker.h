@@ -0,0 +1,174 @@
+#ifndef BELIEFTRACKER_H
+#define BELIEFTRACKER_H
+
+#include <map>
+
+#include "observation.h"
+
+/*========================================
+* Croyances sur les rangs des pions
+* adverses cachés
+*=========================================
+*/
+
+namespace stratego::model {
+
+    /**
+     * Estime, pour chaque pion adverse, la probabilité de chacun des rangs à partir de ce qu'un joueur
+     * observe (cf. Observation): un pion qui se déplace n'est ni une bombe ni le drapeau, un pion qui
+     * parcourt plusieurs cases est un éclaireur et un combat révèle le rang des deux pions. Les
+     * probabilités des pions encore cachés sont ensuite ajustées pour que l'espérance du nombre de
+     * pions de chaque rang corresponde au nombre de pions cachés restants (ajustement proportionnel
+     * itératif).
+     *
+     * Les probabilités sont stockées par rang puis par pion (structure de tableaux): chaque
+     * ajustement parcourt des tableaux contigus de MAX_PIECES flottants sans branchement, boucles que
+     * le compilateur vectorise. Le suivi est de taille fixe et n'alloue pas: il peut être copié à
+     * chaque nœud d'une recherche ou d'une simulation.
+     */
+    class BeliefTracker{
+
+        public:
+
+            /**
+             * Nombre de rangs distincts.
+             */
+            static constexpr int RANKS = Config::PIECE_MAX_RANK + 1;
+
+            /**
+             * Nombre maximal de pions adverses suivis.
+             */
+            static constexpr int MAX_PIECES = Config::ARMY_SIZE;
+
+            /**
+             * Nombre d'itérations d'ajustement effectuées après chaque mise à jour.
+             */
+            static constexpr int ITERATIONS = 2;
+
+            /**
+             * Distribution de probabilité sur les rangs d'un pion.
+             */
+            using Distribution = std::array<float, RANKS>;
+
+        private:
+
+            Color viewer_;
+            alignas(32) std::array<std::array<float, MAX_PIECES>, RANKS> probs_;
+            alignas(32) std::array<float, MAX_PIECES> hidden_;
+            std::array<std::int8_t, Observation::SQUARES> slots_;
+            std::array<std::uint8_t, MAX_PIECES> squares_;
+            std::array<int, RANKS> remaining_;
+            std::array<std::uint8_t, RANKS> captured_;
+            int combats_;
+            int plies_;
+
+        public:
+
+            /**
+             * Construit un suivi vide pour le joueur de couleur donnée.
+             *
+             * @param viewer la couleur du joueur dont c'est la perspective
+             */
+            explicit BeliefTracker(Color viewer) noexcept;
+
+            /**
+             * Reconstruit entièrement les croyances depuis l'observation donnée. Le nombre de pions
+             * restants de chaque rang est déduit des pions capturés.
+             *
+             * @param obs l'observation du joueur
+             *
+             * @throw std::invalid_argument si l'observation n'est pas celle du joueur suivi
+             */
+            void reset(const Observation& obs);
+
+            /**
+             * Reconstruit entièrement les croyances depuis l'observation donnée et le nombre de pions
+             * restants de chaque rang de l'adversaire (cf. Player::stats()).
+             *
+             * @param obs l'observation du joueur
+             * @param remaining le nombre de pions restants de l'adversaire, par rang
+             *
+             * @throw std::invalid_argument si l'observation n'est pas celle du joueur suivi
+             */
+            void reset(const Observation& obs, const std::map<int, int>& remaining);
+
+            /**
+             * Applique la dernière action de l'observation donnée. Si plusieurs actions ont été
+             * manquées, les croyances sont reconstruites (cf. reset()); les informations tirées des
+             * déplacements d'éclaireur sont alors perdues.
+             *
+             * @param obs l'observation du joueur, une action après la précédente mise à jour
+             *
+             * @throw std::invalid_argument si l'observation n'est pas celle du joueur suivi
+             */
+            void update(const Observation& obs);
+
+            /**
+             * Récupère la probabilité que le pion adverse de la position donnée soit du rang donné.
+             *
+             * @param pos la position du pion
+             * @param rank le rang
+             * @return la probabilité, 0 si la position ne contient aucun pion adverse.
+             */
+            float probability(const Position& pos, int rank) const noexcept;
+
+            /**
+             * Récupère la distribution de probabilité des rangs du pion adverse de la position donnée.
+             *
+             * @param pos la position du pion
+             * @return la distribution, nulle si la position ne contient aucun pion adverse.
+             */
+            Distribution distribution(const Position& pos) const noexcept;
+
+            /**
+             * Récupère le rang le plus probable du pion adverse de la position donnée.
+             *
+             * @param pos la position du pion
+             * @return le rang le plus probable, Observation::EMPTY si la position ne contient aucun
+             * pion adverse.
+             */
+            int mostLikely(const Position& pos) const noexcept;
+
+            /**
+             * Récupère le nombre de pions adverses encore cachés de chaque rang.
+             *
+             * @return le nombre de pions cachés, indexé par rang.
+             */
+            const std::array<int, RANKS>& remaining() const noexcept;
+
+        private:
+
+            /*
+             * Reconstruit les croyances depuis l'observation donnée et le nombre de pions restants
+             * de chaque rang, pions révélés compris.
+             */
+            void rebuild(const Observation& obs, const std::array<int, RANKS>& remaining) noexcept;
+
+            /*
+             * Révèle le rang du pion de l'emplacement donné.
+             */
+            void reveal(int slot, int rank) noexcept;
+
+            /*
+             * Retire le pion de l'emplacement donné.
+             */
+            void drop(int slot) noexcept;
+
+            /*
+             * Déplace le pion de l'emplacement donné vers la case donnée.
+             */
+            void relocate(int slot, int square) noexcept;
+
+            /*
+             * Annule la probabilité du rang donné pour le pion de l'emplacement donné.
+             */
+            void exclude(int slot, int rank) noexcept;
+
+            /*
+             * Ajuste les probabilités des pions cachés sur le nombre de pions restants.
+             */
+            void project() noexcept;
+    };
+}
+
+#endif // BELIEFTRACKER_H
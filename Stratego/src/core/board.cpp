@@ -1,8 +1,24 @@
 #include "gamestuff.h"
+#include "variant.h"
 
 using namespace stratego::model;
-Board::Board() noexcept{
+
+namespace{
+
+    int colorIndex(Color color) noexcept{
+        return color == Color::RED ? 0 : 1;
+    }
+}
+
+Board::Board() noexcept :
+    slots_ {},
+    pieces_ {},
+    positions_ {},
+    counts_ {}
+{
     int bs {Config::BOARD_SIZE};
+    for(auto& row : slots_)
+        row.fill(-1);
 
     /* top and bottom walls */
     for(int i = 0; i < bs; i += bs - 1){
@@ -26,15 +42,8 @@ Board::Board() noexcept{
     }
 
     /* water cells */
-    board_[bs / 2 - 1][3].type = Cell::WATER;
-    board_[bs / 2 - 1][4].type = Cell::WATER;
-    board_[bs / 2][3].type = Cell::WATER;
-    board_[bs / 2][4].type = Cell::WATER;
-
-    board_[bs / 2 - 1][bs - 4].type = Cell::WATER;
-    board_[bs / 2 - 1][bs - 5].type = Cell::WATER;
-    board_[bs / 2][bs - 4].type = Cell::WATER;
-    board_[bs / 2][bs - 5].type = Cell::WATER;
+    for(const Position& lake : ClassicVariant::LAKES)
+        board_[lake.y][lake.x].type = Cell::WATER;
 }
 
 Piece* Board::getPiece(int x, int y){
@@ -119,15 +128,91 @@ const std::array<Cell, stratego::Config::BOARD_SIZE>* Board::end() const{
     return &board_[board_.size()];
 }
 
+void Board::place(const Position& pos, Piece* piece){
+    Cell& cell {getCell(pos)};
+    if(cell.piece)
+        unlink(pos);
+
+    cell.piece = piece;
+    if(piece)
+        link(pos, piece);
+}
+
+Piece* Board::remove(const Position& pos){
+    Cell& cell {getCell(pos)};
+    Piece* piece {cell.piece};
+    if(piece){
+        unlink(pos);
+        cell.piece = nullptr;
+    }
+
+    return piece;
+}
+
+void Board::move(const Position& from, const Position& to){
+    Cell& source {getCell(from)};
+    Cell& target {getCell(to)};
+    if(target.piece)
+        unlink(to);
+
+    std::int16_t slot {slots_[from.y][from.x]};
+    if(slot >= 0){
+        positions_[slot / MAX_PIECES][slot % MAX_PIECES] = to;
+        slots_[from.y][from.x] = -1;
+    }
+
+    slots_[to.y][to.x] = slot;
+    target.piece = source.piece;
+    source.piece = nullptr;
+}
+
+Board::PieceList Board::pieces(Color color) const noexcept{
+    int index {colorIndex(color)};
+    return {pieces_[index].data(), pieces_[index].data() + counts_[index]};
+}
+
+void Board::link(const Position& pos, Piece* piece) noexcept{
+    int color {colorIndex(piece -> color())};
+    int index {counts_[color]++};
+    pieces_[color][index] = piece;
+    positions_[color][index] = pos;
+    slots_[pos.y][pos.x] = static_cast<std::int16_t>(color * MAX_PIECES + index);
+}
+
+void Board::unlink(const Position& pos) noexcept{
+    std::int16_t slot {slots_[pos.y][pos.x]};
+    if(slot < 0) // pion affecté directement à Cell::piece
+        return;
+
+    // retrait par permutation avec le dernier pion de la liste
+    int color {slot / MAX_PIECES}, index {slot % MAX_PIECES};
+    int last {--counts_[color]};
+    slots_[pos.y][pos.x] = -1;
+    if(index != last){
+        pieces_[color][index] = pieces_[color][last];
+        positions_[color][index] = positions_[color][last];
+        const Position& moved {positions_[color][index]};
+        slots_[moved.y][moved.x] = slot;
+    }
+}
+
 Board::~Board(){
+    clear();
+}
+
+void Board::clear() noexcept{
     for(int i = 0; i < size(); i++){
         for(int j = 0; j < size(); j++){
             if(board_[i][j].piece){
                 delete board_[i][j].piece;
                 board_[i][j].piece = nullptr;
             }
+
+            slots_[i][j] = -1;
         }
     }
+
+    counts_.fill(0);
 }
 
 bool Board::isInside(const Position& pos) const noexcept{
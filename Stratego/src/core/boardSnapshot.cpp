@@ -0,0 +1,79 @@
+#include <atomic>
+
+#include "boardSnapshot.h"
+
+using namespace stratego::model;
+
+/* ===== BoardSnapshot ===== */
+
+int BoardSnapshot::count(Color color) const noexcept{
+    int count {};
+    for(const Square& square : squares){
+        if(square.rank != Observation::EMPTY && square.color == color)
+            count++;
+    }
+
+    return count;
+}
+
+/* ===== SnapshotPublisher ===== */
+
+SnapshotPublisher::SnapshotPublisher() :
+    current_ {},
+    buffers_ {},
+    version_ {}
+{
+    clear();
+}
+
+void SnapshotPublisher::clear(){
+    BoardSnapshot& next {spare()};
+    next = {};
+    for(BoardSnapshot::Square& square : next.squares)
+        square.rank = Observation::EMPTY;
+
+    swap();
+}
+
+void SnapshotPublisher::publish(const ObservationBuilder& observations){
+    const Observation& red {observations.of(Color::RED)};
+    const Observation& blue {observations.of(Color::BLUE)};
+    BoardSnapshot& next {spare()};
+    for(int square = 0; square < BoardSnapshot::SQUARES; square++){
+        const Observation& owner {blue.flags[square] & Observation::OWN ? blue : red};
+        next.squares[square] = {owner.ranks[square], owner.viewer,
+                                static_cast<std::uint8_t>(owner.flags[square] & (Observation::MOVED | Observation::REVEALED))};
+    }
+
+    next.plies = red.plies;
+    next.lastFrom = red.lastFrom;
+    next.lastTo = red.lastTo;
+    next.captured = red.captured;
+    swap();
+}
+
+std::shared_ptr<const BoardSnapshot> SnapshotPublisher::acquire() const noexcept{
+    return std::atomic_load(&current_);
+}
+
+BoardSnapshot& SnapshotPublisher::spare(){
+    for(std::shared_ptr<BoardSnapshot>& buffer : buffers_){
+        // l'instantané courant est aussi détenu par current_: seul un tampon retiré peut être unique
+        if(buffer && buffer.use_count() == 1){
+            // les lectures du dernier lecteur précèdent sa libération du tampon
+            std::atomic_thread_fence(std::memory_order_acquire);
+            std::swap(buffer, buffers_[1]);
+            return *buffers_[1];
+        }
+    }
+
+    // tampons encore lus (ou premier appel): le plus ancien est abandonné à ses lecteurs
+    buffers_[0] = std::move(buffers_[1]);
+    buffers_[1] = std::make_shared<BoardSnapshot>();
+    return *buffers_[1];
+}
+
+void SnapshotPublisher::swap() noexcept{
+    buffers_[1] -> version = ++version_;
+    std::atomic_store(&current_, std::shared_ptr<const BoardSnapshot>{buffers_[1]});
+}
@@ -0,0 +1,159 @@
+#ifndef BOARDSNAPSHOT_H
+#define BOARDSNAPSHOT_H
+
+#include <memory>
+
+#include "observation.h"
+
+/*========================================
+* Instantanés immuables du plateau de jeu
+* pour les lecteurs concurrents
+*=========================================
+*/
+
+namespace stratego::model {
+
+    /**
+     * Position complète de la partie à un instant donné: rang, couleur et indicateurs de chaque case,
+     * pions capturés et dernière action. Un instantané publié n'est plus jamais modifié, il peut donc
+     * être lu sans verrou par n'importe quel thread (rendu, journalisation, analyse) pendant que la
+     * partie continue.
+     *
+     * Contrairement à Observation, l'instantané contient les rangs cachés des deux joueurs: il ne doit
+     * pas être transmis tel quel à un joueur automatique.
+     */
+    struct BoardSnapshot{
+
+        /**
+         * Nombre de cases du plateau de jeu.
+         */
+        static constexpr int SQUARES = Observation::SQUARES;
+
+        /**
+         * Contenu d'une case.
+         */
+        struct Square{
+
+            /**
+             * Rang du pion, Observation::EMPTY si la case est vide.
+             */
+            std::int8_t rank;
+
+            /**
+             * Couleur du pion (sans signification si la case est vide).
+             */
+            Color color;
+
+            /**
+             * Indicateurs Observation::MOVED et Observation::REVEALED du pion.
+             */
+            std::uint8_t flags;
+        };
+
+        /**
+         * Numéro de version de l'instantané, strictement croissant d'une publication à l'autre.
+         */
+        std::uint64_t version;
+
+        /**
+         * Nombre d'actions (déplacements et attaques) jouées depuis le début de la partie.
+         */
+        int plies;
+
+        /**
+         * Cases de départ et d'arrivée de la dernière action (0 si aucune).
+         */
+        std::uint8_t lastFrom, lastTo;
+
+        /**
+         * Contenu de chaque case, indexé comme Observation.
+         */
+        std::array<Square, SQUARES> squares;
+
+        /**
+         * Nombre de pions capturés par couleur (rouge puis bleu) puis par rang.
+         */
+        std::array<std::array<std::uint8_t, Config::PIECE_MAX_RANK + 1>, Config::PLAYER_COUNT> captured;
+
+        /**
+         * Récupère le contenu de la case de la position donnée.
+         *
+         * @param pos la position de la case
+         * @return le contenu de la case.
+         */
+        const Square& at(const Position& pos) const noexcept{
+            return squares[Observation::toSquare(pos)];
+        }
+
+        /**
+         * Compte les pions de la couleur donnée encore sur le plateau de jeu.
+         *
+         * @param color la couleur des pions
+         * @return le nombre de pions.
+         */
+        int count(Color color) const noexcept;
+    };
+
+    /**
+     * Publie les instantanés successifs du plateau de jeu (publication de type RCU). L'unique
+     * écrivain construit chaque nouvel instantané à l'écart puis l'échange atomiquement avec le
+     * précédent; un lecteur acquiert l'instantané courant par un simple chargement atomique et le
+     * conserve aussi longtemps qu'il le souhaite, sans jamais bloquer l'écrivain.
+     *
+     * Deux tampons sont recyclés en alternance (double tampon): un instantané n'est réécrit que
+     * lorsque plus aucun lecteur ne le détient, sans quoi un nouveau tampon est alloué. En régime
+     * établi, une publication n'alloue donc rien.
+     */
+    class SnapshotPublisher{
+
+        std::shared_ptr<const BoardSnapshot> current_;
+        std::array<std::shared_ptr<BoardSnapshot>, 2> buffers_;
+        std::uint64_t version_;
+
+        public:
+
+            /**
+             * Construit un éditeur publiant un plateau de jeu vide.
+             */
+            SnapshotPublisher();
+
+            SnapshotPublisher(const SnapshotPublisher&) = delete;
+
+            SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+
+            /**
+             * Publie un plateau de jeu vide. Ne doit être appelée que par l'écrivain.
+             */
+            void clear();
+
+            /**
+             * Publie la position décrite par les observations des deux joueurs: chaque case est
+             * reprise de l'observation du joueur à qui appartient le pion, seul à en connaître le
+             * rang. Ne doit être appelée que par l'écrivain.
+             *
+             * @param observations les observations des deux joueurs
+             */
+            void publish(const ObservationBuilder& observations);
+
+            /**
+             * Acquiert l'instantané courant. Peut être appelée depuis n'importe quel thread.
+             *
+             * @return l'instantané courant, jamais nul.
+             */
+            std::shared_ptr<const BoardSnapshot> acquire() const noexcept;
+
+        private:
+
+            /*
+             * Récupère un tampon qu'aucun lecteur ne détient, en allouant un nouveau si nécessaire.
+             */
+            BoardSnapshot& spare();
+
+            /*
+             * Publie le tampon de réserve et en fait l'instantané courant.
+             */
+            void swap() noexcept;
+    };
+}
+
+#endif // BOARDSNAPSHOT_H
@@ -0,0 +1,123 @@
+#include "allocTracker.h"
+#include "bot.h"
+#include "engineBot.h"
+#include "pluginBot.h"
+#include "piece.h"
+#include "searchEngine.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+/* ========================== Bot =========================== */
+std::vector<BotMove> Bot::legalMoves(const Model& model){
+    STRATEGO_ALLOC_SUBSYSTEM(BOT);
+    const Board& board {model.board()};
+    Color color {model.currentPlayer().color()};
+    std::array<Position, 4> directions {{{0, 1}, {0, -1}, {1, 0}, {-1, 0}}};
+    std::vector<BotMove> moves {};
+    std::uint64_t checks {};
+
+    for(int y = 1; y < board.size() - 1; y++){
+        for(int x = 1; x < board.size() - 1; x++){
+            const Piece* piece {board.getPiece(x, y)};
+            if(!piece || piece -> color() != color)
+                continue;
+
+            for(const Position& dir : directions){
+                Position pos {piece -> position() + dir};
+                while(board.isInside(pos)){
+                    checks += 2;
+                    if(piece -> canAttack(pos)){
+                        moves.push_back({piece -> position(), pos});
+                        break;
+                    }
+                    if(model.canMove(*piece, pos))
+                        moves.push_back({piece -> position(), pos});
+                    if(!board.walkableCell(pos) || piece -> rank() != Config::PIECE_SCOUT_INFO.rank)
+                        break;
+
+                    pos = pos + dir;
+                }
+            }
+        }
+    }
+
+    // comptés une seule fois par génération plutôt qu'à chaque vérification
+    model.counters().add(perf::LEGALITY_CHECKS, checks);
+    return moves;
+}
+
+GameClock::Duration Bot::budget(const Model& model){
+    const GameClock& clock {model.currentPlayer().clock()};
+    GameClock::Duration remaining {clock.remaining()};
+    if(remaining == GameClock::Duration::max())
+        return remaining;
+    if(remaining <= GameClock::Duration::zero())
+        return GameClock::Duration::zero();
+
+    return std::min(remaining / MOVES_TO_GO + clock.control().increment * 3 / 4, remaining / 2);
+}
+
+std::unique_ptr<Bot> Bot::create(std::string_view name, std::uint64_t seed){
+    if(util::striequals(name, "random"))
+        return std::make_unique<RandomBot>(seed);
+    if(util::striequals(name, "search"))
+        return std::make_unique<SearchBot>();
+    if(name.size() > 7 && util::striequals(name.substr(0, 7), "engine:"))
+        return std::make_unique<EngineBot>(std::string{name.substr(7)});
+    if(name.size() > 7 && util::striequals(name.substr(0, 7), "plugin:"))
+        return PluginBot::load(std::string{name.substr(7)}, seed);
+
+    throw std::invalid_argument("No matching bot");
+}
+
+
+/* ========================== RandomBot =========================== */
+RandomBot::RandomBot(std::uint64_t seed) noexcept :
+    gen_ {seed}
+{}
+
+BotMove RandomBot::play(const Model& model){
+    STRATEGO_ALLOC_SUBSYSTEM(BOT);
+    std::vector<BotMove> moves {legalMoves(model)};
+    if(moves.empty())
+        throw std::logic_error("The current player cannot move");
+
+    std::uniform_int_distribution<size_t> dist {0, moves.size() - 1};
+    return moves[dist(gen_)];
+}
+
+std::string RandomBot::name() const{
+    return "random";
+}
+
+
+/* ========================== SearchBot =========================== */
+SearchBot::SearchBot(int maxDepth) noexcept :
+    maxDepth_ {maxDepth}
+{}
+
+BotMove SearchBot::play(const Model& model){
+    STRATEGO_ALLOC_SUBSYSTEM(BOT);
+    GameClock::Duration budget {Bot::budget(model)};
+    SearchEngine::Clock::time_point deadline {budget == GameClock::Duration::max() ?
+                                              SearchEngine::Clock::time_point::max() :
+                                              SearchEngine::Clock::now() + budget};
+    std::vector<BotMove> moves {legalMoves(model)};
+    if(moves.empty())
+        throw std::logic_error("The current player cannot move");
+
+    std::atomic<bool> stop {false};
+    SearchEngine engine {stop, deadline};
+    std::optional<Hint> hint {engine.search(SearchEngine::position(model.observation(model.currentPlayer().color())),
+                                            maxDepth_, {}, &moves)};
+    if(hint)
+        return {hint -> start, hint -> end};
+
+    // temps épuisé avant la fin de la première profondeur
+    return moves.front();
+}
+
+std::string SearchBot::name() const{
+    return "search";
+}
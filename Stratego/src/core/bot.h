@@ -0,0 +1,164 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include "model.h"
+
+namespace stratego{
+
+    /**
+     * Issue d'une partie de jeu jouée entre deux bots.
+     */
+    enum class GameOutcome : char{
+        RED_WIN,
+        BLUE_WIN,
+        DRAW
+    };
+
+    /**
+     * Coup joué par un joueur: déplacement ou attaque d'un pion de la position de départ
+     * vers la position d'arrivée.
+     */
+    struct BotMove{
+        model::Position start;
+        model::Position end;
+    };
+
+    /**
+     * Joueur automatique. Un bot choisit le coup du joueur courant d'un modèle de jeu se trouvant
+     * dans l'état PLAYER_TURN.
+     */
+    class Bot{
+
+        public:
+
+            /**
+             * Nombre de coups restant à jouer estimé par la gestion du temps (cf. budget()).
+             */
+            static constexpr int MOVES_TO_GO = 40;
+
+            /**
+             * Annonce au bot le début d'une partie. Ne fait rien par défaut.
+             *
+             * @param layout la disposition de l'armée du bot
+             * @param color la couleur jouée par le bot
+             */
+            virtual void start([[maybe_unused]] const model::Layout& layout, [[maybe_unused]] model::Color color){}
+
+            /**
+             * Annonce au bot la fin d'une partie. Ne fait rien par défaut.
+             *
+             * @param outcome l'issue de la partie
+             */
+            virtual void finish([[maybe_unused]] GameOutcome outcome){}
+
+            /**
+             * Choisit le coup à jouer par le joueur courant.
+             *
+             * @throw std::logic_error si le joueur courant ne peut jouer aucun coup
+             *
+             * @param model le modèle de jeu
+             * @return le coup à jouer.
+             */
+            virtual BotMove play(const Model& model) = 0;
+
+            /**
+             * Récupère le nom du bot.
+             *
+             * @return le nom du bot.
+             */
+            virtual std::string name() const = 0;
+
+            /**
+             * Destructeur virtuel de Bot.
+             */
+            virtual ~Bot(){}
+
+            /**
+             * Récupère l'ensemble des coups légaux du joueur courant.
+             *
+             * @param model le modèle de jeu
+             * @return les coups légaux du joueur courant.
+             */
+            static std::vector<BotMove> legalMoves(const Model& model);
+
+            /**
+             * Calcule le temps de réflexion dont dispose le joueur courant pour son coup: son temps
+             * restant réparti sur MOVES_TO_GO coups, augmenté de l'essentiel de son incrément, sans
+             * jamais dépasser la moitié de son temps restant.
+             *
+             * @param model le modèle de jeu
+             * @return le temps de réflexion, model::GameClock::Duration::max() si la partie n'est pas
+             * chronométrée.
+             */
+            static model::GameClock::Duration budget(const Model& model);
+
+            /**
+             * Crée un bot depuis son nom.
+             *
+             * @throw std::invalid_argument si aucun bot ne porte le nom donné
+             *
+             * @param name le nom du bot ("random", "search", "engine:<commande>" pour un moteur
+             * externe, cf. EngineBot, ou "plugin:<chemin>" pour un plugin, cf. PluginBot)
+             * @param seed la graine du bot
+             * @return le bot créé.
+             */
+            static std::unique_ptr<Bot> create(std::string_view name, std::uint64_t seed);
+    };
+
+    /**
+     * Bot jouant un coup légal tiré uniformément au hasard.
+     */
+    class RandomBot : public Bot{
+
+        std::mt19937_64 gen_;
+
+        public:
+
+            /**
+             * Construit un bot aléatoire.
+             *
+             * @param seed la graine du bot
+             */
+            explicit RandomBot(std::uint64_t seed) noexcept;
+
+
+            // --- Déjà documenté ---
+            BotMove play(const Model& model) override;
+            std::string name() const override;
+    };
+
+    /**
+     * Bot jouant le coup suggéré par le moteur de recherche (cf. SearchEngine) depuis l'observation
+     * du joueur courant. La recherche s'arrête à la profondeur maximale ou à l'épuisement du temps de
+     * réflexion du joueur (cf. Bot::budget()).
+     */
+    class SearchBot : public Bot{
+
+        int maxDepth_;
+
+        public:
+
+            /**
+             * Profondeur de recherche maximale par défaut (en demi-coups).
+             */
+            static constexpr int MAX_DEPTH = 4;
+
+            /**
+             * Construit un bot de recherche.
+             *
+             * @param maxDepth la profondeur de recherche maximale (en demi-coups)
+             */
+            explicit SearchBot(int maxDepth = MAX_DEPTH) noexcept;
+
+
+            // --- Déjà documenté ---
+            BotMove play(const Model& model) override;
+            std::string name() const override;
+    };
+}
+
+#endif // BOT_H
@@ -0,0 +1,118 @@
+#ifndef BOTPLUGIN_H
+#define BOTPLUGIN_H
+
+/*========================================
+* Interface binaire (C) des bots chargés
+* dynamiquement (cf. PluginBot)
+*=========================================
+*/
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Version de l'interface binaire. Elle est incrémentée à chaque modification incompatible des
+ * structures ou des fonctions ci-dessous: un plugin compilé pour une autre version est refusé.
+ */
+#define STRATEGO_PLUGIN_ABI 1
+
+/**
+ * Nom du point d'entrée exporté par un plugin, de type StrategoPluginEntry.
+ */
+#define STRATEGO_PLUGIN_ENTRY "strategoBotPlugin"
+
+/**
+ * Nombre de cases du plateau de jeu, murs compris. Une case est indexée (y * 12 + x), x et y
+ * allant de 1 à 10 pour les cases jouables.
+ */
+#define STRATEGO_SQUARES 144
+
+/**
+ * Nombre de rangs de pions (0: drapeau, 1: espion, ..., 10: maréchal, 11: bombe).
+ */
+#define STRATEGO_RANKS 12
+
+/**
+ * Nombre de pions d'une armée.
+ */
+#define STRATEGO_ARMY_SIZE 40
+
+/**
+ * Couleurs des joueurs.
+ */
+enum { STRATEGO_RED = 0, STRATEGO_BLUE = 1 };
+
+/**
+ * Issues d'une partie, du point de vue du bot.
+ */
+enum { STRATEGO_LOSS = -1, STRATEGO_DRAW = 0, STRATEGO_WIN = 1 };
+
+/**
+ * Indicateurs d'une case de l'observation.
+ */
+enum { STRATEGO_OWN = 1, STRATEGO_ENEMY = 2, STRATEGO_MOVED = 4, STRATEGO_REVEALED = 8 };
+
+/**
+ * Ce que le bot sait de la partie (cf. model::Observation).
+ */
+typedef struct StrategoObservation{
+    int32_t viewer;                                 /* couleur du bot */
+    int32_t plies;                                  /* nombre d'actions jouées */
+    int8_t ranks[STRATEGO_SQUARES];                 /* rang de chaque case, -1 si vide, -2 si inconnu */
+    uint8_t flags[STRATEGO_SQUARES];                /* combinaison d'indicateurs de chaque case */
+    uint8_t captured[2][STRATEGO_RANKS];            /* pions capturés par couleur puis par rang */
+    uint8_t lastFrom;                               /* dernière action observée (0 si aucune) */
+    uint8_t lastTo;
+} StrategoObservation;
+
+/**
+ * Coup d'un pion entre deux cases.
+ */
+typedef struct StrategoMove{
+    uint8_t from;
+    uint8_t to;
+} StrategoMove;
+
+/**
+ * Fonctions d'un plugin. Les fonctions facultatives peuvent être nulles. Une instance de bot n'est
+ * jamais utilisée par deux threads à la fois, mais plusieurs instances peuvent l'être simultanément.
+ */
+typedef struct StrategoBotApi{
+
+    /* STRATEGO_PLUGIN_ABI */
+    uint32_t abiVersion;
+
+    /* nom du bot */
+    const char* name;
+
+    /* crée une instance du bot depuis une graine */
+    void* (*create)(uint64_t seed);
+
+    /* détruit une instance du bot */
+    void (*destroy)(void* bot);
+
+    /* facultatif: début d'une partie, couleur et disposition (du fond du camp vers le centre,
+     * de la colonne A à la colonne J) du bot */
+    void (*setup)(void* bot, int32_t color, const int8_t layout[STRATEGO_ARMY_SIZE]);
+
+    /* choisit un coup parmi les coups légaux donnés, le temps de réflexion étant donné en
+     * microsecondes (-1 si la partie n'est pas chronométrée); retourne l'indice du coup choisi */
+    int32_t (*play)(void* bot, const StrategoObservation* obs, const StrategoMove* moves, int32_t count, int64_t budget);
+
+    /* facultatif: fin de la partie (STRATEGO_WIN, STRATEGO_DRAW ou STRATEGO_LOSS) */
+    void (*result)(void* bot, int32_t outcome);
+} StrategoBotApi;
+
+/**
+ * Point d'entrée d'un plugin: retourne ses fonctions, valides jusqu'au déchargement du plugin.
+ */
+typedef const StrategoBotApi* (*StrategoPluginEntry)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BOTPLUGIN_H
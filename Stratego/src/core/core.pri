@@ -3,5 +3,8 @@ INCLUDEPATH += $${PWD}/
 
 LIBRARY_OUT_PWD = $$clean_path($$OUT_PWD/$$relative_path($$PWD, $$_PRO_FILE_PWD_))
 
-LIBS += -L$${LIBRARY_OUT_PWD} -l$${LIB_TARGET}
+LIBS += -L$${LIBRARY_OUT_PWD} -l$${LIB_TARGET} -pthread
+
+# chargement des plugins de bots (cf. PluginBot)
+linux: LIBS += -ldl
 PRE_TARGETDEPS += $${LIBRARY_OUT_PWD}/lib$${LIB_TARGET}.a
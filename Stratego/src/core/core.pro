@@ -7,28 +7,68 @@ include(../../config.pri)
 CONFIG += $${LIB_MODE}
 
 HEADERS += \
+    allocTracker.h \
+    arena.h \
+    beliefTracker.h \
+    boardSnapshot.h \
+    bot.h \
+    botPlugin.h \
     config.h \
     designpatt.h \
+    engineBot.h \
+    eventLoop.h \
     eventMgr.h \
+    gameServer.h \
+    gameClock.h \
     gamestuff.h \
+    hintService.h \
     piece.h \
     model.h \
+    observation.h \
+    moveGen.h \
+    perf.h \
+    pluginBot.h \
     pieceFactory.h \
     properties.h \
-    util.h
+    searchEngine.h \
+    setupGen.h \
+    setupStore.h \
+    tournament.h \
+    trace.h \
+    util.h \
+    variant.h
 
 SOURCES += \
+        allocTracker.cpp \
+        arena.cpp \
+        beliefTracker.cpp \
+        boardSnapshot.cpp \
+        bot.cpp \
         board.cpp \
         config.cpp \
+        engineBot.cpp \
+        gameClock.cpp \
+        gameServer.cpp \
         game_struct.cpp \
+        hintService.cpp \
         history.cpp \
         model.cpp \
+        observation.cpp \
+        moveGen.cpp \
         parser.cpp \
+        perf.cpp \
         piece.cpp \
+        eventLoop.cpp \
         eventMgr.cpp \
         pieceFactory.cpp \
         player.cpp \
-        properties.cpp
+        pluginBot.cpp \
+        properties.cpp \
+        searchEngine.cpp \
+        setupGen.cpp \
+        setupStore.cpp \
+        tournament.cpp \
+        trace.cpp
 
 DISTFILES += \
     core.pri
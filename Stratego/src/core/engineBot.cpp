@@ -0,0 +1,347 @@
+#if defined __unix__ || defined __APPLE__
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <sys/socket.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+#include <cctype>
+#include <cerrno>
+#include <sstream>
+#include <thread>
+
+#include "allocTracker.h"
+#include "engineBot.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+#ifdef MSG_NOSIGNAL
+    constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+    constexpr int SEND_FLAGS = 0;
+#endif
+
+    std::string colorName(Color color){
+        return color == Color::RED ? "red" : "blue";
+    }
+
+    long long millis(GameClock::Duration duration){
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::max(duration, GameClock::Duration::zero())).count();
+    }
+
+    Position squareToPosition(int square) noexcept{
+        return {square % Config::BOARD_SIZE, square / Config::BOARD_SIZE};
+    }
+}
+
+/* ===== Protocole ===== */
+
+std::string EngineBot::formatMove(const BotMove& move){
+    return std::string{move.start} + std::string{move.end};
+}
+
+bool EngineBot::parseMove(std::string_view str, BotMove& move) noexcept{
+    size_t letter {};
+    while(letter < str.size() && std::isdigit(static_cast<unsigned char>(str[letter])))
+        letter++;
+
+    return letter < str.size() && Position::tryFrom(str.substr(0, letter + 1), move.start)
+           && Position::tryFrom(str.substr(letter + 1), move.end);
+}
+
+std::string EngineBot::formatPosition(const Observation& obs, const std::vector<BotMove>& moves){
+    std::string line {"position " + obs.encode() + " captured"};
+    for(const auto& captured : obs.captured){
+        line += ' ';
+        for(std::uint8_t count : captured)
+            line += static_cast<char>('0' + count);
+    }
+
+    line += " moves";
+    for(const BotMove& move : moves)
+        line += ' ' + formatMove(move);
+
+    return line;
+}
+
+bool EngineBot::parsePosition(std::string_view line, Color viewer, Observation& obs, std::vector<BotMove>& moves){
+    std::istringstream stream {std::string{line}};
+    std::string command, cases, keyword;
+    std::array<std::string, Config::PLAYER_COUNT> captured {};
+    if(!(stream >> command >> cases >> keyword >> captured[0] >> captured[1]) || command != "position" || keyword != "captured")
+        return false;
+
+    Observation result {};
+    if(!Observation::decode(cases, viewer, result))
+        return false;
+
+    for(int color = 0; color < Config::PLAYER_COUNT; color++){
+        if(captured[color].size() != result.captured[color].size())
+            return false;
+
+        for(size_t rank = 0; rank < captured[color].size(); rank++){
+            if(!std::isdigit(static_cast<unsigned char>(captured[color][rank])))
+                return false;
+
+            result.captured[color][rank] = static_cast<std::uint8_t>(captured[color][rank] - '0');
+        }
+    }
+
+    std::vector<BotMove> played {};
+    std::string word;
+    if(stream >> keyword && keyword != "moves")
+        return false;
+    while(stream >> word){
+        BotMove move {};
+        if(!parseMove(word, move))
+            return false;
+
+        played.push_back(move);
+    }
+
+    result.plies = static_cast<int>(played.size());
+    if(!played.empty()){
+        result.lastFrom = static_cast<std::uint8_t>(Observation::toSquare(played.back().start));
+        result.lastTo = static_cast<std::uint8_t>(Observation::toSquare(played.back().end));
+    }
+
+    obs = result;
+    moves = std::move(played);
+    return true;
+}
+
+/* ===== Processus du moteur ===== */
+
+#if defined __unix__ || defined __APPLE__
+
+EngineBot::EngineBot(const std::string& command, std::chrono::milliseconds timeout) :
+    fd_ {-1},
+    pid_ {-1},
+    input_ {},
+    name_ {command},
+    color_ {},
+    moves_ {},
+    pending_ {}
+{
+    // une paire de sockets plutôt que deux tubes: un moteur terminé ne peut tuer l'arbitre par SIGPIPE
+    // les deux extrémités sont fermées à l'exec: les autres moteurs lancés ne doivent pas en hériter
+    int fds[2];
+#ifdef SOCK_CLOEXEC
+    if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) == -1)
+        throw std::runtime_error("Cannot create the engine channel");
+#else
+    if(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == -1)
+        throw std::runtime_error("Cannot create the engine channel");
+
+    for(int fd : fds)
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+#endif
+
+    if((pid_ = fork()) == -1){
+        ::close(fds[0]);
+        ::close(fds[1]);
+        throw std::runtime_error("Cannot start the engine " + command);
+    }
+    if(pid_ == 0){ // seules des fonctions async-signal-safe sont permises avant exec
+        fcntl(fds[1], F_SETFD, 0); // dup2() sur lui-même conserverait FD_CLOEXEC
+        dup2(fds[1], STDIN_FILENO);
+        dup2(fds[1], STDOUT_FILENO);
+        if(fds[1] != STDIN_FILENO && fds[1] != STDOUT_FILENO)
+            ::close(fds[1]);
+
+        execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+        _exit(127);
+    }
+
+    ::close(fds[1]);
+    fd_ = fds[0];
+    try{
+        send("sep");
+        Clock::time_point deadline {Clock::now() + timeout};
+        std::string line;
+        while((line = receive(deadline)) != "sepok"){
+            if(line.rfind("id name ", 0) == 0)
+                name_ = line.substr(8);
+        }
+    } catch(...){
+        terminate(); // le destructeur n'est pas appelé si le constructeur échoue
+        throw;
+    }
+}
+
+EngineBot::~EngineBot(){
+    terminate();
+}
+
+void EngineBot::terminate() noexcept{
+    if(fd_ != -1){
+        constexpr std::string_view quit {"quit\n"};
+        [[maybe_unused]] ssize_t written {::send(fd_, quit.data(), quit.size(), SEND_FLAGS)};
+        ::close(fd_);
+        fd_ = -1;
+    }
+    if(pid_ > 0){
+        auto deadline {Clock::now() + std::chrono::seconds{1}};
+        while(waitpid(pid_, nullptr, WNOHANG) == 0){
+            if(Clock::now() >= deadline){
+                kill(pid_, SIGKILL);
+                waitpid(pid_, nullptr, 0);
+                break;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        }
+
+        pid_ = -1;
+    }
+}
+
+void EngineBot::send(const std::string& line){
+    std::string data {line + '\n'};
+    size_t sent {};
+    while(sent < data.size()){
+        ssize_t count {::send(fd_, data.data() + sent, data.size() - sent, SEND_FLAGS)};
+        if(count < 0 && errno == EINTR)
+            continue;
+        if(count < 0)
+            throw std::runtime_error("The engine " + name_ + " has terminated");
+
+        sent += count;
+    }
+}
+
+std::string EngineBot::receive(Clock::time_point deadline){
+    size_t end;
+    while((end = input_.find('\n')) == std::string::npos){
+        int timeout {-1};
+        if(deadline != Clock::time_point::max()){
+            auto left {std::chrono::ceil<std::chrono::milliseconds>(deadline - Clock::now())};
+            if(left.count() <= 0)
+                throw std::runtime_error("The engine " + name_ + " did not answer in time");
+
+            timeout = static_cast<int>(std::min<long long>(left.count(), 60000));
+        }
+
+        pollfd pfd {fd_, POLLIN, 0};
+        int ready {poll(&pfd, 1, timeout)};
+        if(ready < 0 && errno != EINTR)
+            throw std::runtime_error("Cannot read from the engine " + name_);
+        if(ready <= 0)
+            continue;
+
+        char buffer[4096];
+        ssize_t count {::read(fd_, buffer, sizeof buffer)};
+        if(count < 0 && errno == EINTR)
+            continue;
+        if(count <= 0)
+            throw std::runtime_error("The engine " + name_ + " has terminated");
+
+        input_.append(buffer, count);
+    }
+
+    std::string line {input_.substr(0, end)};
+    input_.erase(0, end + 1);
+    if(!line.empty() && line.back() == '\r')
+        line.pop_back();
+
+    return line;
+}
+
+#else
+
+EngineBot::EngineBot(const std::string& command, std::chrono::milliseconds) :
+    fd_ {-1},
+    pid_ {-1},
+    input_ {},
+    name_ {command},
+    color_ {},
+    moves_ {},
+    pending_ {}
+{
+    throw std::runtime_error("External engines are not supported on this platform");
+}
+
+EngineBot::~EngineBot(){}
+
+void EngineBot::terminate() noexcept{}
+
+void EngineBot::send(const std::string&){}
+
+std::string EngineBot::receive(Clock::time_point){
+    return {};
+}
+
+#endif
+
+/* ===== Parties ===== */
+
+void EngineBot::newGame(Color color){
+    color_ = color;
+    moves_.clear();
+    pending_.reset();
+    send("newgame " + colorName(color));
+}
+
+void EngineBot::start(const Layout& layout, Color color){
+    newGame(color);
+    std::string line {"setup "};
+    for(int rank : layout)
+        line += Observation::RANK_SYMBOLS[rank];
+
+    send(line);
+}
+
+BotMove EngineBot::play(const Model& model){
+    STRATEGO_ALLOC_SUBSYSTEM(BOT);
+    Color color {model.currentPlayer().color()};
+    const Observation& obs {model.observation(color)};
+    size_t known {moves_.size() + (pending_ ? 1 : 0)};
+    if(color_ != color || static_cast<size_t>(obs.plies) < known)
+        newGame(color);
+
+    // les actions jouées depuis le dernier coup du moteur: le sien puis celle de l'adversaire
+    if(pending_ && moves_.size() < static_cast<size_t>(obs.plies))
+        moves_.push_back(*pending_);
+    pending_.reset();
+    if(moves_.size() < static_cast<size_t>(obs.plies))
+        moves_.push_back({squareToPosition(obs.lastFrom), squareToPosition(obs.lastTo)});
+
+    send(formatPosition(obs, moves_));
+
+    const auto& players {model.players()};
+    GameClock::Duration remaining {model.currentPlayer().clock().remaining()};
+    std::string go {"go"};
+    if(remaining != GameClock::Duration::max()){
+        go += " rtime " + std::to_string(millis(players[0] -> clock().remaining()))
+            + " btime " + std::to_string(millis(players[1] -> clock().remaining()))
+            + " rinc " + std::to_string(millis(players[0] -> clock().control().increment))
+            + " binc " + std::to_string(millis(players[1] -> clock().control().increment))
+            + " movetime " + std::to_string(millis(budget(model)));
+    }
+
+    go += " searchmoves";
+    for(const BotMove& move : legalMoves(model))
+        go += ' ' + formatMove(move);
+
+    send(go);
+    Clock::time_point deadline {remaining == GameClock::Duration::max() ? Clock::time_point::max()
+                                                                        : Clock::now() + std::max(remaining, GameClock::Duration::zero()) + GRACE};
+    std::string line;
+    while((line = receive(deadline)).rfind("bestmove ", 0) != 0){}
+
+    BotMove move {};
+    if(!parseMove(line.substr(9), move))
+        throw std::runtime_error("The engine " + name_ + " sent an unreadable move: " + line);
+
+    pending_ = move;
+    return move;
+}
+
+std::string EngineBot::name() const{
+    return name_;
+}
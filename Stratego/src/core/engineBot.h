@@ -0,0 +1,188 @@
+#ifndef ENGINEBOT_H
+#define ENGINEBOT_H
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bot.h"
+
+/*========================================
+* Moteurs externes (processus fils)
+*=========================================
+*/
+
+namespace stratego{
+
+    /**
+     * Joueur automatique délégant le choix de ses coups à un moteur externe: un programme
+     * indépendant, exécuté dans un processus fils, avec lequel le bot dialogue sur son entrée et sa
+     * sortie standard. Le modèle de jeu reste l'arbitre de la partie: le coup renvoyé par le moteur
+     * est validé par le modèle comme celui de tout autre bot (cf. Arena).
+     *
+     * Le protocole, inspiré d'UCI, est textuel, une commande par ligne. Commandes envoyées au moteur:
+     *  - sep: le moteur se présente (id name <nom>, facultatif) puis répond sepok;
+     *  - newgame <red|blue>: une nouvelle partie commence, le moteur joue la couleur donnée;
+     *  - setup <pions>: la disposition de l'armée du moteur, un symbole de
+     *    model::Observation::RANK_SYMBOLS par pion, de la dernière ligne de son camp vers le centre
+     *    du plateau et de la colonne A à la colonne J (cf. model::Layout);
+     *  - position <cases> captured <rouge> <bleu> moves <coup>...: ce que le moteur sait de la partie,
+     *    les cases du plateau (cf. model::Observation::encode()), le nombre de pions capturés de
+     *    chaque couleur par rang (un chiffre par rang) puis les actions jouées depuis le début de la
+     *    partie (positions de départ et d'arrivée accolées, 7E6E);
+     *  - go [rtime <ms> btime <ms> rinc <ms> binc <ms> movetime <ms>] searchmoves <coup>...: le moteur
+     *    choisit son coup parmi les coups légaux donnés (la limite des allers-retours d'un pion ne se
+     *    déduit pas de la position). Le temps restant et l'incrément de chaque joueur ainsi que le
+     *    temps de réflexion conseillé (cf. Bot::budget()) ne sont donnés que si la partie est
+     *    chronométrée. Le moteur répond bestmove <coup>;
+     *  - quit: le moteur doit se terminer.
+     * Le moteur peut envoyer des lignes supplémentaires (info ...), qui sont ignorées.
+     *
+     * Disponible sous linux et apple uniquement.
+     */
+    class EngineBot : public Bot{
+
+        public:
+
+            /**
+             * Horloge monotone mesurant les délais de réponse du moteur.
+             */
+            using Clock = std::chrono::steady_clock;
+
+        private:
+
+            int fd_;
+            int pid_;
+            std::string input_;
+            std::string name_;
+            std::optional<model::Color> color_;
+            std::vector<BotMove> moves_;
+            std::optional<BotMove> pending_;
+
+        public:
+
+            /**
+             * Délai par défaut accordé au moteur pour se présenter.
+             */
+            static constexpr std::chrono::milliseconds HANDSHAKE_TIMEOUT {5000};
+
+            /**
+             * Délai accordé au moteur, au-delà de son temps restant, pour répondre bestmove (latence
+             * du processus fils).
+             */
+            static constexpr std::chrono::milliseconds GRACE {200};
+
+            /**
+             * Démarre un moteur externe et attend qu'il se présente.
+             *
+             * @throw std::runtime_error si le moteur ne peut être démarré ou ne répond pas sepok à temps
+             *
+             * @param command la ligne de commande du moteur, exécutée par /bin/sh
+             * @param timeout le délai accordé au moteur pour se présenter
+             */
+            explicit EngineBot(const std::string& command, std::chrono::milliseconds timeout = HANDSHAKE_TIMEOUT);
+
+            EngineBot(const EngineBot&) = delete;
+
+            EngineBot& operator=(const EngineBot&) = delete;
+
+            /**
+             * Annonce une nouvelle partie au moteur (newgame puis setup).
+             *
+             * @throw std::runtime_error si le moteur s'est terminé
+             *
+             * @param layout la disposition de l'armée du moteur
+             * @param color la couleur jouée par le moteur
+             */
+            void start(const model::Layout& layout, model::Color color) override;
+
+            /**
+             * Envoie au moteur ce que le joueur courant sait de la partie et attend son coup. Une
+             * nouvelle partie non annoncée par start() est détectée et annoncée (sans disposition).
+             *
+             * @throw std::runtime_error si le moteur s'est terminé, ne répond pas avant l'écoulement du
+             * temps du joueur ou répond un coup illisible
+             *
+             * @param model le modèle de jeu
+             * @return le coup choisi par le moteur.
+             */
+            BotMove play(const Model& model) override;
+
+            /**
+             * Récupère le nom du moteur (annoncé par id name, ou sa ligne de commande).
+             *
+             * @return le nom du moteur.
+             */
+            std::string name() const override;
+
+            /**
+             * Destructeur de EngineBot. Termine le moteur.
+             */
+            ~EngineBot();
+
+            /**
+             * Représente un coup dans le protocole (positions de départ et d'arrivée accolées, 7E6E).
+             *
+             * @param move le coup à représenter
+             * @return la représentation du coup.
+             */
+            static std::string formatMove(const BotMove& move);
+
+            /**
+             * Lit un coup représenté dans le protocole (cf. formatMove()).
+             *
+             * @param str la représentation du coup
+             * @param move le coup lu
+             * @return true si la représentation est valide, false si non.
+             */
+            static bool parseMove(std::string_view str, BotMove& move) noexcept;
+
+            /**
+             * Construit la commande position décrivant l'observation et les actions données.
+             *
+             * @param obs l'observation du moteur
+             * @param moves les actions jouées depuis le début de la partie
+             * @return la commande position.
+             */
+            static std::string formatPosition(const model::Observation& obs, const std::vector<BotMove>& moves);
+
+            /**
+             * Lit une commande position (cf. formatPosition()). Le nombre d'actions observées et la
+             * dernière action de l'observation sont déduits des actions lues.
+             *
+             * @param line la commande position
+             * @param viewer la couleur jouée par le moteur
+             * @param obs l'observation lue
+             * @param moves les actions lues
+             * @return true si la commande est valide, false si non.
+             */
+            static bool parsePosition(std::string_view line, model::Color viewer, model::Observation& obs, std::vector<BotMove>& moves);
+
+        private:
+
+            /*
+             * Envoie une ligne au moteur.
+             */
+            void send(const std::string& line);
+
+            /*
+             * Attend la prochaine ligne du moteur jusqu'à l'échéance donnée.
+             */
+            std::string receive(Clock::time_point deadline);
+
+            /*
+             * Demande au moteur de se terminer, le tue s'il ne s'est pas terminé après une seconde et
+             * ferme le canal de communication.
+             */
+            void terminate() noexcept;
+
+            /*
+             * Annonce une nouvelle partie de la couleur donnée et oublie les actions de la précédente.
+             */
+            void newGame(model::Color color);
+    };
+}
+
+#endif // ENGINEBOT_H
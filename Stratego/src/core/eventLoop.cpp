@@ -0,0 +1,288 @@
+#if defined __unix__ || defined __APPLE__
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <unistd.h>
+#endif
+#ifdef __linux__
+    #include <sys/epoll.h>
+#endif
+
+#include <array>
+#include <cerrno>
+#include <stdexcept>
+
+#include "eventLoop.h"
+
+using namespace stratego;
+
+#if defined __unix__ || defined __APPLE__
+
+EventLoop::EventLoop() :
+    watches_ {},
+    alwaysReady_ {},
+    timers_ {},
+    deadlines_ {},
+    lastTimer_ {},
+    postedMutex_ {},
+    posted_ {},
+    quit_ {},
+    wakeRead_ {-1},
+    wakeWrite_ {-1}
+#ifdef __linux__
+    , epoll_ {-1}
+#endif
+{
+    int fds[2];
+    if(pipe(fds) == -1)
+        throw std::runtime_error("Cannot create the event loop wake-up pipe");
+
+    wakeRead_ = fds[0];
+    wakeWrite_ = fds[1];
+    for(int fd : fds){
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+
+#ifdef __linux__
+    epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.fd = wakeRead_;
+    if((epoll_ = epoll_create1(EPOLL_CLOEXEC)) == -1 || epoll_ctl(epoll_, EPOLL_CTL_ADD, wakeRead_, &event) == -1){
+        close(wakeRead_);
+        close(wakeWrite_);
+        if(epoll_ != -1)
+            close(epoll_);
+
+        throw std::runtime_error("Cannot create the event loop epoll instance");
+    }
+#endif
+}
+
+/* ===== Sources d'évènements ===== */
+
+void EventLoop::watch(int fd, Task onReadable){
+    bool added {watches_.count(fd) == 0};
+    watches_[fd].readable = std::move(onReadable);
+    rearm(fd, added);
+}
+
+void EventLoop::watchWritable(int fd, Task onWritable){
+    bool added {watches_.count(fd) == 0};
+    watches_[fd].writable = std::move(onWritable);
+    rearm(fd, added);
+}
+
+void EventLoop::unwatchWritable(int fd) noexcept{
+    auto it {watches_.find(fd)};
+    if(it == watches_.end() || !it -> second.writable)
+        return;
+
+    if(!it -> second.readable){
+        unwatch(fd);
+    } else{
+        it -> second.writable = nullptr;
+        rearm(fd, false);
+    }
+}
+
+void EventLoop::unwatch(int fd) noexcept{
+    if(!watches_.erase(fd))
+        return;
+
+    alwaysReady_.erase(fd);
+#ifdef __linux__
+    epoll_ctl(epoll_, EPOLL_CTL_DEL, fd, nullptr); // échoue sans conséquence si fd est déjà fermé
+#endif
+}
+
+void EventLoop::rearm(int fd, bool added) noexcept{
+#ifdef __linux__
+    Watch& watch {watches_[fd]};
+    epoll_event event {};
+    event.events = 0;
+    if(watch.readable)
+        event.events |= EPOLLIN;
+    if(watch.writable)
+        event.events |= EPOLLOUT;
+    event.data.fd = fd;
+    if(epoll_ctl(epoll_, added ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, fd, &event) == -1 && errno == EPERM)
+        alwaysReady_.insert(fd); // fichier ordinaire (entrée redirigée): toujours prêt, comme sous poll(2)
+#else
+    (void) fd;
+    (void) added;
+#endif
+}
+
+std::uint64_t EventLoop::schedule(Clock::duration delay, Task task, Clock::duration period){
+    lastTimer_++;
+    Deadlines::iterator due {deadlines_.emplace(Clock::now() + delay, lastTimer_)};
+    timers_.emplace(lastTimer_, Timer{due, period, std::move(task)});
+    return lastTimer_;
+}
+
+void EventLoop::cancel(std::uint64_t timer) noexcept{
+    auto it {timers_.find(timer)};
+    if(it == timers_.end())
+        return;
+
+    if(it -> second.due != deadlines_.end())
+        deadlines_.erase(it -> second.due);
+    timers_.erase(it);
+}
+
+void EventLoop::post(Task task){
+    {
+        std::lock_guard<std::mutex> lock {postedMutex_};
+        posted_.push_back(std::move(task));
+    }
+
+    char byte {};
+    [[maybe_unused]] ssize_t written {write(wakeWrite_, &byte, 1)}; // canal plein: la boucle est déjà réveillée
+}
+
+/* ===== Exécution ===== */
+
+int EventLoop::runOnce(Clock::duration timeout){
+    int executed {};
+#ifdef __linux__
+    std::vector<int> alwaysReady {alwaysReady_.begin(), alwaysReady_.end()}; // une tâche peut modifier l'ensemble
+
+    std::array<epoll_event, 256> events;
+    int ready {epoll_wait(epoll_, events.data(), events.size(), alwaysReady.empty() ? pollTimeout(timeout) : 0)};
+    for(int i = 0; i < ready; i++){
+        int fd {events[i].data.fd};
+        std::uint32_t revents {events[i].events};
+        if(fd == wakeRead_){
+            char buffer[64];
+            while(read(wakeRead_, buffer, sizeof buffer) > 0);
+            continue;
+        }
+
+        executed += dispatch(fd, revents & (EPOLLIN | EPOLLHUP | EPOLLERR), revents & (EPOLLOUT | EPOLLHUP | EPOLLERR));
+    }
+
+    for(int fd : alwaysReady)
+        executed += dispatch(fd, true, true);
+#else
+    std::vector<pollfd> fds {{wakeRead_, POLLIN, 0}};
+    for(const auto& [fd, watch] : watches_)
+        fds.push_back({fd, static_cast<short>((watch.readable ? POLLIN : 0) | (watch.writable ? POLLOUT : 0)), 0});
+
+    int ready {poll(fds.data(), fds.size(), pollTimeout(timeout))};
+    if(ready > 0){
+        if(fds[0].revents){
+            char buffer[64];
+            while(read(wakeRead_, buffer, sizeof buffer) > 0);
+        }
+
+        for(size_t i = 1; i < fds.size(); i++){
+            short revents {fds[i].revents};
+            if(revents)
+                executed += dispatch(fds[i].fd, revents & (POLLIN | POLLHUP | POLLERR | POLLNVAL), revents & (POLLOUT | POLLHUP | POLLERR));
+        }
+    }
+#endif
+
+    executed += runPosted();
+    executed += fireTimers();
+    return executed;
+}
+
+void EventLoop::run(){
+    quit_ = false;
+    while(!quit_)
+        runOnce();
+}
+
+void EventLoop::quit(){
+    post([this]{ quit_ = true; });
+}
+
+int EventLoop::dispatch(int fd, bool readable, bool writable){
+    // une tâche peut modifier les descripteurs surveillés: le descripteur est recherché avant chaque exécution
+    int executed {};
+    auto it {watches_.find(fd)};
+    if(readable && it != watches_.end() && it -> second.readable){
+        Task task {it -> second.readable};
+        task();
+        executed++;
+        it = watches_.find(fd);
+    }
+
+    if(writable && it != watches_.end() && it -> second.writable){
+        Task task {it -> second.writable};
+        task();
+        executed++;
+    }
+
+    return executed;
+}
+
+int EventLoop::fireTimers(){
+    // une minuterie périodique est reprogrammée après le parcours: elle ne s'exécute qu'une fois par appel
+    std::vector<std::pair<Clock::time_point, std::uint64_t>> periodic {};
+    int executed {};
+    Clock::time_point now {Clock::now()};
+    while(!deadlines_.empty() && deadlines_.begin() -> first <= now){
+        auto [deadline, id] {*deadlines_.begin()};
+        deadlines_.erase(deadlines_.begin());
+
+        auto it {timers_.find(id)};
+        Task task {it -> second.task};
+        if(it -> second.period > Clock::duration::zero()){
+            it -> second.due = deadlines_.end();
+            periodic.emplace_back(deadline + it -> second.period, id);
+        } else{
+            timers_.erase(it);
+        }
+
+        task(); // la tâche a pu ajouter ou annuler des minuteries
+        executed++;
+    }
+
+    for(const auto& [deadline, id] : periodic){
+        auto it {timers_.find(id)};
+        if(it != timers_.end())
+            it -> second.due = deadlines_.emplace(deadline, id);
+    }
+
+    return executed;
+}
+
+int EventLoop::runPosted(){
+    std::vector<Task> tasks {};
+    {
+        std::lock_guard<std::mutex> lock {postedMutex_};
+        tasks.swap(posted_);
+    }
+
+    for(Task& task : tasks)
+        task();
+
+    return static_cast<int>(tasks.size());
+}
+
+int EventLoop::pollTimeout(Clock::duration timeout) const noexcept{
+    Clock::duration wait {timeout};
+    if(!deadlines_.empty()){
+        Clock::duration remaining {std::max(deadlines_.begin() -> first - Clock::now(), Clock::duration::zero())};
+        if(wait < Clock::duration::zero() || remaining < wait)
+            wait = remaining;
+    }
+
+    if(wait < Clock::duration::zero())
+        return -1;
+
+    // arrondi supérieur: une minuterie n'est jamais réveillée avant son échéance
+    return static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(wait).count());
+}
+
+EventLoop::~EventLoop(){
+    close(wakeRead_);
+    close(wakeWrite_);
+#ifdef __linux__
+    close(epoll_);
+#endif
+}
+
+#endif
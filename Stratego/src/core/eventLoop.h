@@ -0,0 +1,207 @@
+#ifndef EVENTLOOP_H
+#define EVENTLOOP_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+/*========================================
+* Boucle d'évènements mono-thread
+* (descripteurs, minuteries, tâches postées)
+*=========================================
+*/
+
+namespace stratego{
+
+    /**
+     * Boucle d'évènements multiplexant, dans un unique thread, la lecture et l'écriture de
+     * descripteurs de fichier (clavier, sockets), des minuteries et des tâches postées depuis
+     * d'autres threads (résultats d'un moteur de recherche par exemple). La boucle dort tant qu'aucun
+     * évènement n'est prêt: aucune attente active ni thread bloqué en lecture.
+     *
+     * Sous linux, la boucle repose sur epoll(7): le coût d'une attente ne dépend que du nombre de
+     * descripteurs prêts, ce qui permet de surveiller des milliers de sockets. Ailleurs, poll(2)
+     * est utilisé.
+     *
+     * Toutes les méthodes, sauf post() et quit(), doivent être appelées depuis le thread exécutant la
+     * boucle. Disponible sous linux et apple uniquement.
+     */
+    class EventLoop{
+
+        public:
+
+            /**
+             * Tâche exécutée par la boucle.
+             */
+            using Task = std::function<void()>;
+
+            /**
+             * Horloge des minuteries.
+             */
+            using Clock = std::chrono::steady_clock;
+
+        private:
+
+            // échéances des minuteries, de la plus proche à la plus lointaine
+            using Deadlines = std::multimap<Clock::time_point, std::uint64_t>;
+
+            struct Timer{
+                Deadlines::iterator due; // deadlines_.end() pendant l'exécution de la tâche
+                Clock::duration period;
+                Task task;
+            };
+
+            struct Watch{
+                Task readable;
+                Task writable;
+            };
+
+            std::map<int, Watch> watches_;
+            std::set<int> alwaysReady_;
+            std::map<std::uint64_t, Timer> timers_;
+            Deadlines deadlines_;
+            std::uint64_t lastTimer_;
+            std::mutex postedMutex_;
+            std::vector<Task> posted_;
+            bool quit_;
+            int wakeRead_;
+            int wakeWrite_;
+#ifdef __linux__
+            int epoll_;
+#endif
+
+        public:
+
+            /**
+             * Construit une boucle d'évènements vide.
+             *
+             * @throw std::runtime_error si le canal de réveil ou l'instance epoll de la boucle ne peut
+             * être créé
+             */
+            EventLoop();
+
+            EventLoop(const EventLoop&) = delete;
+
+            EventLoop& operator=(const EventLoop&) = delete;
+
+            /**
+             * Surveille le descripteur donné: la tâche donnée est exécutée chaque fois que des
+             * données peuvent y être lues (ou que le descripteur a été fermé). Remplace la tâche
+             * d'un descripteur déjà surveillé.
+             *
+             * @param fd le descripteur à surveiller
+             * @param onReadable la tâche à exécuter
+             */
+            void watch(int fd, Task onReadable);
+
+            /**
+             * Surveille l'écriture sur le descripteur donné: la tâche donnée est exécutée chaque fois
+             * que des données peuvent y être écrites sans bloquer. Remplace la tâche d'écriture d'un
+             * descripteur déjà surveillé.
+             *
+             * @param fd le descripteur à surveiller
+             * @param onWritable la tâche à exécuter
+             */
+            void watchWritable(int fd, Task onWritable);
+
+            /**
+             * Arrête de surveiller l'écriture sur le descripteur donné, sa lecture restant surveillée.
+             * Ne fait rien si l'écriture n'est pas surveillée.
+             *
+             * @param fd le descripteur
+             */
+            void unwatchWritable(int fd) noexcept;
+
+            /**
+             * Arrête de surveiller le descripteur donné (lecture et écriture). Ne fait rien s'il n'est
+             * pas surveillé. Doit être appelée avant la fermeture du descripteur.
+             *
+             * @param fd le descripteur
+             */
+            void unwatch(int fd) noexcept;
+
+            /**
+             * Programme l'exécution de la tâche donnée après le délai donné puis, si une période est
+             * donnée, à chaque période écoulée.
+             *
+             * @param delay le délai avant la première exécution
+             * @param task la tâche à exécuter
+             * @param period la période de répétition, nulle pour une exécution unique
+             * @return l'identifiant de la minuterie (cf. cancel()).
+             */
+            std::uint64_t schedule(Clock::duration delay, Task task, Clock::duration period = Clock::duration::zero());
+
+            /**
+             * Annule la minuterie donnée. Ne fait rien si elle a déjà expiré.
+             *
+             * @param timer l'identifiant de la minuterie
+             */
+            void cancel(std::uint64_t timer) noexcept;
+
+            /**
+             * Poste une tâche à exécuter par la boucle et réveille cette-dernière. Peut être appelée
+             * depuis n'importe quel thread.
+             *
+             * @param task la tâche à exécuter
+             */
+            void post(Task task);
+
+            /**
+             * Attend qu'au moins un évènement soit prêt, sans attendre plus longtemps que le délai
+             * donné, puis exécute les tâches correspondantes.
+             *
+             * @param timeout le délai d'attente maximal, négatif pour attendre indéfiniment
+             * @return le nombre de tâches exécutées.
+             */
+            int runOnce(Clock::duration timeout = Clock::duration{-1});
+
+            /**
+             * Exécute la boucle jusqu'à l'appel de quit().
+             */
+            void run();
+
+            /**
+             * Demande l'arrêt de la boucle: run() retourne après les tâches en cours. Peut être appelée
+             * depuis n'importe quel thread.
+             */
+            void quit();
+
+            /**
+             * Destructeur de EventLoop. Les tâches postées non exécutées sont abandonnées.
+             */
+            ~EventLoop();
+
+        private:
+
+            /*
+             * Exécute les minuteries expirées et retourne leur nombre.
+             */
+            int fireTimers();
+
+            /*
+             * Exécute les tâches postées et retourne leur nombre.
+             */
+            int runPosted();
+
+            /*
+             * Calcule le délai d'attente de poll(2) ou epoll_wait(2) en millisecondes.
+             */
+            int pollTimeout(Clock::duration timeout) const noexcept;
+
+            /*
+             * Met à jour les évènements surveillés du descripteur donné.
+             */
+            void rearm(int fd, bool added) noexcept;
+
+            /*
+             * Exécute les tâches du descripteur donné correspondant aux évènements prêts.
+             */
+            int dispatch(int fd, bool readable, bool writable);
+    };
+}
+
+#endif // EVENTLOOP_H
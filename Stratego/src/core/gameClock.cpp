@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <regex>
+#include <stdexcept>
+
+#include "gameClock.h"
+
+using namespace stratego::model;
+
+/* ===== TimeControl ===== */
+
+bool TimeControl::unlimited() const noexcept{
+    return initial <= std::chrono::steady_clock::duration::zero();
+}
+
+TimeControl TimeControl::parse(std::string_view notation){
+    static const std::regex pattern {"\\s*(\\d{1,4})\\s*(?:\\+\\s*(\\d{1,4}))?\\s*"};
+    std::match_results<std::string_view::const_iterator> match;
+    if(!std::regex_match(notation.begin(), notation.end(), match, pattern))
+        throw std::invalid_argument("The given time control is not valid");
+
+    TimeControl control {std::chrono::minutes{std::stoi(match.str(1))}, {}};
+    if(match[2].matched)
+        control.increment = std::chrono::seconds{std::stoi(match.str(2))};
+    if(control.unlimited())
+        throw std::invalid_argument("The given time control has no initial time");
+
+    return control;
+}
+
+/* ===== GameClock ===== */
+
+GameClock::GameClock(const TimeControl& control) noexcept :
+    control_ {control},
+    remaining_ {control.initial},
+    started_ {},
+    running_ {false}
+{}
+
+void GameClock::start(Clock::time_point now) noexcept{
+    if(running_)
+        return;
+
+    started_ = now;
+    running_ = true;
+}
+
+void GameClock::stop(Clock::time_point now) noexcept{
+    if(!running_)
+        return;
+
+    remaining_ -= now - started_;
+    running_ = false;
+    if(!flagged(now))
+        remaining_ += control_.increment;
+}
+
+GameClock::Duration GameClock::remaining(Clock::time_point now) const noexcept{
+    if(control_.unlimited())
+        return Duration::max();
+
+    return running_ ? remaining_ - (now - started_) : remaining_;
+}
+
+bool GameClock::flagged(Clock::time_point now) const noexcept{
+    return !control_.unlimited() && remaining(now) <= Duration::zero();
+}
+
+bool GameClock::running() const noexcept{
+    return running_;
+}
+
+const TimeControl& GameClock::control() const noexcept{
+    return control_;
+}
+
+std::string GameClock::format(Duration duration){
+    if(duration == Duration::max())
+        return "-";
+
+    auto tenths {std::chrono::duration_cast<std::chrono::duration<long long, std::deci>>(std::max(duration, Duration::zero())).count()};
+    char buffer[32];
+    std::snprintf(buffer, sizeof buffer, "%lld:%02lld.%lld", tenths / 600, tenths / 10 % 60, tenths % 10);
+    return buffer;
+}
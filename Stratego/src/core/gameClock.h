@@ -0,0 +1,146 @@
+#ifndef GAMECLOCK_H
+#define GAMECLOCK_H
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+/*========================================
+* Pendules de jeu et contrôle du temps
+*=========================================
+*/
+
+namespace stratego::model {
+
+    /**
+     * Contrôle du temps d'une partie: chaque joueur dispose d'un temps initial, auquel s'ajoute un
+     * incrément après chacune de ses actions (cadence Fischer). Sans incrément, la cadence est une
+     * mort subite; sans temps initial, la partie n'est pas chronométrée.
+     */
+    struct TimeControl{
+
+        /**
+         * Temps initial de chaque joueur (nul si la partie n'est pas chronométrée).
+         */
+        std::chrono::steady_clock::duration initial;
+
+        /**
+         * Temps ajouté après chaque action d'un joueur (nul en mort subite).
+         */
+        std::chrono::steady_clock::duration increment;
+
+        /**
+         * Vérifie si la partie n'est pas chronométrée.
+         *
+         * @return true si la partie n'est pas chronométrée, false si non.
+         */
+        bool unlimited() const noexcept;
+
+        /**
+         * Construit un contrôle du temps depuis sa notation usuelle "minutes[+secondes]" (par
+         * exemple "5+3": 5 minutes et 3 secondes d'incrément, "10": 10 minutes en mort subite).
+         *
+         * @throw std::invalid_argument si la notation donnée n'est pas valide
+         *
+         * @param notation la notation du contrôle du temps
+         * @return le contrôle du temps.
+         */
+        static TimeControl parse(std::string_view notation);
+    };
+
+    /**
+     * Pendule d'un joueur, mesurée par une horloge monotone (std::chrono::steady_clock): le temps
+     * restant ne dépend pas des changements de l'heure système. La pendule ne décompte que
+     * lorsqu'elle est démarrée, c'est-à-dire pendant le tour du joueur.
+     *
+     * Chaque méthode reçoit l'instant de l'horloge à considérer, l'instant courant par défaut: les
+     * tests peuvent ainsi simuler l'écoulement du temps.
+     */
+    class GameClock{
+
+        public:
+
+            /**
+             * Horloge monotone utilisée par les pendules.
+             */
+            using Clock = std::chrono::steady_clock;
+
+            /**
+             * Durée mesurée par les pendules (résolution de l'horloge).
+             */
+            using Duration = Clock::duration;
+
+        private:
+
+            TimeControl control_;
+            Duration remaining_;
+            Clock::time_point started_;
+            bool running_;
+
+        public:
+
+            /**
+             * Construit une pendule arrêtée disposant du temps initial du contrôle donné.
+             *
+             * @param control le contrôle du temps
+             */
+            explicit GameClock(const TimeControl& control = {}) noexcept;
+
+            /**
+             * Démarre la pendule. Ne fait rien si la pendule est déjà démarrée.
+             *
+             * @param now l'instant du démarrage
+             */
+            void start(Clock::time_point now = Clock::now()) noexcept;
+
+            /**
+             * Arrête la pendule: le temps écoulé depuis son démarrage est décompté, puis l'incrément
+             * est ajouté si le temps n'est pas écoulé. Ne fait rien si la pendule est arrêtée.
+             *
+             * @param now l'instant de l'arrêt
+             */
+            void stop(Clock::time_point now = Clock::now()) noexcept;
+
+            /**
+             * Récupère le temps restant du joueur, négatif si son temps est écoulé.
+             *
+             * @param now l'instant considéré
+             * @return le temps restant, Duration::max() si la partie n'est pas chronométrée.
+             */
+            Duration remaining(Clock::time_point now = Clock::now()) const noexcept;
+
+            /**
+             * Vérifie si le temps du joueur est écoulé.
+             *
+             * @param now l'instant considéré
+             * @return true si le temps est écoulé, false si non (toujours false si la partie n'est
+             * pas chronométrée).
+             */
+            bool flagged(Clock::time_point now = Clock::now()) const noexcept;
+
+            /**
+             * Vérifie si la pendule est démarrée.
+             *
+             * @return true si la pendule est démarrée, false si non.
+             */
+            bool running() const noexcept;
+
+            /**
+             * Récupère le contrôle du temps de la pendule.
+             *
+             * @return le contrôle du temps.
+             */
+            const TimeControl& control() const noexcept;
+
+            /**
+             * Formate la durée donnée sous la forme "m:ss.d" (ou "-" si la partie n'est pas
+             * chronométrée). Une durée négative est affichée comme nulle.
+             *
+             * @param duration la durée
+             * @return la durée formatée.
+             */
+            static std::string format(Duration duration);
+    };
+}
+
+#endif // GAMECLOCK_H
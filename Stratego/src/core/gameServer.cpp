@@ -0,0 +1,586 @@
+#if defined __unix__ || defined __APPLE__
+    #include <fcntl.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#include "gameServer.h"
+#include "util.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+#if defined __unix__ || defined __APPLE__
+
+namespace{
+
+#ifdef MSG_NOSIGNAL
+    constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+    constexpr int SEND_FLAGS = 0;
+#endif
+
+    void configure(int fd) noexcept{
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+
+    int seatOf(Color color) noexcept{
+        return color == Color::RED ? 0 : 1;
+    }
+
+    std::string colorName(Color color){
+        return color == Color::RED ? "red" : "blue";
+    }
+
+    std::vector<std::string_view> split(std::string_view line){
+        std::vector<std::string_view> words {};
+        size_t start {line.find_first_not_of(' ')};
+        while(start != std::string_view::npos){
+            size_t end {line.find(' ', start)};
+            words.push_back(line.substr(start, end == std::string_view::npos ? end : end - start));
+            start = end == std::string_view::npos ? end : line.find_first_not_of(' ', end);
+        }
+
+        return words;
+    }
+
+    bool started(const ModelAdapter& model){
+        StateGraph::State state {model.currentState()};
+        return state == StateGraph::PLAYER_TURN || state == StateGraph::ERROR_ACTION ||
+               state == StateGraph::GAME_TURN || state == StateGraph::PLAYER_SWAP || state == StateGraph::GAME_OVER;
+    }
+
+    long long millis(GameClock::Duration duration){
+        if(duration == GameClock::Duration::max())
+            return -1;
+
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::max(duration, GameClock::Duration::zero())).count();
+    }
+}
+
+GameServer::GameServer(EventLoop& loop, const std::string& path, const ServerLimits& limits) :
+    loop_ {loop},
+    path_ {path},
+    limits_ {limits},
+    listener_ {-1},
+    clients_ {},
+    games_ {},
+    pool_ {},
+    lastClient_ {},
+    lastGame_ {},
+    closing_ {},
+    layouts_ {std::random_device{}()}
+{
+    sockaddr_un address {};
+    if(path.empty() || path.size() >= sizeof address.sun_path)
+        throw std::invalid_argument("The given socket path is empty or too long");
+
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    if((listener_ = socket(AF_UNIX, SOCK_STREAM, 0)) == -1)
+        throw std::runtime_error("Cannot create the server socket");
+
+    configure(listener_);
+    unlink(path.c_str());
+    if(bind(listener_, reinterpret_cast<sockaddr*>(&address), sizeof address) == -1 || listen(listener_, SOMAXCONN) == -1){
+        ::close(listener_);
+        throw std::runtime_error("Cannot listen on the server socket " + path);
+    }
+
+    loop_.watch(listener_, [this](){
+        accept();
+        reap();
+    });
+}
+
+std::size_t GameServer::games() const noexcept{
+    return games_.size();
+}
+
+std::size_t GameServer::clients() const noexcept{
+    return clients_.size();
+}
+
+std::size_t GameServer::idleModels() const noexcept{
+    return pool_[0].size() + pool_[1].size();
+}
+
+GameServer::~GameServer(){
+    for(auto& [id, game] : games_)
+        loop_.cancel(game.flagTimer);
+    for(auto& [id, client] : clients_){
+        loop_.unwatch(client.fd);
+        ::close(client.fd);
+    }
+
+    loop_.unwatch(listener_);
+    ::close(listener_);
+    unlink(path_.c_str());
+}
+
+/* ===== Connexions ===== */
+
+void GameServer::accept(){
+    int fd;
+    while((fd = ::accept(listener_, nullptr, nullptr)) != -1){
+        configure(fd);
+        if(clients_.size() >= limits_.maxClients){
+            constexpr std::string_view full {"ERR server full\n"};
+            [[maybe_unused]] ssize_t written {::send(fd, full.data(), full.size(), SEND_FLAGS)};
+            ::close(fd);
+            continue;
+        }
+
+        std::uint64_t id {++lastClient_};
+        clients_.emplace(id, Client{fd, {}, {}, {}, {}, false});
+        loop_.watch(fd, [this, id](){
+            read(id);
+            reap();
+        });
+    }
+}
+
+void GameServer::read(std::uint64_t id){
+    auto it {clients_.find(id)};
+    if(it == clients_.end() || it -> second.closing)
+        return;
+
+    char buffer[4096];
+    ssize_t count {::read(it -> second.fd, buffer, sizeof buffer)};
+    if(count == 0 || (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)){
+        close(id);
+        return;
+    }
+    if(count < 0)
+        return;
+
+    it -> second.input.append(buffer, count);
+    while(true){
+        // une requête peut fermer n'importe quelle connexion: la connexion est recherchée à chaque ligne
+        it = clients_.find(id);
+        if(it == clients_.end() || it -> second.closing)
+            return;
+
+        std::string& input {it -> second.input};
+        size_t end {input.find('\n')};
+        if(end == std::string::npos ? input.size() > limits_.maxLine : end > limits_.maxLine){
+            send(id, "ERR request too long");
+            close(id);
+            return;
+        }
+        if(end == std::string::npos)
+            return;
+
+        std::string line {input.substr(0, end)};
+        input.erase(0, end + 1);
+        if(!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        handle(id, line);
+    }
+}
+
+void GameServer::send(std::uint64_t id, const std::string& line){
+    auto it {clients_.find(id)};
+    if(it == clients_.end() || it -> second.closing)
+        return;
+
+    bool idle {it -> second.output.empty()};
+    it -> second.output += line;
+    it -> second.output += '\n';
+    if(it -> second.output.size() > limits_.maxOutput){ // la connexion ne lit plus ses réponses
+        close(id);
+    } else if(idle){
+        flush(id);
+    }
+}
+
+void GameServer::broadcast(const Game& game, const std::string& line){
+    send(game.seats[0], line);
+    if(game.seats[1] != game.seats[0])
+        send(game.seats[1], line);
+}
+
+void GameServer::flush(std::uint64_t id){
+    auto it {clients_.find(id)};
+    if(it == clients_.end() || it -> second.closing)
+        return;
+
+    Client& client {it -> second};
+    size_t sent {};
+    while(sent < client.output.size()){
+        ssize_t count {::send(client.fd, client.output.data() + sent, client.output.size() - sent, SEND_FLAGS)};
+        if(count < 0){
+            if(errno == EINTR)
+                continue;
+            if(errno != EAGAIN && errno != EWOULDBLOCK)
+                close(id);
+
+            break;
+        }
+
+        sent += count;
+    }
+
+    client.output.erase(0, sent);
+    if(client.output.empty()){
+        loop_.unwatchWritable(client.fd);
+    } else if(!client.closing){
+        loop_.watchWritable(client.fd, [this, id](){
+            flush(id);
+            reap();
+        });
+    }
+}
+
+void GameServer::close(std::uint64_t id){
+    auto it {clients_.find(id)};
+    if(it == clients_.end() || it -> second.closing)
+        return;
+
+    it -> second.closing = true;
+    closing_.push_back(id);
+}
+
+void GameServer::reap(){
+    // abandonner une partie peut saturer une autre connexion: la liste est consommée jusqu'à épuisement
+    while(!closing_.empty()){
+        std::uint64_t id {closing_.back()};
+        closing_.pop_back();
+        auto it {clients_.find(id)};
+        if(it == clients_.end())
+            continue;
+
+        std::set<std::uint32_t> games {it -> second.games};
+        games.insert(it -> second.owned.begin(), it -> second.owned.end());
+        for(std::uint32_t gameId : games)
+            abandon(id, gameId);
+
+        it = clients_.find(id);
+        loop_.unwatch(it -> second.fd);
+        ::close(it -> second.fd);
+        clients_.erase(it);
+    }
+}
+
+/* ===== Requêtes ===== */
+
+void GameServer::handle(std::uint64_t id, std::string_view line){
+    std::vector<std::string_view> args {split(line)};
+    if(args.empty())
+        return;
+
+    try{
+        std::string_view request {args[0]};
+        if(util::striequals(request, "NEW"))
+            create(id, args);
+        else if(util::striequals(request, "JOIN"))
+            join(id, args);
+        else if(util::striequals(request, "MOVE"))
+            move(id, args);
+        else if(util::striequals(request, "BOARD"))
+            board(id, args);
+        else if(util::striequals(request, "CLOCK"))
+            clock(id, args);
+        else if(util::striequals(request, "LEAVE"))
+            leave(id, args);
+        else if(util::striequals(request, "PING"))
+            send(id, "PONG");
+        else
+            send(id, "ERR unknown request");
+    } catch(const std::exception& e){ // une requête ne doit jamais interrompre le serveur
+        send(id, std::string{"ERR "} + e.what());
+    }
+}
+
+void GameServer::create(std::uint64_t id, const std::vector<std::string_view>& args){
+    if(games_.size() >= limits_.maxGames){
+        send(id, "ERR too many games");
+        return;
+    }
+
+    bool reveal {args.size() > 1 && util::striequals(args[1], "reveal")};
+    if(args.size() > 1 && !reveal && !util::striequals(args[1], "classic")){
+        send(id, "ERR unknown variant");
+        return;
+    }
+
+    TimeControl control {args.size() > 2 ? TimeControl::parse(args[2]) : TimeControl{}};
+    std::unique_ptr<ModelAdapter> model {};
+    auto& idle {pool_[reveal]};
+    if(!idle.empty()){
+        model = std::move(idle.back());
+        idle.pop_back();
+    } else if(reveal){
+        model = std::make_unique<StrategoReveal>();
+    } else{
+        model = std::make_unique<Stratego>();
+    }
+
+    model -> setTimeControl(control);
+    model -> init();
+
+    std::uint32_t gameId {++lastGame_};
+    games_.emplace(gameId, Game{std::move(model), reveal, id, {}, {}, {}});
+    clients_.at(id).owned.insert(gameId);
+    send(id, "CREATED " + std::to_string(gameId));
+}
+
+void GameServer::join(std::uint64_t id, const std::vector<std::string_view>& args){
+    if(args.size() < 4){
+        send(id, "ERR usage: JOIN <game> <red|blue> <pseudo> [layout|random]");
+        return;
+    }
+
+    std::uint32_t gameId {static_cast<std::uint32_t>(std::strtoul(std::string{args[1]}.c_str(), nullptr, 10))};
+    auto it {games_.find(gameId)};
+    if(it == games_.end()){
+        send(id, "ERR unknown game");
+        return;
+    }
+
+    bool red {util::striequals(args[2], "red")};
+    if(!red && !util::striequals(args[2], "blue")){
+        send(id, "ERR unknown color");
+        return;
+    }
+
+    Game& game {it -> second};
+    Color color {red ? Color::RED : Color::BLUE};
+    int seat {seatOf(color)};
+    if(game.seats[seat] || game.model -> currentState() != StateGraph::SET_UP){
+        send(id, "ERR seat already taken");
+        return;
+    }
+
+    std::string_view layout {args.size() > 4 ? args[4] : "default"};
+    if(util::striequals(layout, "random")){
+        game.model -> load(layouts_.next(), color);
+    } else if(layout.find('/') == std::string_view::npos && layout.front() != '.'){ // sous BOARD_CONFIG_PATH uniquement
+        game.model -> load(std::string{layout}, color);
+    } else{
+        send(id, "ERR invalid layout name");
+        return;
+    }
+
+    if(game.model -> currentState() == StateGraph::ERROR_SETUP){
+        send(id, "ERR " + game.model -> history().lastFailure());
+        game.model -> errorProcessed();
+        game.model -> history().clear();
+        return;
+    }
+
+    game.seats[seat] = id;
+    game.pseudos[seat] = std::string{args[3]};
+    clients_.at(id).games.insert(gameId);
+    send(id, "JOINED " + std::to_string(gameId) + " " + colorName(color));
+    if(!game.seats[0] || !game.seats[1])
+        return;
+
+    // une partie commencée ne peut plus être annulée par son créateur
+    clients_.at(game.owner).owned.erase(gameId);
+
+    game.model -> setup(game.pseudos[0], game.pseudos[1]);
+    game.model -> nextPlayer();
+    game.model -> history().clear();
+    broadcast(game, "START " + std::to_string(gameId));
+    announceTurn(gameId, game);
+}
+
+void GameServer::move(std::uint64_t id, const std::vector<std::string_view>& args){
+    std::uint32_t gameId {};
+    Game* game {args.size() == 4 ? seatedGame(id, args[1], gameId) : nullptr};
+    if(!game){
+        if(args.size() != 4)
+            send(id, "ERR usage: MOVE <game> <from> <to>");
+        return;
+    }
+
+    ModelAdapter& model {*game -> model};
+    if(model.currentState() != StateGraph::PLAYER_TURN || game -> seats[seatOf(model.currentPlayer().color())] != id){
+        send(id, "ERR not your turn");
+        return;
+    }
+
+    Position start {}, end {};
+    if(!Position::tryFrom(args[2], start) || !Position::tryFrom(args[3], end)){
+        send(id, "ERR invalid position");
+        return;
+    }
+
+    model.moveAttack(start, end);
+    if(model.currentState() == StateGraph::ERROR_ACTION){
+        send(id, "ERR " + model.history().lastFailure());
+        model.errorProcessed();
+        model.history().clear();
+        return;
+    }
+
+    loop_.cancel(game -> flagTimer);
+    broadcast(*game, "MOVED " + std::to_string(gameId) + " " + std::string{start} + " " + std::string{end});
+    bool flagged {model.currentPlayer().clock().flagged()};
+    model.nextTurn();
+    model.history().clear();
+    if(model.currentState() == StateGraph::GAME_OVER){
+        finish(gameId, flagged ? "time" : "end");
+    } else{
+        model.nextPlayer();
+        announceTurn(gameId, *game);
+    }
+}
+
+void GameServer::board(std::uint64_t id, const std::vector<std::string_view>& args){
+    std::uint32_t gameId {};
+    Game* game {args.size() == 2 ? seatedGame(id, args[1], gameId) : nullptr};
+    if(!game){
+        if(args.size() != 2)
+            send(id, "ERR usage: BOARD <game>");
+        return;
+    }
+
+    // une connexion occupant les deux places voit le plateau du joueur courant
+    Color color {game -> seats[0] == id ? Color::RED : Color::BLUE};
+    if(game -> seats[0] == game -> seats[1] && started(*game -> model))
+        color = game -> model -> currentPlayer().color();
+
+    std::string cases {game -> model -> observation(color).encode()};
+    send(id, "BOARD " + std::to_string(gameId) + " " + colorName(color) + " " + cases);
+}
+
+void GameServer::clock(std::uint64_t id, const std::vector<std::string_view>& args){
+    std::uint32_t gameId {};
+    Game* game {args.size() == 2 ? seatedGame(id, args[1], gameId) : nullptr};
+    if(!game){
+        if(args.size() != 2)
+            send(id, "ERR usage: CLOCK <game>");
+        return;
+    }
+    if(!started(*game -> model)){
+        send(id, "ERR game not started");
+        return;
+    }
+
+    const auto& players {std::as_const(*game -> model).players()};
+    send(id, "CLOCK " + std::to_string(gameId) + " " + std::to_string(millis(players[0] -> clock().remaining()))
+             + " " + std::to_string(millis(players[1] -> clock().remaining())));
+}
+
+void GameServer::leave(std::uint64_t id, const std::vector<std::string_view>& args){
+    std::uint32_t gameId {args.size() == 2 ? static_cast<std::uint32_t>(std::strtoul(std::string{args[1]}.c_str(), nullptr, 10)) : 0};
+    auto it {games_.find(gameId)};
+    const Client& client {clients_.at(id)};
+    if(it == games_.end() || (!client.games.count(gameId) && !client.owned.count(gameId))){
+        send(id, "ERR unknown game");
+        return;
+    }
+
+    abandon(id, gameId);
+}
+
+/* ===== Parties ===== */
+
+GameServer::Game* GameServer::seatedGame(std::uint64_t id, std::string_view arg, std::uint32_t& gameId){
+    gameId = static_cast<std::uint32_t>(std::strtoul(std::string{arg}.c_str(), nullptr, 10));
+    auto it {games_.find(gameId)};
+    if(it == games_.end() || (it -> second.seats[0] != id && it -> second.seats[1] != id)){
+        send(id, "ERR unknown game");
+        return nullptr;
+    }
+
+    return &it -> second;
+}
+
+void GameServer::abandon(std::uint64_t id, std::uint32_t gameId){
+    auto it {games_.find(gameId)};
+    if(it == games_.end())
+        return;
+
+    const auto& seats {it -> second.seats};
+    std::optional<Color> loser {};
+    if(seats[0] == id && seats[1] != id)
+        loser = Color::RED;
+    else if(seats[1] == id && seats[0] != id)
+        loser = Color::BLUE;
+
+    finish(gameId, "forfeit", loser);
+}
+
+void GameServer::announceTurn(std::uint32_t gameId, Game& game){
+    const Player& player {std::as_const(*game.model).currentPlayer()};
+    broadcast(game, "TURN " + std::to_string(gameId) + " " + colorName(player.color()));
+
+    GameClock::Duration remaining {player.clock().remaining()};
+    if(remaining != GameClock::Duration::max()){
+        game.flagTimer = loop_.schedule(std::max(remaining, GameClock::Duration::zero()) + std::chrono::milliseconds{1}, [this, gameId](){
+            flagFell(gameId);
+            reap();
+        });
+    }
+}
+
+void GameServer::flagFell(std::uint32_t gameId){
+    auto it {games_.find(gameId)};
+    if(it == games_.end())
+        return;
+
+    ModelAdapter& model {*it -> second.model};
+    if(model.currentState() != StateGraph::PLAYER_TURN || !model.currentPlayer().clock().flagged())
+        return;
+
+    model.timeout();
+    model.nextTurn();
+    finish(gameId, "time");
+}
+
+void GameServer::finish(std::uint32_t gameId, const std::string& reason, std::optional<Color> loser){
+    auto it {games_.find(gameId)};
+    if(it == games_.end())
+        return;
+
+    Game& game {it -> second};
+    ModelAdapter& model {*game.model};
+    loop_.cancel(game.flagTimer);
+
+    std::string result {"draw"};
+    if(!started(model)){
+        broadcast(game, "OVER " + std::to_string(gameId) + " draw cancelled");
+        if(game.owner != game.seats[0] && game.owner != game.seats[1])
+            send(game.owner, "OVER " + std::to_string(gameId) + " draw cancelled");
+    } else{
+        if(loser)
+            result = colorName(*loser == Color::RED ? Color::BLUE : Color::RED);
+        else if(model.hasWon(Color::RED) != model.hasWon(Color::BLUE))
+            result = colorName(model.hasWon(Color::RED) ? Color::RED : Color::BLUE);
+
+        broadcast(game, "OVER " + std::to_string(gameId) + " " + result + " " + reason);
+    }
+
+    for(std::uint64_t client : {game.owner, game.seats[0], game.seats[1]}){
+        auto c {clients_.find(client)};
+        if(c != clients_.end()){
+            c -> second.games.erase(gameId);
+            c -> second.owned.erase(gameId);
+        }
+    }
+
+    // seul un modèle ayant atteint la fin de partie peut être réinitialisé et recyclé
+    auto& idle {pool_[game.reveal]};
+    if(model.currentState() == StateGraph::GAME_OVER && idle.size() < limits_.maxIdleModels){
+        model.history().clear(); // l'historique n'est plus accessible une fois la partie réinitialisée
+        model.replay(true);
+        idle.push_back(std::move(game.model));
+    }
+
+    games_.erase(it);
+}
+
+#endif
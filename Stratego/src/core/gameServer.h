@@ -0,0 +1,244 @@
+#ifndef GAMESERVER_H
+#define GAMESERVER_H
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "eventLoop.h"
+#include "model.h"
+#include "setupGen.h"
+
+/*========================================
+* Serveur de parties locales
+* (sockets du domaine Unix)
+*=========================================
+*/
+
+namespace stratego{
+
+    /**
+     * Limites d'un serveur de parties (cf. GameServer).
+     */
+    struct ServerLimits{
+
+        /**
+         * Nombre maximal de parties simultanées.
+         */
+        std::size_t maxGames = 4096;
+
+        /**
+         * Nombre maximal de connexions simultanées.
+         */
+        std::size_t maxClients = 8192;
+
+        /**
+         * Longueur maximale d'une requête, en octets.
+         */
+        std::size_t maxLine = 256;
+
+        /**
+         * Nombre maximal d'octets en attente d'envoi par connexion.
+         */
+        std::size_t maxOutput = 64 * 1024;
+
+        /**
+         * Nombre maximal de modèles de jeu inoccupés conservés pour être recyclés.
+         */
+        std::size_t maxIdleModels = 256;
+    };
+
+    /**
+     * Serveur hébergeant, dans un unique processus, un grand nombre de parties simultanées entre
+     * joueurs locaux (bots ou humains) connectés par une socket du domaine Unix. Le serveur est piloté
+     * par une boucle d'évènements (cf. EventLoop, epoll(7) sous linux): aucune connexion ne bloque
+     * les autres. Il arbitre chaque partie sur un modèle de jeu (cf. ModelAdapter); les modèles des
+     * parties terminées sont recyclés.
+     *
+     * Le protocole est textuel, une requête par ligne. Une connexion peut occuper plusieurs places,
+     * dans une ou plusieurs parties (un bot peut ainsi jouer des milliers de parties sur une unique
+     * connexion):
+     *  - NEW [classic|reveal] [cadence] crée une partie (cadence "minutes[+secondes]", cf.
+     *    model::TimeControl::parse()) et répond CREATED <partie>;
+     *  - JOIN <partie> <red|blue> <pseudo> [disposition|random] occupe une place et répond
+     *    JOINED <partie> <couleur>. Lorsque les deux places sont occupées, START <partie> puis
+     *    TURN <partie> <couleur> sont envoyés aux deux joueurs;
+     *  - MOVE <partie> <départ> <arrivée> joue le coup du joueur courant (positions au format 7E).
+     *    MOVED <partie> <départ> <arrivée> est envoyé aux deux joueurs, suivi de TURN ou de
+     *    OVER <partie> <red|blue|draw> <raison>;
+     *  - BOARD <partie> répond BOARD <partie> <couleur> <cases>: les cases du plateau telles que les
+     *    voit le joueur (cf. model::Observation::encode());
+     *  - CLOCK <partie> répond CLOCK <partie> <rouge> <bleu>: le temps restant de chaque joueur en
+     *    millisecondes (-1 si la partie n'est pas chronométrée);
+     *  - LEAVE <partie> abandonne la partie (OVER <partie> <couleur> forfeit);
+     *  - PING répond PONG.
+     * Une requête invalide reçoit ERR <raison>. Une connexion fermée abandonne toutes ses parties
+     * et annule celles qu'elle a créées sans qu'elles aient commencé.
+     *
+     * La mémoire est bornée: le nombre de parties et de connexions est limité, une requête ne peut
+     * dépasser ServerLimits::maxLine octets et une connexion qui ne lit plus ses réponses est fermée dès que
+     * ServerLimits::maxOutput octets sont en attente. Disponible sous linux et apple uniquement.
+     */
+    class GameServer{
+
+        private:
+
+            struct Client{
+                int fd;
+                std::string input;
+                std::string output;
+                std::set<std::uint32_t> games; // parties où la connexion occupe une place
+                std::set<std::uint32_t> owned; // parties créées par la connexion et pas encore commencées
+                bool closing;
+            };
+
+            struct Game{
+                std::unique_ptr<ModelAdapter> model;
+                bool reveal;
+                std::uint64_t owner;
+                std::array<std::uint64_t, Config::PLAYER_COUNT> seats;
+                std::array<std::string, Config::PLAYER_COUNT> pseudos;
+                std::uint64_t flagTimer;
+            };
+
+            EventLoop& loop_;
+            std::string path_;
+            ServerLimits limits_;
+            int listener_;
+            std::unordered_map<std::uint64_t, Client> clients_;
+            std::unordered_map<std::uint32_t, Game> games_;
+            std::array<std::vector<std::unique_ptr<ModelAdapter>>, 2> pool_;
+            std::uint64_t lastClient_;
+            std::uint32_t lastGame_;
+            std::vector<std::uint64_t> closing_;
+            model::SetupGenerator layouts_;
+
+        public:
+
+            /**
+             * Construit un serveur écoutant sur la socket de chemin donné. Une socket existante à ce
+             * chemin est remplacée.
+             *
+             * @throw std::invalid_argument si le chemin donné est trop long pour une socket
+             * @throw std::runtime_error si la socket ne peut être créée
+             *
+             * @param loop la boucle d'évènements pilotant le serveur, devant lui survivre
+             * @param path le chemin de la socket
+             * @param limits les limites du serveur
+             */
+            GameServer(EventLoop& loop, const std::string& path, const ServerLimits& limits = {});
+
+            GameServer(const GameServer&) = delete;
+
+            GameServer& operator=(const GameServer&) = delete;
+
+            /**
+             * Récupère le nombre de parties en cours (ou en attente de joueurs).
+             *
+             * @return le nombre de parties.
+             */
+            std::size_t games() const noexcept;
+
+            /**
+             * Récupère le nombre de connexions ouvertes.
+             *
+             * @return le nombre de connexions.
+             */
+            std::size_t clients() const noexcept;
+
+            /**
+             * Récupère le nombre de modèles de jeu inoccupés, prêts à être recyclés.
+             *
+             * @return le nombre de modèles inoccupés.
+             */
+            std::size_t idleModels() const noexcept;
+
+            /**
+             * Destructeur de GameServer. Ferme toutes les connexions et supprime la socket.
+             */
+            ~GameServer();
+
+        private:
+
+            /*
+             * Accepte les connexions en attente.
+             */
+            void accept();
+
+            /*
+             * Lit et traite les requêtes disponibles de la connexion donnée.
+             */
+            void read(std::uint64_t id);
+
+            /*
+             * Envoie les réponses en attente de la connexion donnée.
+             */
+            void flush(std::uint64_t id);
+
+            /*
+             * Marque la connexion donnée pour fermeture (cf. reap()).
+             */
+            void close(std::uint64_t id);
+
+            /*
+             * Ferme les connexions marquées et abandonne leurs parties. Appelée à la fin de chaque
+             * tâche de la boucle: une connexion n'est jamais détruite pendant le traitement d'une requête.
+             */
+            void reap();
+
+            /*
+             * Envoie une ligne à la connexion donnée.
+             */
+            void send(std::uint64_t id, const std::string& line);
+
+            /*
+             * Envoie une ligne aux joueurs de la partie donnée.
+             */
+            void broadcast(const Game& game, const std::string& line);
+
+            /*
+             * Traite une requête de la connexion donnée.
+             */
+            void handle(std::uint64_t id, std::string_view line);
+
+            void create(std::uint64_t id, const std::vector<std::string_view>& args);
+            void join(std::uint64_t id, const std::vector<std::string_view>& args);
+            void move(std::uint64_t id, const std::vector<std::string_view>& args);
+            void board(std::uint64_t id, const std::vector<std::string_view>& args);
+            void clock(std::uint64_t id, const std::vector<std::string_view>& args);
+            void leave(std::uint64_t id, const std::vector<std::string_view>& args);
+
+            /*
+             * Recherche la partie désignée par l'argument donné à laquelle participe la connexion donnée.
+             */
+            Game* seatedGame(std::uint64_t id, std::string_view arg, std::uint32_t& gameId);
+
+            /*
+             * La connexion donnée quitte la partie donnée: forfait si elle y occupe une place, annulation
+             * si elle l'a créée et que la partie n'a pas commencé.
+             */
+            void abandon(std::uint64_t id, std::uint32_t gameId);
+
+            /*
+             * Annonce le tour du joueur courant et arme la minuterie de chute de sa pendule.
+             */
+            void announceTurn(std::uint32_t gameId, Game& game);
+
+            /*
+             * Constate la chute de la pendule du joueur courant de la partie donnée.
+             */
+            void flagFell(std::uint32_t gameId);
+
+            /*
+             * Termine la partie donnée (issue déjà déterminée par le modèle ou abandon) et recycle son modèle.
+             */
+            void finish(std::uint32_t gameId, const std::string& reason, std::optional<model::Color> loser = std::nullopt);
+    };
+}
+
+#endif // GAMESERVER_H
@@ -1,8 +1,6 @@
 #include "gamestuff.h"
 #include "util.h"
 
-#include <regex>
-
 using namespace stratego::model;
 
 
@@ -30,15 +28,34 @@ Position::operator std::string() const{
     return std::to_string(y) + std::string{static_cast<char>(x + ('A' - 1))};
 }
 
-Position Position::from(const std::string &str){
-    if(std::regex_match(str, std::regex{"( (10|[1-9]{1})[a-j]{1})", std::regex_constants::icase})){
+Position Position::from(std::string_view str){
+    Position pos {};
+    if(!tryFrom(str, pos)){
         throw std::invalid_argument("Invalid string to convert to position");
     }
 
-    auto it = std::find_if(str.begin(), str.end(), [](unsigned char c){return !std::isdigit(c);});
-    int y {std::stoi(str.substr(0, it - str.begin()))};
-    int x {std::tolower(str.substr(it - str.begin()).at(0)) - ('a' - 1)};
-    return {x, y};
+    return pos;
+}
+
+bool Position::tryFrom(std::string_view str, Position& pos) noexcept{
+    size_t i {};
+    int y {};
+    if(!str.empty() && str[0] == '0') // 05A n'est pas une notation de position
+        return false;
+
+    while(i < str.size() && i < 2 && std::isdigit(static_cast<unsigned char>(str[i]))){
+        y = y * 10 + (str[i] - '0');
+        i++;
+    }
+
+    int x {i + 1 == str.size() ? std::tolower(static_cast<unsigned char>(str[i])) - ('a' - 1) : 0};
+    int bound {stratego::Config::BOARD_SIZE - 2};
+    if(y < 1 || y > bound || x < 1 || x > bound){
+        return false;
+    }
+
+    pos = {x, y};
+    return true;
 }
 
 
@@ -47,19 +64,13 @@ Direction::Direction(Direction::Value v) noexcept:
     v_ {v}
 {}
 
-Direction Direction::from(const std::string& str){
-    if(std::regex_match(str, std::regex{"( (up|down|left|right))", std::regex_constants::icase})){
-        throw std::invalid_argument("Invalid string to convert to direction");
-    }
-
-    std::string op {str};
-    util::strtoupper(op);
-    if(op == "UP") return {Direction::UP};
-    if(op == "DOWN") return {Direction::DOWN};
-    if(op == "LEFT") return {Direction::LEFT};
-    if(op == "RIGHT") return {Direction::RIGHT};
+Direction Direction::from(std::string_view str){
+    if(util::striequals(str, "up")) return {Direction::UP};
+    if(util::striequals(str, "down")) return {Direction::DOWN};
+    if(util::striequals(str, "left")) return {Direction::LEFT};
+    if(util::striequals(str, "right")) return {Direction::RIGHT};
 
-    return {static_cast<Direction::Value>(0)};
+    throw std::invalid_argument("Invalid string to convert to direction");
 }
 
 
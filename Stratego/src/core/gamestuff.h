@@ -7,14 +7,19 @@
  * ============================================================
  */
 
+#include <cstdlib>
 #include <fstream>
 #include <ctime>
 #include <functional>
+#include <string_view>
 
 #include "config.h"
 #include "designpatt.h"
 #include "eventMgr.h"
+#include "gameClock.h"
+#include "perf.h"
 #include "properties.h"
+#include "util.h"
 
 namespace stratego::model{
 
@@ -59,7 +64,18 @@ namespace stratego::model{
          * @param str la chaîne de caractères à convertir
          * @return une Position équivalente à la chaîne de caractère donné.
          */
-        static Position from(const std::string& str);
+        static Position from(std::string_view str);
+
+        /**
+         * Version sans exception de from(std::string_view). Convertit la chaîne de
+         * caractères donnée en Position si celle-ci respecte le format [1-10][a-j]. Une
+         * ligne précédée d'un zéro (05a) est refusée.
+         *
+         * @param str la chaîne de caractères à convertir
+         * @param pos la position dans laquelle stocker le résultat de la conversion
+         * @return true si la conversion a réussi, false si non (pos reste alors inchangée).
+         */
+        static bool tryFrom(std::string_view str, Position& pos) noexcept;
     };
 
     /**
@@ -113,7 +129,8 @@ namespace stratego::model{
             /**
              * Convertit la chaîne de caractères donné en
              * Direction. Le format de conversion utilisé est (up|down|left|right). Ce format
-             * reste insensible à la casse.
+             * reste insensible à la casse. Aucune Direction nulle n'est retournée: toute autre
+             * chaîne est refusée.
              *
              * @throw std::invalid_argument si la chaîne de caractères donné
              * ne peut être convertit en Direction.
@@ -121,7 +138,7 @@ namespace stratego::model{
              * @param str la chaîne de caractères à convertir
              * @return une Direction équivalente à la chaîne de caractère donné.
              */
-            static Direction from(const std::string& str);
+            static Direction from(std::string_view str);
 
         private:
 
@@ -193,10 +210,54 @@ namespace stratego::model{
 
     /**
      * Plateau de jeu sur lequel se déroule la bataille.
+     *
+     * Le plateau maintient, pour chaque couleur, une liste dense des pions posés via place(), move()
+     * et remove(): les parcours d'une armée complète (pieces()) ne visitent ainsi que les pions
+     * présents au lieu de l'ensemble des cases. Les pions affectés directement à Cell::piece ne
+     * figurent pas dans ces listes.
      */
     class Board{
 
-        std::array<std::array<Cell, Config::BOARD_SIZE>, Config::BOARD_SIZE> board_;
+        public:
+
+            /**
+             * Nombre maximal de pions d'une couleur présents sur le plateau (une par case jouable).
+             */
+            static constexpr int MAX_PIECES = (Config::BOARD_SIZE - 2) * (Config::BOARD_SIZE - 2);
+
+            /**
+             * Vue en lecture sur la liste des pions d'une couleur, dans un ordre quelconque.
+             */
+            class PieceList{
+
+                Piece* const* begin_;
+                Piece* const* end_;
+
+                public:
+
+                    /**
+                     * Construit une vue sur les pions [begin, end[.
+                     *
+                     * @param begin le premier pion
+                     * @param end la fin de la liste
+                     */
+                    PieceList(Piece* const* begin, Piece* const* end) noexcept : begin_ {begin}, end_ {end}{}
+
+                    Piece* const* begin() const noexcept{ return begin_; }
+                    Piece* const* end() const noexcept{ return end_; }
+                    int size() const noexcept{ return static_cast<int>(end_ - begin_); }
+            };
+
+        private:
+
+            std::array<std::array<Cell, Config::BOARD_SIZE>, Config::BOARD_SIZE> board_;
+            std::array<std::array<std::int16_t, Config::BOARD_SIZE>, Config::BOARD_SIZE> slots_;
+            std::array<std::array<Piece*, MAX_PIECES>, Config::PLAYER_COUNT> pieces_;
+            std::array<std::array<Position, MAX_PIECES>, Config::PLAYER_COUNT> positions_;
+            std::array<int, Config::PLAYER_COUNT> counts_;
+
+            void link(const Position& pos, Piece* piece) noexcept;
+            void unlink(const Position& pos) noexcept;
 
         public:
 
@@ -298,6 +359,47 @@ namespace stratego::model{
              */
             const Cell& getCell(const Position& pos) const;
 
+            /**
+             * Pose le pion donné à la position donnée et l'ajoute à la liste de sa couleur. Le pion
+             * se trouvant éventuellement à cette position est retiré du plateau sans être détruit.
+             *
+             * @throw std::out_of_range si la position indiquée se trouve en dehors du plateau
+             *
+             * @param pos la position à laquelle poser le pion
+             * @param piece le pion à poser (nullptr pour vider la case)
+             */
+            void place(const Position& pos, Piece* piece);
+
+            /**
+             * Retire du plateau le pion se trouvant à la position donnée, sans le détruire.
+             *
+             * @throw std::out_of_range si la position indiquée se trouve en dehors du plateau
+             *
+             * @param pos la position du pion à retirer
+             * @return le pion retiré ou nullptr si aucun pion ne se trouvait à cette position.
+             */
+            Piece* remove(const Position& pos);
+
+            /**
+             * Déplace le pion se trouvant à la position de départ vers la position d'arrivée. Le pion
+             * se trouvant éventuellement à la position d'arrivée est retiré du plateau sans être
+             * détruit.
+             *
+             * @throw std::out_of_range si l'une des positions se trouve en dehors du plateau
+             *
+             * @param from la position de départ
+             * @param to la position d'arrivée
+             */
+            void move(const Position& from, const Position& to);
+
+            /**
+             * Récupère les pions de la couleur donnée présents sur le plateau.
+             *
+             * @param color la couleur des pions
+             * @return une vue sur les pions de la couleur donnée.
+             */
+            PieceList pieces(Color color) const noexcept;
+
             /**
              * Vérifie s'il est possible de se déplacer sur la cellule se trouvant
              * à la position donnée.
@@ -350,9 +452,15 @@ namespace stratego::model{
              */
             const std::array<Cell, Config::BOARD_SIZE>* end() const;
 
+            /**
+             * Vide le plateau de jeu: détruit tout les pions se trouvant sur le plateau
+             * de jeu et vide les listes de pions. Le plateau reste utilisable.
+             */
+            void clear() noexcept;
+
             /**
              * Déstructeur du plateau de jeu. Détruit tout les pions
-             * se trouvant sur le plateau de jeu.
+             * se trouvant sur le plateau de jeu (cf. clear()).
              */
             ~Board();
     };
@@ -392,8 +500,9 @@ namespace stratego::model{
              * donnée.
              *
              * @param bound la taille maximum de l'historique
+             * @param counters les compteurs de performance incrémentés à chaque ajout (aucun si nul)
              */
-            History(int bound) noexcept;
+            History(int bound, perf::Counters* counters = nullptr) noexcept;
 
             /**
              * Ajoute l'information donnée de type donné à l'historique.
@@ -693,6 +802,28 @@ namespace stratego::model{
             std::map<InfoType, std::vector<tmstring>> history_;
             int counter_;
             const int bound_;
+            perf::Counters* counters_;
+    };
+
+    /**
+     * Règles de la version classique de Stratego, utilisées comme politique par RuleModel,
+     * Piece::canMove() et BasicMoveGen. Une politique de règles définit:
+     *  - REVEAL_ON_COMBAT: si les pions ayant déjà combattu restent visibles pour les deux joueurs;
+     *  - MAX_BNF: le nombre maximal d'allers-retours consécutifs d'un pion entre deux mêmes cases;
+     *  - SCOUT_RANGE: le nombre maximal de cases parcourues par un éclaireur en un déplacement.
+     */
+    struct ClassicRules{
+        static constexpr bool REVEAL_ON_COMBAT = false;
+        static constexpr int MAX_BNF = Config::MAX_BNF;
+        static constexpr int SCOUT_RANGE = Config::BOARD_SIZE;
+    };
+
+    /**
+     * Règles de la variante Reveal de Stratego: l'attaque d'un pion révèle l'identité des deux
+     * combattants jusqu'à la fin de la partie.
+     */
+    struct RevealRules : ClassicRules{
+        static constexpr bool REVEAL_ON_COMBAT = true;
     };
 
     /**
@@ -703,7 +834,7 @@ namespace stratego::model{
         std::vector<Observer*> observers_;
         Color color_;
         PieceInfo info_;
-        bool revealed_;
+        std::uint8_t knownBy_;
         std::function<bool(int, int)> winPredicate_;
 
         protected:
@@ -734,7 +865,17 @@ namespace stratego::model{
              * @param str la chaîne de caractères à convertir
              * @return le rang correspondant à la chaîne de caractères donné.
              */
-            static int toRank(const std::string& str);
+            static int toRank(std::string_view str);
+
+            /**
+             * Version sans exception de toRank(std::string_view). Le symbole est comparé sans
+             * tenir compte de la casse.
+             *
+             * @param str la chaîne de caractères à convertir
+             * @param rank le rang dans lequel stocker le résultat de la conversion
+             * @return true si la conversion a réussi, false si non (rank reste alors inchangé).
+             */
+            static bool tryToRank(std::string_view str, int& rank) noexcept;
 
             /**
              * Récupère la description d'un pion de rang donné.
@@ -764,11 +905,15 @@ namespace stratego::model{
             Piece(const PieceInfo& info, const Position& initPos, Color color, std::function<bool(int, int)> winPredicate, Board& board, StateGraph& graph, History& hist) noexcept;
 
             /**
-             * Déplace le pion à la position donnée.
+             * Déplace le pion à la position donnée selon la politique de règles donnée.
              *
+             * @tparam Rules la politique de règles appliquée (cf. ClassicRules)
              * @param pos la position à laquelle déplacer le pion
              */
-            virtual void move(const Position& pos) noexcept;
+            template<class Rules = ClassicRules>
+            void move(const Position& pos) noexcept{
+                moveTo(pos, canMove<Rules>(pos));
+            }
 
             /**
              * Attaque le pion se trouvant à la position donnée.
@@ -778,12 +923,29 @@ namespace stratego::model{
             virtual void attack(const Position& pos) noexcept;
 
             /**
-             * Vérifie si le pion peut se déplacer à la position donnée.
+             * Vérifie si le pion peut se déplacer à la position donnée selon la politique de règles
+             * donnée. Les limites de la politique, connues à la compilation, sont vérifiées avant le
+             * déplacement propre au pion (cf. canReach()).
              *
+             * @tparam Rules la politique de règles appliquée (cf. ClassicRules)
              * @param pos la position à vérifier pour un déplacement
              * @return true si le pion peut se déplacer à la position donnée, false si non.
              */
-            virtual bool canMove(const Position& pos) const noexcept = 0;
+            template<class Rules = ClassicRules>
+            bool canMove(const Position& pos) const noexcept{
+                return (bnfCounter_ < Rules::MAX_BNF || pos.x != recordedPos_.x || pos.y != recordedPos_.y) &&
+                       std::abs(currentPos_.x - pos.x) + std::abs(currentPos_.y - pos.y) <= Rules::SCOUT_RANGE &&
+                       canReach(pos);
+            }
+
+            /**
+             * Vérifie si le pion peut atteindre la position donnée en un déplacement, indépendamment
+             * des limites d'une politique de règles (allers-retours, portée des éclaireurs).
+             *
+             * @param pos la position à vérifier pour un déplacement
+             * @return true si le déplacement du pion permet d'atteindre la position donnée, false si non.
+             */
+            virtual bool canReach(const Position& pos) const noexcept = 0;
 
             /**
              * Vérifie si le pion peut attaquer un pion à la position donnée.
@@ -843,18 +1005,15 @@ namespace stratego::model{
             bool alive() const noexcept;
 
             /**
-             * Détermine si le pion a été révélé.
-             *
-             * @return true si le pion a été révélé, false si non.
-             */
-            bool revealed() const noexcept;
-
-            /**
-             * Change l'état de révélation du pion via le paramètre donné.
+             * Détermine si le joueur de la couleur donnée connaît l'identité du pion: son propriétaire
+             * la connaît toujours, son adversaire dès que le pion a été impliqué dans un combat. Le
+             * modèle de jeu restreint ensuite cette connaissance selon ses règles (cf.
+             * Model::isVisible()).
              *
-             * @param state le nouvel état de révélation
+             * @param viewer la couleur du joueur observant le pion
+             * @return true si le joueur connaît le pion, false si non.
              */
-            void setRevealed(bool state) noexcept;
+            bool knownBy(Color viewer) const noexcept;
 
             /**
              * Récupère une référence vers le nom du pion.
@@ -904,6 +1063,13 @@ namespace stratego::model{
              */
             void resetCounter() noexcept;
 
+            /**
+             * Compte les observateurs notifiés à chaque action du pion.
+             *
+             * @return le nombre d'observateurs du pion.
+             */
+            size_t observerCount() const noexcept;
+
             /**
              * Surchage d'opérateur de conversion permettant
              * à une Pièce d'être convertit explicitement
@@ -916,6 +1082,13 @@ namespace stratego::model{
             void addObserver(Observer* obs) noexcept override;
             void removeObserver(Observer* obs) noexcept override;
             void notifyObservers(std::initializer_list<Observable*> infos) const noexcept override;
+
+        private:
+
+            /*
+             * Applique le déplacement vérifié par move(), ou enregistre son échec s'il n'est pas légal.
+             */
+            void moveTo(const Position& pos, bool legal) noexcept;
     };
 
     /**
@@ -924,6 +1097,7 @@ namespace stratego::model{
     struct PlayerInfo{
         std::string pseudo;
         Color color;
+        TimeControl timeControl {};
     };
 
     /**
@@ -938,6 +1112,7 @@ namespace stratego::model{
         std::map<int, int> armyStat_;
         std::map<int, int> battleStat_;
         Piece* lastMovedPiece_;
+        GameClock clock_;
 
         public:
 
@@ -1037,6 +1212,20 @@ namespace stratego::model{
              */
             const std::map<int, int>& stats() const noexcept;
 
+            /**
+             * Récupère la pendule du joueur, démarrée pendant son tour par le modèle de jeu.
+             *
+             * @return la pendule du joueur.
+             */
+            GameClock& clock() noexcept;
+
+            /**
+             * Récupère la pendule du joueur (version read-only).
+             *
+             * @return la pendule du joueur.
+             */
+            const GameClock& clock() const noexcept;
+
 
             // --- Déjà documenté ---
             void update(std::initializer_list<Observable*> args) override;
@@ -1053,11 +1242,77 @@ namespace stratego::model{
         Color color;
     };
 
+    /**
+     * Parser disposant sur le plateau de jeu une armée décrite par les rangs de ses pions.
+     */
+    class LayoutParser : public Parser<std::vector<Piece*>>{
+
+        public:
+
+            /**
+             * Nombre de rangées de pions décrites par une disposition.
+             */
+            static constexpr int ROWS = Config::ARMY_SIZE / (Config::BOARD_SIZE - 2);
+
+            /**
+             * Rangs des pions d'une armée dans l'ordre du fichier de configuration (rangée par rangée, de
+             * gauche à droite, la première rangée étant la plus éloignée du centre du plateau de jeu).
+             */
+            using Layout = std::array<int, Config::ARMY_SIZE>;
+
+            /**
+             * Construit un parser de disposition.
+             *
+             * @param info les informations utilisées pour le parsing
+             * @param layout la disposition à placer sur le plateau de jeu
+             */
+            LayoutParser(ParseInfo& info, const Layout& layout) noexcept;
+
+            /**
+             * Vérifie si la disposition donnée décrit une armée complète.
+             *
+             * @param layout la disposition à vérifier
+             * @return true si chaque rang est présent en nombre attendu, false si non.
+             */
+            static bool isArmy(const Layout& layout) noexcept;
+
+
+            // --- Déjà documenté ---
+            void parse() override;
+            bool canParse() noexcept override;
+            std::vector<Piece*>& result() noexcept override;
+
+        protected:
+
+            Layout layout_;
+            std::vector<Piece*> result_;
+            ParseInfo& info_;
+
+            /**
+             * Construit un parser dont la disposition sera déterminée ultérieurement.
+             *
+             * @param info les informations utilisées pour le parsing
+             */
+            LayoutParser(ParseInfo& info) noexcept;
+
+        private:
+
+            Piece* toPiece(int rank, int x, int y) const;
+    };
+
+    /**
+     * Rangs des pions d'une armée dans l'ordre du fichier de configuration.
+     */
+    using Layout = LayoutParser::Layout;
+
     /**
      * Parser pour les fichiers de configurations définis par les joueurs
      * pour initialiser leur disposition de plateau de jeu.
+     *
+     * Le fichier n'est lu (projeté en mémoire) et décodé qu'une seule fois: le résultat du
+     * décodage effectué par canParse() est réutilisé par parse().
      */
-    class ConfigFileParser : public Parser<std::vector<Piece*>>{
+    class ConfigFileParser : public LayoutParser{
 
         public:
 
@@ -1081,19 +1336,49 @@ namespace stratego::model{
              */
             static bool canParse(std::ifstream& ifs);
 
+            /**
+             * Détermine s'il est possible de parser le fichier de chemin donné. Le résultat est mis en
+             * cache par chemin, inode, date de modification (à la nanoseconde) et taille du fichier:
+             * un fichier inchangé n'est ainsi ni rouvert ni revalidé lors des appels suivants.
+             *
+             * @param filepath le chemin vers le fichier à vérifier
+             * @return true s'il est possible de parser le fichier sans erreur, false si non (ou si le
+             * fichier n'existe pas).
+             */
+            static bool canParseFile(const std::string& filepath);
+
+            /**
+             * Décode en une seule passe le contenu d'un fichier de configuration.
+             *
+             * @param content le contenu du fichier de configuration
+             * @param layout les rangs décodés
+             * @return true si le contenu donné décrit une armée complète et valide, false si non.
+             */
+            static bool decode(std::string_view content, Layout& layout) noexcept;
+
+            /**
+             * Récupère les rangs décodés lors du dernier appel à canParse().
+             *
+             * @throw std::logic_error si le fichier ne peut être parsé
+             *
+             * @return les rangs des pions décrits par le fichier.
+             */
+            const Layout& layout();
+
 
             // --- Déjà documenté ---
-            void parse() override;
             bool canParse() noexcept override;
-            std::vector<Piece*>& result() noexcept override;
 
         private:
 
-            std::ifstream file_;
-            std::vector<Piece*> result_;
-            ParseInfo& info_;
+            enum Status{
+                UNKNOWN,
+                VALID,
+                INVALID
+            };
 
-            Piece* toPiece(int rank, int x, int y) const;
+            util::MappedFile file_;
+            Status status_;
     };
 
     /**
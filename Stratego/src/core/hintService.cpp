@@ -0,0 +1,86 @@
+#include "hintService.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    /*
+     * Regroupe une suggestion dans un mot de 64 bits (0 si aucune suggestion).
+     */
+    std::uint64_t pack(const Hint& hint) noexcept{
+        return Observation::toSquare(hint.start) | Observation::toSquare(hint.end) << 8 |
+               static_cast<std::uint64_t>(hint.depth) << 16 |
+               static_cast<std::uint64_t>(static_cast<std::uint32_t>(hint.score)) << 32;
+    }
+}
+
+HintService::HintService(int maxDepth) noexcept :
+    worker_ {},
+    stop_ {false},
+    searching_ {false},
+    best_ {0},
+    maxDepth_ {maxDepth},
+    plies_ {-1},
+    color_ {Color::RED}
+{}
+
+void HintService::start(const Model& model, std::function<void()> onFinished){
+    if(model.currentState() != StateGraph::PLAYER_TURN)
+        throw std::logic_error("Current model's state doesn't allow a hint to be computed");
+
+    Color color {model.currentPlayer().color()};
+    const Observation& obs {model.observation(color)};
+    if(worker_.joinable() && color == color_ && obs.plies == plies_)
+        return;
+
+    cancel();
+    MoveGen gen {SearchEngine::position(obs)};
+    std::vector<BotMove> legal {Bot::legalMoves(model)};
+
+    color_ = color;
+    plies_ = obs.plies;
+    stop_ = false;
+    searching_ = true;
+    worker_ = std::thread{&HintService::run, this, std::move(gen), std::move(legal), std::move(onFinished)};
+}
+
+void HintService::cancel() noexcept{
+    stop_ = true;
+    if(worker_.joinable())
+        worker_.join();
+
+    searching_ = false;
+    best_ = 0;
+    plies_ = -1;
+}
+
+std::optional<Hint> HintService::best() const noexcept{
+    std::uint64_t packed {best_.load()};
+    if(!packed)
+        return std::nullopt;
+
+    return Hint{MoveGen::toPosition(packed & 0xFF), MoveGen::toPosition(packed >> 8 & 0xFF),
+                static_cast<int>(packed >> 16 & 0xFF), static_cast<std::int32_t>(packed >> 32)};
+}
+
+bool HintService::searching() const noexcept{
+    return searching_;
+}
+
+HintService::~HintService(){
+    cancel();
+}
+
+/* ===== Recherche ===== */
+
+void HintService::run(MoveGen gen, std::vector<BotMove> legal, std::function<void()> onFinished){
+    SearchEngine engine {stop_};
+    engine.search(std::move(gen), maxDepth_, [this](const Hint& hint){
+        best_ = pack(hint);
+    }, &legal);
+
+    searching_ = false;
+    if(!stop_ && onFinished)
+        onFinished();
+}
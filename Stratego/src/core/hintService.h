@@ -0,0 +1,96 @@
+#ifndef HINTSERVICE_H
+#define HINTSERVICE_H
+
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <thread>
+
+#include "model.h"
+#include "searchEngine.h"
+
+namespace stratego{
+
+    /**
+     * Service de suggestion de coups. La recherche (cf. SearchEngine) est réalisée par un thread de
+     * travail, sur une copie compacte de la position construite depuis l'observation du joueur
+     * courant: le service n'a donc accès à aucune information cachée. Seuls les coups légaux du
+     * modèle de jeu (cf. Bot::legalMoves()) sont suggérés.
+     *
+     * La suggestion est remplacée à chaque profondeur terminée. Elle est publiée dans un mot atomique,
+     * de sorte que best() ne bloque jamais le thread de l'interface. L'annulation (cancel()) est
+     * vérifiée à chaque nœud et ne fait attendre que la fin du nœud en cours.
+     */
+    class HintService{
+
+        std::thread worker_;
+        std::atomic<bool> stop_;
+        std::atomic<bool> searching_;
+        std::atomic<std::uint64_t> best_;
+        int maxDepth_;
+        int plies_;
+        model::Color color_;
+
+        public:
+
+            /**
+             * Profondeur de recherche maximale par défaut (en demi-coups).
+             */
+            static constexpr int MAX_DEPTH = 8;
+
+            /**
+             * Construit un service de suggestion inactif.
+             *
+             * @param maxDepth la profondeur de recherche maximale (en demi-coups)
+             */
+            explicit HintService(int maxDepth = MAX_DEPTH) noexcept;
+
+            HintService(const HintService&) = delete;
+
+            HintService& operator=(const HintService&) = delete;
+
+            /**
+             * Lance la recherche du meilleur coup du joueur courant du modèle de jeu donné, se
+             * trouvant dans l'état PLAYER_TURN. Une recherche en cours sur une autre position est
+             * annulée; une recherche portant déjà sur la position courante est conservée.
+             *
+             * @throw std::logic_error si le modèle de jeu ne se trouve pas dans l'état PLAYER_TURN
+             *
+             * @param model le modèle de jeu
+             * @param onFinished la fonction appelée par le thread de travail lorsque la profondeur
+             * maximale est atteinte (jamais en cas d'annulation); elle ne doit pas bloquer
+             */
+            void start(const Model& model, std::function<void()> onFinished = {});
+
+            /**
+             * Annule la recherche en cours et oublie la dernière suggestion. Ne fait rien si aucune
+             * recherche n'est en cours.
+             */
+            void cancel() noexcept;
+
+            /**
+             * Récupère la meilleure suggestion publiée jusqu'ici, sans attendre le thread de travail.
+             *
+             * @return la meilleure suggestion ou std::nullopt si aucune profondeur n'est terminée.
+             */
+            std::optional<Hint> best() const noexcept;
+
+            /**
+             * Vérifie si la recherche est toujours en cours (profondeur maximale non atteinte).
+             *
+             * @return true si la recherche est en cours, false si non.
+             */
+            bool searching() const noexcept;
+
+            /**
+             * Destructeur de HintService. Annule la recherche en cours.
+             */
+            ~HintService();
+
+        private:
+
+            void run(model::MoveGen gen, std::vector<BotMove> legal, std::function<void()> onFinished);
+    };
+}
+
+#endif // HINTSERVICE_H
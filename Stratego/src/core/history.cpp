@@ -1,19 +1,24 @@
+#include "allocTracker.h"
 #include "gamestuff.h"
 
 using namespace stratego::model;
 
-History::History(int bound) noexcept:
+History::History(int bound, stratego::perf::Counters* counters) noexcept:
     history_ {{SUCCESS, {}}, {FAILURE, {}}, {HINT, {}}},
     counter_ {},
-    bound_ {bound}
+    bound_ {bound},
+    counters_ {counters}
 {}
 
 void History::addInfo(InfoType type, const std::string &info){
+    STRATEGO_ALLOC_SUBSYSTEM(HISTORY);
     if(counter_ >= bound_)
         throw std::out_of_range("Cannot add more elements of this type");
 
     history_[type].push_back(info);
     ++counter_;
+    if(counters_)
+        counters_ -> add(stratego::perf::HISTORY_ENTRIES);
 }
 
 void History::addSuccess(const std::string& info){
@@ -1,6 +1,9 @@
+#include "allocTracker.h"
 #include "model.h"
+#include "perf.h"
 #include "piece.h"
 #include "pieceFactory.h"
+#include "trace.h"
 
 #include <iostream>
 
@@ -9,17 +12,30 @@ using namespace stratego::model;
 
 
 /* ========================== ModelAdapter =========================== */
-ModelAdapter::ModelAdapter() :
+ModelAdapter::ModelAdapter(bool revealCombatants) :
     observers_ {},
     removedPieces_ {},
+    winners_ {},
+    revealCombatants_ {revealCombatants},
+    turn_ {},
+    lastCombatTurn_ {-1},
+    lastCombatants_ {},
+    observations_ {},
+    snapshots_ {},
+    timeControl_ {},
+    counters_ {},
     players_ {},
     playerPointer_ {-1},
     board_ {},
-    history_ {1024},
-    graph_ {}
+    history_ {1024, &counters_},
+    graph_ {},
+    actionStart_ {}
 {}
 
 void ModelAdapter::init(){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::init");
+    STRATEGO_ALLOC_PHASE(SETUP);
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
     if(!graph_.canConsume(StateGraph::INI)){
         throw std::logic_error("Current model's state doesn't allow this method to be called");
     }
@@ -28,12 +44,18 @@ void ModelAdapter::init(){
         delete p;
     }
     removedPieces_.clear();
-    board_.~Board();
+    winners_.fill(false);
+    turn_ = 0;
+    lastCombatTurn_ = -1;
+    lastCombatants_.fill(nullptr);
+    observations_.reset();
+    snapshots_.clear();
+    board_.clear();
     history_.clear();
     playerPointer_ = -1;
-    for(Player* player : players_){
-        if(player)
-            delete player;
+    for(Player*& player : players_){
+        delete player;
+        player = nullptr;
     }
 
     graph_.consume(StateGraph::INI);
@@ -41,61 +63,70 @@ void ModelAdapter::init(){
 }
 
 void ModelAdapter::load(const std::string &filename, Color color, bool isPathAbsolute){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::load");
+    STRATEGO_ALLOC_PHASE(SETUP);
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
+    if(!graph_.canConsume(StateGraph::LOAD) || !graph_.canConsume(StateGraph::FLOAD)){
+        throw std::logic_error("Current model's state doesn't allow this method to be called");
+    }
+
+    ParseInfo info {board_, graph_, history_, color};
+    ConfigFileParser parser {info, isPathAbsolute ? filename : std::string{Config::BOARD_CONFIG_PATH} + filename};
+    parseFor(parser, color);
+    notifyObservers({this});
+}
+
+void ModelAdapter::load(const Layout& layout, Color color){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::load");
+    STRATEGO_ALLOC_PHASE(SETUP);
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
     if(!graph_.canConsume(StateGraph::LOAD) || !graph_.canConsume(StateGraph::FLOAD)){
         throw std::logic_error("Current model's state doesn't allow this method to be called");
     }
 
-    parseFor(filename, color, isPathAbsolute);
+    ParseInfo info {board_, graph_, history_, color};
+    LayoutParser parser {info, layout};
+    parseFor(parser, color);
     notifyObservers({this});
 }
 
 void ModelAdapter::setup(const std::string& redPseudo, const std::string& bluePseudo){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::setup");
+    STRATEGO_ALLOC_PHASE(SETUP);
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
     if(!graph_.canConsume(StateGraph::SET)){
         throw std::logic_error("Current model's state doesn't allow this method to be called");
     }
 
-    players_[0] = new Player {{redPseudo, Color::RED}};
-    players_[1] = new Player {{bluePseudo, Color::BLUE}};
+    players_[0] = new Player {{redPseudo, Color::RED, timeControl_}};
+    players_[1] = new Player {{bluePseudo, Color::BLUE, timeControl_}};
 
-    for(int i = 1; i < board_.size() - 1; i++){
-        for(int j = 1; j < board_.size() - 1; j++){
-            Cell& cell {board_.getCell(j, i)};
-            if(cell.piece){
-                cell.piece -> addObserver(players_[1]);
-                cell.piece -> addObserver(players_[0]);
-                cell.piece -> addObserver(this);
-            }
+    for(Color color : {Color::RED, Color::BLUE}){
+        for(Piece* piece : board_.pieces(color)){
+            piece -> addObserver(players_[1]);
+            piece -> addObserver(players_[0]);
+            piece -> addObserver(this);
+            observations_.place(*piece);
         }
     }
 
+    snapshots_.publish(observations_);
+
     history_.addSuccess("Partie correctement configurée. Bon jeu !");
     graph_.consume(StateGraph::SET);
     notifyObservers({this});
 }
 
 void ModelAdapter::nextPlayer(){
-    if(!graph_.canConsume(StateGraph::NEXT)){
-        throw std::logic_error("Current model's state doesn't allow this method to be called");
-    }
-
-    playerPointer_ = (playerPointer_ + 1) % players_.size();
-    for(int i = 1; i < board_.size() - 1; i++){
-        for(int j = 1; j < board_.size() - 1; j++){
-            Cell& cell {board_.getCell(j, i)};
-            if(cell.piece){
-                if(cell.piece -> color() == currentPlayer().color())
-                    cell.piece -> setRevealed(true);
-                else
-                    cell.piece -> setRevealed(false);
-            }
-        }
-    }
-
-    graph_.consume(StateGraph::NEXT);
-    notifyObservers({this});
+    STRATEGO_TRACE_SCOPE("ModelAdapter::nextPlayer");
+    STRATEGO_ALLOC_PHASE(TURN);
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
+    swapPlayer();
 }
 
 void ModelAdapter::stop(){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::stop");
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
     if(!graph_.canConsume(StateGraph::STOP)){
         throw std::logic_error("Current model's state doesn't allow this method to be called");
     }
@@ -106,6 +137,8 @@ void ModelAdapter::stop(){
 }
 
 void ModelAdapter::errorProcessed(){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::errorProcessed");
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
     if(!graph_.canConsume(StateGraph::ERRCS)){
         throw std::logic_error("Current model's state doesn't allow this method to be called");
     }
@@ -115,15 +148,28 @@ void ModelAdapter::errorProcessed(){
 }
 
 void ModelAdapter::nextTurn(){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::nextTurn");
+    STRATEGO_ALLOC_PHASE(TURN);
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
     if(!graph_.canConsume(StateGraph::CHK) || !graph_.canConsume(StateGraph::FCHK)){
         throw std::logic_error("Current model's state doesn't allow this method to be called");
     }
 
-    if(players_[0] -> hasLost() && players_[1] -> hasLost()){
+    const Player& mover {*players_[playerPointer_]};
+    const Player& opponent {*players_[(playerPointer_ + 1) % players_.size()]};
+    if(mover.clock().flagged()){ // la pendule est arrêtée: l'action a été jouée hors du temps imparti
+        graph_.consume(StateGraph::CHK);
+        winners_[playerPointer_] = false;
+        winners_[(playerPointer_ + 1) % players_.size()] = true;
+        history_.addSuccess(opponent.pseudo() + " a gagné car le temps de " + mover.pseudo() + " est écoulé");
+    }else if(players_[0] -> hasLost() && players_[1] -> hasLost()){
         graph_.consume(StateGraph::CHK);
+        winners_.fill(true);
         history_.addSuccess("Les deux joueurs ont gagnés");
     }else if(players_[0] -> hasLost() || players_[1] -> hasLost()){
         graph_.consume(StateGraph::CHK);
+        winners_[0] = !players_[0] -> hasLost();
+        winners_[1] = !players_[1] -> hasLost();
         if(players_[0] -> hasLost()){
              history_.addSuccess(players_[1] -> pseudo() + " a gagné");
         }else{
@@ -135,9 +181,12 @@ void ModelAdapter::nextTurn(){
 
         if(!p0CanMove && !p1CanMove){
             graph_.consume(StateGraph::CHK);
+            winners_.fill(true);
             history_.addSuccess("Les deux joueurs ont gagnés car ils ne peuvent plus se déplacer");
         } else if(!p0CanMove || !p1CanMove){
             graph_.consume(StateGraph::CHK);
+            winners_[0] = p0CanMove;
+            winners_[1] = p1CanMove;
             if(!p0CanMove){
                 history_.addSuccess(players_[1] -> pseudo() + " a gagné car le joueur adverse ne peut plus se déplacer");
             } else if(!p1CanMove){
@@ -148,10 +197,34 @@ void ModelAdapter::nextTurn(){
         }
     }
 
+    STRATEGO_ALLOC_END_TURN();
     notifyObservers({this});
 }
 
+void ModelAdapter::timeout(){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::timeout");
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
+    if(!graph_.canConsume(StateGraph::ACT) || !graph_.canConsume(StateGraph::FACT)){
+        throw std::logic_error("Current model's state doesn't allow this method to be called");
+    }
+
+    Player& player {*players_[playerPointer_]};
+    if(!player.clock().flagged())
+        throw std::logic_error("The current player's time is not over");
+
+    player.clock().stop();
+    history_.addSuccess("Le temps de " + player.pseudo() + " est écoulé.");
+    graph_.consume(StateGraph::ACT);
+    notifyObservers({this});
+}
+
+void ModelAdapter::setTimeControl(const TimeControl& control) noexcept{
+    timeControl_ = control;
+}
+
 void ModelAdapter::replay(bool state){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::replay");
+    STRATEGO_ALLOC_SUBSYSTEM(MODEL);
     if(!graph_.canConsume(StateGraph::RWD) || !graph_.canConsume(StateGraph::END)){
         throw std::logic_error("Current model's state doesn't allow this method to be called");
     }
@@ -214,15 +287,66 @@ const std::array<Player*, stratego::Config::PLAYER_COUNT>& ModelAdapter::players
     return players_;
 }
 
+bool ModelAdapter::isVisible(const Piece& piece, std::optional<Color> viewer) const noexcept{
+    if(viewer && piece.color() == *viewer)
+        return true;
+
+    bool known {viewer ? piece.knownBy(*viewer) : piece.knownBy(Color::RED) && piece.knownBy(Color::BLUE)};
+    if(!known)
+        return false;
+
+    // sans la règle Reveal, seuls les combattants du tour courant restent visibles
+    return revealCombatants_ ||
+           (lastCombatTurn_ == turn_ && (&piece == lastCombatants_[0] || &piece == lastCombatants_[1]));
+}
+
+const Observation& ModelAdapter::observation(Color color) const noexcept{
+    return observations_.of(color);
+}
+
+std::shared_ptr<const BoardSnapshot> ModelAdapter::snapshot() const noexcept{
+    return snapshots_.acquire();
+}
+
+const TimeControl& ModelAdapter::timeControl() const noexcept{
+    return timeControl_;
+}
+
+perf::Counters& ModelAdapter::counters() const noexcept{
+    return counters_;
+}
+
 void ModelAdapter::update(std::initializer_list<Observable*> args){
+    STRATEGO_TRACE_SCOPE("ModelAdapter::update");
     // filter args to delete (args processed by the players -> Pieces)
     Piece* p;
+    std::array<const Piece*, 2> pieces {};
+    int count {};
     for(Observable* obs : args){
-        if((p = dynamic_cast<Piece*>(obs)) && !p -> alive()){
-            removedPieces_.push_back(p);
+        if((p = dynamic_cast<Piece*>(obs))){
+            pieces[count++] = p;
+            if(!p -> alive())
+                removedPieces_.push_back(p);
         }
     }
 
+    if(count) // notification du pion ayant agi, reçue par chacun de ses observateurs
+        counters_.add(perf::NOTIFICATIONS, pieces[0] -> observerCount());
+
+    bool moved {count == 1 && args.size() == 1 && pieces[0] -> hasMove()};
+    if(count == 2 || moved) // action appliquée: le temps du joueur courant est décompté
+        players_[playerPointer_] -> clock().stop();
+
+    if(count == 2){ // attaque résolue: attaquant et défenseur (cf. Piece::attack())
+        lastCombatants_ = pieces;
+        lastCombatTurn_ = turn_;
+        observations_.combat(actionStart_, pieces[1] -> position(), *pieces[0], *pieces[1]);
+        snapshots_.publish(observations_);
+    } else if(moved){ // déplacement réussi
+        observations_.move(actionStart_, pieces[0] -> position());
+        snapshots_.publish(observations_);
+    }
+
     notifyObservers(args);
 }
 
@@ -239,6 +363,8 @@ void ModelAdapter::removeObserver(Observer* obs) noexcept{
 }
 
 void ModelAdapter::notifyObservers(std::initializer_list<Observable*> infos) const noexcept{
+    STRATEGO_TRACE_SCOPE("ModelAdapter::notifyObservers");
+    counters_.add(perf::NOTIFICATIONS, observers_.size());
     for(auto& obs : observers_){
         obs -> update(infos);
     }
@@ -258,55 +384,64 @@ ModelAdapter::~ModelAdapter(){
 }
 
 bool ModelAdapter::playerCanMove(Color color) noexcept{
-    for(int i = 0; i < board_.size(); i++){
-        for(int j = 0; j < board_.size(); j++){
-            Piece* piece {board_.getPiece(j, i)};
-            if(piece && piece -> color() == color && pieceCanMove(piece))
-                return true;
-        }
+    std::uint64_t checks {};
+    bool canMove {};
+    for(Piece* piece : board_.pieces(color)){
+        if((canMove = pieceCanMove(piece, checks)))
+            break;
     }
 
-    return false;
+    counters_.add(perf::LEGALITY_CHECKS, checks);
+    return canMove;
 }
 
 bool ModelAdapter::playerCanMove_startGame(Color color) const noexcept{
     int y {color == Color::BLUE ? 4 : board_.size() / 2 + 1};
-    for(int i = 0; i < board_.size(); i++){
+    std::uint64_t checks {};
+    bool canMove {};
+    for(int i = 0; i < board_.size() && !canMove; i++){
         const Piece* piece {board_.getPiece(i, y)};
-        if(piece && piece -> color() == color && pieceCanMove(piece))
-            return true;
+        canMove = piece && piece -> color() == color && pieceCanMove(piece, checks);
     }
 
-    return false;
+    counters_.add(perf::LEGALITY_CHECKS, checks);
+    return canMove;
 }
 
-bool ModelAdapter::pieceCanMove(const Piece* piece) const noexcept{
-    return piece -> canMove(piece -> position() + Position{0, 1})    ||
-           piece -> canMove(piece -> position() + Position{0, -1})   ||
-           piece -> canMove(piece -> position() + Position{1, 0})    ||
-           piece -> canMove(piece -> position() + Position{-1, 0})   ||
-           piece -> canAttack(piece -> position() + Position{0, 1})  ||
-           piece -> canAttack(piece -> position() + Position{0, -1}) ||
-           piece -> canAttack(piece -> position() + Position{1, 0})  ||
-           piece -> canAttack(piece -> position() + Position{-1, 0});
+bool ModelAdapter::hasWon(Color color) const noexcept{
+    return graph_.state() == StateGraph::GAME_OVER && winners_[color == Color::RED ? 0 : 1];
 }
 
-void ModelAdapter::parseFor(const std::string& filename, Color color, bool isPathAbsolute){
-    ParseInfo info {board_, graph_, history_, color};
-    Parser<std::vector<Piece*>>* parser = new ConfigFileParser(info, isPathAbsolute ? filename : std::string{Config::BOARD_CONFIG_PATH} + filename);
+bool ModelAdapter::pieceCanMove(const Piece* piece, std::uint64_t& checks) const noexcept{
+    for(Position offset : {Position{0, 1}, Position{0, -1}, Position{1, 0}, Position{-1, 0}}){
+        checks++;
+        if(canMove(*piece, piece -> position() + offset))
+            return true;
+    }
+    for(Position offset : {Position{0, 1}, Position{0, -1}, Position{1, 0}, Position{-1, 0}}){
+        checks++;
+        if(piece -> canAttack(piece -> position() + offset))
+            return true;
+    }
+
+    return false;
+}
+
+void ModelAdapter::parseFor(Parser<std::vector<Piece*>>& parser, Color color){
+    STRATEGO_ALLOC_SUBSYSTEM(PARSER);
     std::vector<Piece*> result;
     char buffer[200];
 
-    if(parser -> canParse()){
-        parser -> parse();
-        result = std::move(parser -> result());
+    if(parser.canParse()){
+        parser.parse();
+        result = std::move(parser.result());
 
         for(Piece* piece : result){
-            if(board_.getCell(piece -> position()).piece){
-                delete board_.getCell(piece -> position()).piece;
+            if(Piece* previous {board_.remove(piece -> position())}){
+                delete previous;
             }
 
-            board_.getCell(piece -> position()).piece = piece;
+            board_.place(piece -> position(), piece);
         }
 
         if(!playerCanMove_startGame(color)){
@@ -325,8 +460,6 @@ void ModelAdapter::parseFor(const std::string& filename, Color color, bool isPat
         history_.addFailure(buffer);
         graph_.consume(StateGraph::FLOAD);
     }
-
-    delete parser;
 }
 
 std::vector<Piece*> ModelAdapter::piecesOf(Color color){
@@ -356,205 +489,15 @@ const std::vector<Piece*>& ModelAdapter::removedPieces() const noexcept{
     return removedPieces_;
 }
 
-
-/* ========================== Stratego =========================== */
-Stratego::Stratego() : ModelAdapter {}
-{}
-
-void Stratego::move(const Position &startPos, const Position &endPos){
-    if(!graph_.canConsume(StateGraph::ACT) || !graph_.canConsume(StateGraph::FACT)){
-        throw std::logic_error("Current model's state doesn't allow this method to be called");
-    }
-
-    Piece* piece;
-    if((piece = board_.getPiece(startPos))){
-        if(piece -> color() == currentPlayer().color()){
-            piece -> move(endPos);
-        } else{
-            history_.addFailure("La pièce indiquée ne vous appartient pas.");
-            history_.addHint(std::string{"Sélectionnez une pièce "} + (currentPlayer().color() == Color::RED ? "rouge" : "bleu")
-                             + " face visible.");
-            graph_.consume(StateGraph::FACT);
-            notifyObservers({this});
-        }
-    } else{
-        history_.addFailure("Aucune pièce ne se trouve à la position de départ indiquée.");
-        history_.addHint("La case sélectionné estvide");
-        graph_.consume(StateGraph::FACT);
-        notifyObservers({this});
-    }
-}
-
-void Stratego::attack(const Position &startPos, const Position &endPos){
-    if(!graph_.canConsume(StateGraph::ACT) || !graph_.canConsume(StateGraph::FACT)){
-        throw std::logic_error("Current model's state doesn't allow this method to be called");
-    }
-
-    Piece* piece;
-    if((piece = board_.getPiece(startPos))){
-        if(piece -> color() == currentPlayer().color()){
-            piece -> attack(endPos);
-        } else{
-            history_.addFailure("La pièce indiquée ne vous appartient pas.");
-            history_.addHint(std::string{"Sélectionnez une pièce "} + (currentPlayer().color() == Color::RED ? "rouge" : "bleu")
-                             + " face visible.");
-            graph_.consume(StateGraph::FACT);
-            notifyObservers({this});
-        }
-    } else{
-        history_.addFailure("Aucune pièce ne se trouve à la position de départ indiquée.");
-        history_.addHint("La case sélectionné est vide");
-        graph_.consume(StateGraph::FACT);
-        notifyObservers({this});
-    }
-}
-
-void Stratego::moveAttack(const Position &startPos, const Position &endPos){
-    if(!graph_.canConsume(StateGraph::ACT) || !graph_.canConsume(StateGraph::FACT)){
-        throw std::logic_error("Current model's state doesn't allow this method to be called");
-    }
-
-    Piece* piece;
-    if((piece = board_.getPiece(startPos))){
-        if(piece -> color() == currentPlayer().color()){
-            if(board_.getPiece(endPos)){
-                piece -> attack(endPos);
-            } else{
-                piece -> move(endPos);
-            }
-        } else{
-            history_.addFailure("La pièce indiquée ne vous appartient pas.");
-            history_.addHint(std::string{"Sélectionnez une pièce "} + (currentPlayer().color() == Color::RED ? "rouge" : "bleu")
-                             + " face visible.");
-            graph_.consume(StateGraph::FACT);
-            notifyObservers({this});
-        }
-    } else{
-        history_.addFailure("Aucune pièce ne se trouve à la position de départ indiquée.");
-        history_.addHint("La case sélectionné est vide");
-        graph_.consume(StateGraph::FACT);
-        notifyObservers({this});
-    }
-}
-
-
-/* ========================== StrategoReveal =========================== */
-StrategoReveal::StrategoReveal() : ModelAdapter {}
-{}
-
-void StrategoReveal::move(const Position &startPos, const Position &endPos){
-    if(!graph_.canConsume(StateGraph::ACT) || !graph_.canConsume(StateGraph::FACT)){
-        throw std::logic_error("Current model's state doesn't allow this method to be called");
-    }
-
-    Piece* piece;
-    if((piece = board_.getPiece(startPos))){
-        if(piece -> color() == currentPlayer().color()){
-            piece -> move(endPos);
-        } else{
-            history_.addFailure("La pièce indiquée ne vous appartient pas.");
-            history_.addHint(std::string{"Sélectionnez une pièce "} + (currentPlayer().color() == Color::RED ? "rouge" : "bleu")
-                             + " face visible.");
-            graph_.consume(StateGraph::FACT);
-            notifyObservers({this});
-        }
-    } else{
-        history_.addFailure("Aucune pièce ne se trouve à la position de départ indiquée.");
-        history_.addHint("La case sélectionné est vide");
-        graph_.consume(StateGraph::FACT);
-        notifyObservers({this});
-    }
-}
-
-void StrategoReveal::attack(const Position &startPos, const Position &endPos){
-    if(!graph_.canConsume(StateGraph::ACT) || !graph_.canConsume(StateGraph::FACT)){
-        throw std::logic_error("Current model's state doesn't allow this method to be called");
-    }
-
-    Piece* piece;
-    if((piece = board_.getPiece(startPos))){
-        if(piece -> color() == currentPlayer().color()){
-            piece -> attack(endPos);
-        } else{
-            history_.addFailure("La pièce indiquée ne vous appartient pas.");
-            history_.addHint(std::string{"Sélectionnez une pièce "} + (currentPlayer().color() == Color::RED ? "rouge" : "bleu")
-                             + " face visible.");
-            graph_.consume(StateGraph::FACT);
-            notifyObservers({this});
-        }
-    } else{
-        history_.addFailure("Aucune pièce ne se trouve à la position de départ indiquée.");
-        history_.addHint("La case sélectionné est vide");
-        graph_.consume(StateGraph::FACT);
-        notifyObservers({this});
-    }
-}
-
-void StrategoReveal::moveAttack(const Position &startPos, const Position &endPos){
-    if(!graph_.canConsume(StateGraph::ACT) || !graph_.canConsume(StateGraph::FACT)){
-        throw std::logic_error("Current model's state doesn't allow this method to be called");
-    }
-
-    Piece* piece;
-    if((piece = board_.getPiece(startPos))){
-        if(piece -> color() == currentPlayer().color()){
-            if(board_.getPiece(endPos)){
-                piece -> attack(endPos);
-            } else{
-                piece -> move(endPos);
-            }
-        } else{
-            history_.addFailure("La pièce indiquée ne vous appartient pas.");
-            history_.addHint(std::string{"Sélectionnez une pièce "} + (currentPlayer().color() == Color::RED ? "rouge" : "bleu")
-                             + " face visible.");
-            graph_.consume(StateGraph::FACT);
-            notifyObservers({this});
-        }
-    } else{
-        history_.addFailure("Aucune pièce ne se trouve à la position de départ indiquée.");
-        history_.addHint("La case sélectionné est vide");
-        graph_.consume(StateGraph::FACT);
-        notifyObservers({this});
-    }
-}
-void StrategoReveal::nextPlayer(){
+void ModelAdapter::swapPlayer(){
     if(!graph_.canConsume(StateGraph::NEXT)){
         throw std::logic_error("Current model's state doesn't allow this method to be called");
     }
 
     playerPointer_ = (playerPointer_ + 1) % players_.size();
-    for(int i = 1; i < board_.size() - 1; i++){
-        for(int j = 1; j < board_.size() - 1; j++){
-            Cell& cell {board_.getCell(j, i)};
-            if(cell.piece){
-                if(cell.piece -> color() == currentPlayer().color() || cell.piece -> hasBeenInCombat()){
-                    cell.piece -> setRevealed(true);
-                } else{
-                    cell.piece -> setRevealed(false);
-                }
-            }
-        }
-    }
+    turn_++;
+    players_[playerPointer_] -> clock().start();
 
     graph_.consume(StateGraph::NEXT);
     notifyObservers({this});
 }
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
@@ -6,7 +6,13 @@
  * ==========================================
  */
 
+#include <optional>
+
+#include "allocTracker.h"
+#include "boardSnapshot.h"
 #include "gamestuff.h"
+#include "observation.h"
+#include "trace.h"
 
 namespace stratego{
 
@@ -46,6 +52,18 @@ namespace stratego{
              */
             virtual void load(const std::string& filename, model::Color color, bool isPathAbsolute = false) = 0;
 
+            /**
+             * Charge une disposition de plateau de jeu pour un joueur de couleur donné, sans passer par
+             * un fichier de configuration. Les transitions d'état sont identiques à celles de
+             * load(const std::string&, model::Color, bool).
+             *
+             * @throw std::logic_error si l'état courant du modèle l'empêche de consumer l'événement LOAD ou FLOAD.
+             *
+             * @param layout les rangs des pions à disposer
+             * @param color la couleur du joueur pour lequel charger la disposition
+             */
+            virtual void load(const model::Layout& layout, model::Color color) = 0;
+
             /**
              * Termine la configuration d'une partie de jeu en instançiant les deux joueurs. L'état passe de
              * SET_UP à PLAYER_SWAP via l'événement SET.
@@ -100,7 +118,8 @@ namespace stratego{
             /**
              * Vérifie si la partie de jeu courante est terminée. L'état passe de GAME_TURN à GAME_OVER via
              * l'événement CHK si la partie de jeu courante est terminée, ou passse de GAME_TURN à PLAYER_SWAP
-             * via l'événement FCHK dans le cas contraire.
+             * via l'événement FCHK dans le cas contraire. Le joueur dont le temps s'est écoulé avant la
+             * fin de son action perd la partie.
              *
              * @throw std::logic_error si l'état courant du modèle l'empêche de consumer l'événement CHK ou FCHK.
              */
@@ -129,6 +148,25 @@ namespace stratego{
              */
             virtual void errorProcessed() = 0;
 
+            /**
+             * Constate l'écoulement du temps du joueur courant, qui n'a pas agi avant la chute de sa
+             * pendule. L'état passe de PLAYER_TURN à GAME_TURN via l'événement ACT, sans qu'aucun pion
+             * ne soit déplacé: nextTurn() déclare ensuite la défaite du joueur.
+             *
+             * @throw std::logic_error si l'état courant du modèle l'empêche de consumer l'événement ACT
+             * ou si le temps du joueur courant n'est pas écoulé.
+             */
+            virtual void timeout() = 0;
+
+            /**
+             * Définit le contrôle du temps des parties suivantes: les pendules des joueurs sont créées
+             * avec ce contrôle lors de la mise en place de la partie (cf. setup()). Par défaut, les
+             * parties ne sont pas chronométrées.
+             *
+             * @param control le contrôle du temps
+             */
+            virtual void setTimeControl(const model::TimeControl& control) noexcept = 0;
+
             /**
              * Rejoue une partie en fonction de l'état passé en paramètre. L'état passe de GAME_OVER à NOT_STARTED si les
              * joueurs veulent recommencer une nouvelle partie via l'événement RWD, ou passe de l'état GAME_OVER à EOG
@@ -252,6 +290,75 @@ namespace stratego{
              */
             virtual bool playerCanMove_startGame(model::Color color) const noexcept = 0;
 
+            /**
+             * Vérifie si le pion donné peut se déplacer à la position donnée selon les règles du
+             * modèle (cf. Piece::canMove()).
+             *
+             * @param piece le pion à déplacer
+             * @param pos la position à vérifier pour un déplacement
+             * @return true si le pion peut se déplacer à la position donnée, false si non.
+             */
+            virtual bool canMove(const model::Piece& piece, const model::Position& pos) const noexcept = 0;
+
+            /**
+             * Vérifie si le joueur de couleur donnée a gagné la partie de jeu courante. Les deux
+             * joueurs sont considérés comme gagnants si la partie se termine sur une égalité.
+             *
+             * @param color la couleur du joueur
+             * @return true si la partie est terminée (état GAME_OVER) et que le joueur l'a gagnée, false si non.
+             */
+            virtual bool hasWon(model::Color color) const noexcept = 0;
+
+            /**
+             * Détermine si l'identité du pion donné est visible depuis la perspective donnée. Un joueur
+             * voit toujours ses propres pions; les pions adverses ne lui sont visibles que s'il les a
+             * vus combattre, pendant le tour du combat ou, selon les règles, jusqu'à la fin de la partie.
+             * Sans perspective (écran de transition entre deux joueurs), seuls les pions connus des
+             * deux joueurs sont visibles. La visibilité ne dépend d'aucun état modifié lors du
+             * changement de joueur: plusieurs perspectives peuvent être rendues simultanément.
+             *
+             * @param piece le pion à afficher
+             * @param viewer la couleur du joueur observant le plateau, ou std::nullopt
+             * @return true si l'identité du pion est visible, false si non.
+             */
+            virtual bool isVisible(const model::Piece& piece, std::optional<model::Color> viewer) const noexcept = 0;
+
+            /**
+             * Récupère ce que le joueur de couleur donnée sait de la partie en cours. L'observation
+             * est maintenue de manière incrémentale à chaque action et ne contient aucun rang adverse
+             * caché; elle est vide avant la mise en place de la partie.
+             *
+             * @param color la couleur du joueur
+             * @return l'observation du joueur.
+             */
+            virtual const model::Observation& observation(model::Color color) const noexcept = 0;
+
+            /**
+             * Récupère le dernier instantané publié du plateau de jeu. Un instantané est publié à la
+             * mise en place de la partie puis après chaque action appliquée; il n'est plus jamais
+             * modifié et peut donc être lu depuis n'importe quel thread, sans verrou, pendant que la
+             * partie continue.
+             *
+             * @return le dernier instantané publié, jamais nul.
+             */
+            virtual std::shared_ptr<const model::BoardSnapshot> snapshot() const noexcept = 0;
+
+            /**
+             * Récupère le contrôle du temps des parties (cf. setTimeControl()).
+             *
+             * @return le contrôle du temps.
+             */
+            virtual const model::TimeControl& timeControl() const noexcept = 0;
+
+            /**
+             * Récupère les compteurs de performance de la partie. Ils ne font pas partie de l'état
+             * du jeu: ils sont modifiables même depuis un modèle constant (remise à zéro, mesure des
+             * rendus par les vues).
+             *
+             * @return les compteurs de performance du modèle.
+             */
+            virtual perf::Counters& counters() const noexcept = 0;
+
             /**
              * Destructeur virtuel de Model.
              */
@@ -267,6 +374,15 @@ namespace stratego{
 
         std::vector<Observer*> observers_;
         std::vector<model::Piece*> removedPieces_;
+        std::array<bool, Config::PLAYER_COUNT> winners_;
+        bool revealCombatants_;
+        int turn_;
+        int lastCombatTurn_;
+        std::array<const model::Piece*, 2> lastCombatants_;
+        model::ObservationBuilder observations_;
+        model::SnapshotPublisher snapshots_;
+        model::TimeControl timeControl_;
+        mutable perf::Counters counters_;
 
         protected:
 
@@ -276,22 +392,34 @@ namespace stratego{
             model::History history_;
             model::StateGraph graph_;
 
+            /**
+             * Position de départ de l'action en cours, utilisée pour mettre à jour les observations
+             * lors de la notification du pion.
+             */
+            model::Position actionStart_;
+
         public:
 
             /**
              * Construit un modèle de jeu.
+             *
+             * @param revealCombatants flag pour laisser visibles jusqu'à la fin de la partie les pions
+             * ayant déjà combattu
              */
-            ModelAdapter();
+            ModelAdapter(bool revealCombatants = false);
 
 
             // --- Déjà documenté ---
             void init() override;
             void load(const std::string& filename, model::Color color, bool isPathAbsolute = false) override;
+            void load(const model::Layout& layout, model::Color color) override;
             void setup(const std::string& redInfo, const std::string& blueInfo) override;
             void nextTurn() override;
             void nextPlayer() override;
             void stop() override;
             void errorProcessed() override;
+            void timeout() override;
+            void setTimeControl(const model::TimeControl& control) noexcept override;
             void replay(bool state) override;
 
 
@@ -308,6 +436,12 @@ namespace stratego{
             std::vector<model::Piece*> piecesOf(model::Color color) override;
             const std::vector<model::Piece*>& removedPieces() const noexcept override;
             bool playerCanMove_startGame(model::Color color) const noexcept override;
+            bool hasWon(model::Color color) const noexcept override;
+            bool isVisible(const model::Piece& piece, std::optional<model::Color> viewer) const noexcept override;
+            const model::Observation& observation(model::Color color) const noexcept override;
+            std::shared_ptr<const model::BoardSnapshot> snapshot() const noexcept override;
+            const model::TimeControl& timeControl() const noexcept override;
+            perf::Counters& counters() const noexcept override;
 
 
             // --- Déjà documenté ---
@@ -322,55 +456,149 @@ namespace stratego{
              */
             virtual ~ModelAdapter();
 
+        protected:
+
+            /**
+             * Passe au joueur suivant et démarre sa pendule. Aucun pion n'est modifié: la visibilité
+             * est calculée à la demande par isVisible().
+             *
+             * @throw std::logic_error si l'état courant du modèle ne permet pas de passer au joueur suivant
+             */
+            void swapPlayer();
+
         private:
 
-            void parseFor(const std::string& filename, model::Color color, bool isPathAbsolute);
+            void parseFor(Parser<std::vector<model::Piece*>>& parser, model::Color color);
             model::Piece* toPiece(int rank, model::Color color);
             bool playerCanMove(model::Color color) noexcept;
-            bool pieceCanMove(const model::Piece* piece) const noexcept;
+            bool pieceCanMove(const model::Piece* piece, std::uint64_t& checks) const noexcept;
     };
 
     /**
-     * Modèle de jeu pour jouer à la version classique de Stratego.
+     * Modèle de jeu paramétré à la compilation par une politique de règles (cf. ClassicRules).
+     * Les actions sont implémentées une seule fois pour l'ensemble des variantes et vérifient les
+     * limites de la politique sans indirection (cf. Piece::canMove()). Les membres étant définis
+     * dans ce fichier et la classe étant finale, les appels réalisés depuis un type concret ne
+     * passent plus par la table virtuelle et peuvent être inlinés.
+     *
+     * Une nouvelle variante s'ajoute en définissant une politique de règles.
+     *
+     * @tparam Rules la politique de règles appliquée
      */
-    class Stratego : public ModelAdapter{
+    template<class Rules>
+    class RuleModel final : public ModelAdapter{
 
         public:
 
             /**
-             * Construit un modèle de jeu classique.
+             * Construit un modèle de jeu appliquant les règles données.
              */
-            Stratego();
+            RuleModel();
 
 
             // --- Déjà documenté ---
             void move(const model::Position& startPos, const model::Position& endPos) override;
             void attack(const model::Position& startPos, const model::Position& endPos) override;
             void moveAttack(const model::Position& startPos, const model::Position& endPos) override;
+            void nextPlayer() override;
+            bool canMove(const model::Piece& piece, const model::Position& pos) const noexcept override;
+
+        private:
+
+            enum Order{
+                MOVE,
+                ATTACK,
+                MOVE_ATTACK
+            };
+
+            template<Order order>
+            void play(const model::Position& startPos, const model::Position& endPos);
     };
 
+    template<class Rules>
+    RuleModel<Rules>::RuleModel() : ModelAdapter {Rules::REVEAL_ON_COMBAT}
+    {}
+
+    template<class Rules>
+    void RuleModel<Rules>::move(const model::Position& startPos, const model::Position& endPos){
+        STRATEGO_TRACE_SCOPE("RuleModel::move");
+        play<MOVE>(startPos, endPos);
+    }
+
+    template<class Rules>
+    void RuleModel<Rules>::attack(const model::Position& startPos, const model::Position& endPos){
+        STRATEGO_TRACE_SCOPE("RuleModel::attack");
+        play<ATTACK>(startPos, endPos);
+    }
+
+    template<class Rules>
+    void RuleModel<Rules>::moveAttack(const model::Position& startPos, const model::Position& endPos){
+        STRATEGO_TRACE_SCOPE("RuleModel::moveAttack");
+        play<MOVE_ATTACK>(startPos, endPos);
+    }
+
+    template<class Rules>
+    void RuleModel<Rules>::nextPlayer(){
+        STRATEGO_TRACE_SCOPE("RuleModel::nextPlayer");
+        STRATEGO_ALLOC_PHASE(TURN);
+        STRATEGO_ALLOC_SUBSYSTEM(MODEL);
+        swapPlayer();
+    }
+
+    template<class Rules>
+    bool RuleModel<Rules>::canMove(const model::Piece& piece, const model::Position& pos) const noexcept{
+        return piece.canMove<Rules>(pos);
+    }
+
+    template<class Rules>
+    template<typename RuleModel<Rules>::Order order>
+    void RuleModel<Rules>::play(const model::Position& startPos, const model::Position& endPos){
+        STRATEGO_ALLOC_PHASE(TURN);
+        STRATEGO_ALLOC_SUBSYSTEM(MODEL);
+        if(!graph_.canConsume(model::StateGraph::ACT) || !graph_.canConsume(model::StateGraph::FACT)){
+            throw std::logic_error("Current model's state doesn't allow this method to be called");
+        }
+
+        model::Piece* piece;
+        if((piece = board_.getPiece(startPos))){
+            if(piece -> color() == currentPlayer().color()){
+                actionStart_ = startPos;
+                // l'action vérifie sa légalité une seule fois (cf. Piece::move() et Piece::attack())
+                bool attack {order == ATTACK || (order == MOVE_ATTACK && board_.getPiece(endPos))};
+                counters().add(attack ? perf::ATTACKS : perf::MOVES);
+                counters().add(perf::LEGALITY_CHECKS);
+                if(attack){
+                    piece -> attack(endPos);
+                } else{
+                    piece -> template move<Rules>(endPos);
+                }
+            } else{
+                history_.addFailure("La pièce indiquée ne vous appartient pas.");
+                history_.addHint(std::string{"Sélectionnez une pièce "} + (currentPlayer().color() == model::Color::RED ? "rouge" : "bleu")
+                                 + " face visible.");
+                graph_.consume(model::StateGraph::FACT);
+                notifyObservers({this});
+            }
+        } else{
+            history_.addFailure("Aucune pièce ne se trouve à la position de départ indiquée.");
+            history_.addHint("La case sélectionné est vide");
+            graph_.consume(model::StateGraph::FACT);
+            notifyObservers({this});
+        }
+    }
+
+    /**
+     * Modèle de jeu pour jouer à la version classique de Stratego.
+     */
+    using Stratego = RuleModel<model::ClassicRules>;
+
     /**
      * Modèle de jeu pour joueur à la variante Reveal de Stratego. Dans cette version,
      * l'attaque d'un pion de force supérieur révèlera son identité jusqu'à la fin
      * de la partie. Une fois l'attaque terminé le pion attaqué restera visible pour les deux
      * joueurs.
      */
-    class StrategoReveal : public ModelAdapter{
-
-        public:
-
-            /**
-             * Construit une variante du modèle de jeu.
-             */
-            StrategoReveal();
-
-
-            // --- Déjà documenté ---
-            void move(const model::Position& startPos, const model::Position& endPos) override;
-            void attack(const model::Position& startPos, const model::Position& endPos) override;
-            void moveAttack(const model::Position& startPos, const model::Position& endPos) override;
-            void nextPlayer() override;
-    };
+    using StrategoReveal = RuleModel<model::RevealRules>;
 };
 
 
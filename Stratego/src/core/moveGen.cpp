@@ -0,0 +1,288 @@
+#include "moveGen.h"
+
+using namespace stratego::model;
+
+namespace{
+
+    bool isMovable(int rank) noexcept{
+        return rank != stratego::Config::PIECE_FLAG_INFO.rank && rank != stratego::Config::PIECE_BOMB_INFO.rank;
+    }
+
+    /*
+     * Reproduit les prédicats de victoire des pions (cf. constructeurs des sous-classes de Piece).
+     */
+    bool wins(int crank, int orank) noexcept{
+        return crank > orank ||
+               (crank == stratego::Config::PIECE_MINER_INFO.rank && orank == stratego::Config::PIECE_BOMB_INFO.rank) ||
+               (crank == stratego::Config::PIECE_SPY_INFO.rank && orank == stratego::Config::PIECE_MARSHAL_INFO.rank);
+    }
+}
+
+template<class Variant, class Rules>
+BasicMoveGen<Variant, Rules>::BasicMoveGen(const Layout& red, const Layout& blue) :
+    cells_ {},
+    pieces_ {},
+    lastMoved_ {-1, -1},
+    history_ {},
+    turn_ {Color::RED}
+{
+    if(!Topology::isArmy(red) || !Topology::isArmy(blue))
+        throw std::invalid_argument("The given layout is not a complete army");
+
+    for(int square = 0; square < SQUARES; square++)
+        cells_[square] = Topology::WALKABLE[square] ? EMPTY : BLOCKED;
+
+    int index {};
+    for(auto [layout, color] : {std::pair{&red, Color::RED}, std::pair{&blue, Color::BLUE}}){
+        for(int slot = 0; slot < Topology::SLOTS; slot++){
+            int rank {(*layout)[slot]};
+            if(rank == Topology::EMPTY_SLOT)
+                continue;
+
+            int square {Topology::setupSquare(color, slot)};
+            pieces_[index] = {static_cast<std::int8_t>(rank), color, static_cast<std::uint8_t>(square), 0, 0, true, false};
+            cells_[square] = static_cast<std::int8_t>(index++);
+        }
+    }
+
+    history_.reserve(256);
+}
+
+template<class Variant, class Rules>
+BasicMoveGen<Variant, Rules>::BasicMoveGen(const Snapshot& snapshot, Color turn) :
+    cells_ {},
+    pieces_ {},
+    lastMoved_ {-1, -1},
+    history_ {},
+    turn_ {turn}
+{
+    std::array<int, 2> counts {};
+    for(int square = 0; square < SQUARES; square++){
+        cells_[square] = Topology::WALKABLE[square] ? EMPTY : BLOCKED;
+        const Occupant& occupant {snapshot[square]};
+        if(occupant.rank == Topology::EMPTY_SLOT)
+            continue;
+
+        int& count {counts[occupant.color == Color::RED ? 0 : 1]};
+        if(!Topology::WALKABLE[square] || count == Topology::ARMY_SIZE)
+            throw std::invalid_argument("The given snapshot is not a valid position");
+
+        int index {counts[0] + counts[1]};
+        pieces_[index] = {occupant.rank, occupant.color, static_cast<std::uint8_t>(square), 0, 0, true, false};
+        cells_[square] = static_cast<std::int8_t>(index);
+        count++;
+    }
+
+    history_.reserve(256);
+}
+
+template<class Variant, class Rules>
+Color BasicMoveGen<Variant, Rules>::turn() const noexcept{
+    return turn_;
+}
+
+template<class Variant, class Rules>
+int BasicMoveGen<Variant, Rules>::generate(MoveList& moves) const noexcept{
+    int count {};
+    for(int square = Topology::SIZE; square < SQUARES - Topology::SIZE; square++){
+        std::int8_t index {cells_[square]};
+        if(index < 0)
+            continue;
+
+        const PieceState& piece {pieces_[index]};
+        if(piece.color != turn_ || !isMovable(piece.rank))
+            continue;
+
+        bool scout {piece.rank == Config::PIECE_SCOUT_INFO.rank};
+        for(int dir : Topology::DIRECTIONS){
+            int to {square + dir};
+            for(int distance {1}; ; distance++){
+                std::int8_t target {cells_[to]};
+                if(target >= 0){
+                    if(pieces_[target].color != piece.color)
+                        moves[count++] = {static_cast<std::uint8_t>(square), static_cast<std::uint8_t>(to)};
+                    break;
+                }
+                if(target == BLOCKED)
+                    break;
+                if(distance <= Rules::SCOUT_RANGE && canMove(piece, to))
+                    moves[count++] = {static_cast<std::uint8_t>(square), static_cast<std::uint8_t>(to)};
+                if(!scout)
+                    break;
+
+                to += dir;
+            }
+        }
+    }
+
+    return count;
+}
+
+template<class Variant, class Rules>
+void BasicMoveGen<Variant, Rules>::make(const Move& move){
+    std::int8_t mover {cells_[move.from]};
+    std::int8_t target {cells_[move.to]};
+    Undo undo {move, mover, target, pieces_[mover], {}, lastMoved_, {}};
+    if(target >= 0)
+        undo.targetState = pieces_[target];
+    for(int c = 0; c < 2; c++){
+        if(lastMoved_[c] >= 0)
+            undo.lastMovedState[c] = pieces_[lastMoved_[c]];
+    }
+    history_.push_back(undo);
+
+    // règle des allers-retours (cf. Piece::move() et Piece::attack())
+    PieceState& piece {pieces_[mover]};
+    if(piece.recorded == 0){
+        piece.recorded = move.from;
+    } else if(move.to == piece.recorded){
+        piece.bnf++;
+    } else if(move.from != piece.recorded){
+        piece.bnf = 0;
+        piece.recorded = move.from;
+    }
+
+    cells_[move.from] = EMPTY;
+    if(target < 0){
+        cells_[move.to] = mover;
+        piece.square = move.to;
+    } else if(wins(piece.rank, pieces_[target].rank)){
+        pieces_[target].alive = false;
+        cells_[move.to] = mover;
+        piece.square = move.to;
+    } else{
+        piece.alive = false;
+        if(piece.rank == pieces_[target].rank){
+            pieces_[target].alive = false;
+            cells_[move.to] = EMPTY;
+        }
+    }
+
+    piece.moved = true;
+    notifyMoved(mover);
+    if(target >= 0)
+        notifyMoved(target);
+
+    turn_ = turn_ == Color::RED ? Color::BLUE : Color::RED;
+}
+
+template<class Variant, class Rules>
+void BasicMoveGen<Variant, Rules>::unmake(){
+    if(history_.empty())
+        throw std::logic_error("No move to undo");
+
+    const Undo& undo {history_.back()};
+    for(int c = 0; c < 2; c++){
+        if(undo.lastMoved[c] >= 0)
+            pieces_[undo.lastMoved[c]] = undo.lastMovedState[c];
+    }
+    if(undo.target >= 0)
+        pieces_[undo.target] = undo.targetState;
+
+    pieces_[undo.mover] = undo.moverState;
+    cells_[undo.move.from] = undo.mover;
+    cells_[undo.move.to] = undo.target;
+    lastMoved_ = undo.lastMoved;
+
+    turn_ = turn_ == Color::RED ? Color::BLUE : Color::RED;
+    history_.pop_back();
+}
+
+template<class Variant, class Rules>
+bool BasicMoveGen<Variant, Rules>::gameOver() const noexcept{
+    return hasLost(Color::RED) || hasLost(Color::BLUE) || !hasMobility(Color::RED) || !hasMobility(Color::BLUE);
+}
+
+template<class Variant, class Rules>
+bool BasicMoveGen<Variant, Rules>::hasWon(Color color) const noexcept{
+    Color opponent {color == Color::RED ? Color::BLUE : Color::RED};
+    return !hasLost(color) && (hasLost(opponent) || !hasMobility(opponent));
+}
+
+template<class Variant, class Rules>
+int BasicMoveGen<Variant, Rules>::rankAt(int square) const noexcept{
+    std::int8_t index {cells_[square]};
+    return index >= 0 ? pieces_[index].rank : Topology::EMPTY_SLOT;
+}
+
+template<class Variant, class Rules>
+Color BasicMoveGen<Variant, Rules>::colorAt(int square) const noexcept{
+    return pieces_[cells_[square]].color;
+}
+
+template<class Variant, class Rules>
+std::uint64_t BasicMoveGen<Variant, Rules>::perft(int depth){
+    if(depth == 0)
+        return 1;
+
+    MoveList moves;
+    int count {generate(moves)};
+    if(depth == 1)
+        return count;
+
+    std::uint64_t nodes {};
+    for(int i = 0; i < count; i++){
+        make(moves[i]);
+        if(!gameOver())
+            nodes += perft(depth - 1);
+        unmake();
+    }
+
+    return nodes;
+}
+
+template<class Variant, class Rules>
+bool BasicMoveGen<Variant, Rules>::canMove(const PieceState& piece, int to) const noexcept{
+    return piece.bnf < Rules::MAX_BNF || to != piece.recorded;
+}
+
+template<class Variant, class Rules>
+void BasicMoveGen<Variant, Rules>::notifyMoved(std::int8_t index) noexcept{
+    // reproduit Player::update(): déplacer un autre pion remet à zéro le compteur du dernier pion déplacé
+    const PieceState& piece {pieces_[index]};
+    if(!piece.moved)
+        return;
+
+    std::int8_t& last {lastMoved_[piece.color == Color::RED ? 0 : 1]};
+    if(last >= 0 && last != index)
+        pieces_[last].bnf = 0;
+
+    last = index;
+}
+
+template<class Variant, class Rules>
+bool BasicMoveGen<Variant, Rules>::hasLost(Color color) const noexcept{
+    bool flag {}, movable {};
+    for(const PieceState& piece : pieces_){
+        if(piece.alive && piece.color == color){
+            flag |= piece.rank == Config::PIECE_FLAG_INFO.rank;
+            movable |= isMovable(piece.rank);
+        }
+    }
+
+    return !flag || !movable;
+}
+
+template<class Variant, class Rules>
+bool BasicMoveGen<Variant, Rules>::hasMobility(Color color) const noexcept{
+    // comme ModelAdapter::pieceCanMove(), seules les cases adjacentes sont considérées
+    for(const PieceState& piece : pieces_){
+        if(!piece.alive || piece.color != color || !isMovable(piece.rank))
+            continue;
+
+        for(int to : Topology::NEIGHBOURS[piece.square]){
+            if(to < 0)
+                break;
+
+            std::int8_t target {cells_[to]};
+            if((target >= 0 && pieces_[target].color != color) || (target == EMPTY && canMove(piece, to)))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+template class stratego::model::BasicMoveGen<ClassicVariant>;
+template class stratego::model::BasicMoveGen<BarrageVariant>;
+template class stratego::model::BasicMoveGen<DuelVariant>;
@@ -0,0 +1,236 @@
+#ifndef MOVEGEN_H
+#define MOVEGEN_H
+
+#include <cstdint>
+
+#include "variant.h"
+
+namespace stratego::model {
+
+    /**
+     * Générateur de coups compact. Le plateau de jeu est représenté par un tableau de cases
+     * indexées (y * Topology::SIZE + x) référençant une table de pions, ce qui permet de jouer
+     * et d'annuler un coup sans allocation. La topologie du plateau et la composition des armées
+     * sont celles de la variante donnée, spécialisée à la compilation (cf. Topology). Les règles appliquées sont celles de Piece::canMove(),
+     * Piece::canAttack(), Piece::attack() et ModelAdapter::nextTurn() pour la politique de règles
+     * donnée, y compris la règle limitant les allers-retours (Rules::MAX_BNF) et sa remise à zéro
+     * par Player::update() lorsqu'un joueur déplace un autre pion, ainsi que la portée des
+     * éclaireurs (Rules::SCOUT_RANGE).
+     *
+     * Le joueur rouge joue en premier.
+     *
+     * @tparam Variant la variante de jeu (cf. ClassicVariant)
+     * @tparam Rules la politique de règles appliquée (cf. ClassicRules)
+     */
+    template<class Variant, class Rules = ClassicRules>
+    class BasicMoveGen{
+
+        public:
+
+            /**
+             * Constantes de topologie de la variante.
+             */
+            using Topology = model::Topology<Variant>;
+
+            /**
+             * Disposition d'une armée de la variante.
+             */
+            using Layout = typename Topology::Layout;
+
+            /**
+             * Coup d'un pion de la case de départ vers la case d'arrivée.
+             */
+            struct Move{
+                std::uint8_t from;
+                std::uint8_t to;
+            };
+
+            /**
+             * Nombre de cases du plateau de jeu.
+             */
+            static constexpr int SQUARES = Topology::SQUARES;
+
+            /**
+             * Nombre maximal de coups légaux d'un joueur.
+             */
+            static constexpr int MAX_MOVES = 512;
+
+            using MoveList = std::array<Move, MAX_MOVES>;
+
+            /**
+             * Pion occupant une case d'une position de partie en cours (rang Topology::EMPTY_SLOT
+             * si la case est vide).
+             */
+            struct Occupant{
+                std::int8_t rank;
+                Color color;
+            };
+
+            /**
+             * Position d'une partie en cours: occupant de chaque case du plateau de jeu.
+             */
+            using Snapshot = std::array<Occupant, SQUARES>;
+
+            /**
+             * Construit un générateur de coups depuis les dispositions des deux joueurs, placées
+             * comme le ferait LayoutParser.
+             *
+             * @throw std::invalid_argument si l'une des dispositions ne décrit pas une armée complète
+             * de la variante
+             *
+             * @param red la disposition du joueur rouge
+             * @param blue la disposition du joueur bleu
+             */
+            BasicMoveGen(const Layout& red, const Layout& blue);
+
+            /**
+             * Construit un générateur de coups depuis une position de partie en cours. L'historique des
+             * allers-retours de chaque pion n'étant pas connu, il repart de zéro.
+             *
+             * @throw std::invalid_argument si un pion occupe une case non praticable ou si une couleur
+             * compte plus de pions qu'une armée complète de la variante
+             *
+             * @param snapshot l'occupant de chaque case
+             * @param turn la couleur du joueur devant jouer
+             */
+            BasicMoveGen(const Snapshot& snapshot, Color turn);
+
+            /**
+             * Récupère la couleur du joueur devant jouer.
+             *
+             * @return la couleur du joueur devant jouer.
+             */
+            Color turn() const noexcept;
+
+            /**
+             * Génère l'ensemble des coups légaux du joueur devant jouer.
+             *
+             * @param moves la liste dans laquelle écrire les coups générés
+             * @return le nombre de coups générés.
+             */
+            int generate(MoveList& moves) const noexcept;
+
+            /**
+             * Joue le coup donné (supposé légal) et passe au joueur suivant.
+             *
+             * @param move le coup à jouer
+             */
+            void make(const Move& move);
+
+            /**
+             * Annule le dernier coup joué.
+             *
+             * @throw std::logic_error si aucun coup n'a été joué
+             */
+            void unmake();
+
+            /**
+             * Vérifie si la partie est terminée: un joueur a perdu son drapeau ou ses pions mobiles, ou
+             * l'un des joueurs ne peut plus bouger.
+             *
+             * @return true si la partie est terminée, false si non.
+             */
+            bool gameOver() const noexcept;
+
+            /**
+             * Vérifie si le joueur de couleur donnée a gagné la partie: la partie est terminée et son
+             * adversaire a perdu son drapeau, ses pions mobiles ou ne peut plus bouger.
+             *
+             * @param color la couleur du joueur
+             * @return true si le joueur a gagné, false si non.
+             */
+            bool hasWon(Color color) const noexcept;
+
+            /**
+             * Récupère le rang du pion occupant la case donnée.
+             *
+             * @param square l'indice de la case
+             * @return le rang du pion ou Topology::EMPTY_SLOT si la case ne contient aucun pion.
+             */
+            int rankAt(int square) const noexcept;
+
+            /**
+             * Récupère la couleur du pion occupant la case donnée (supposée occupée, cf. rankAt()).
+             *
+             * @param square l'indice de la case
+             * @return la couleur du pion.
+             */
+            Color colorAt(int square) const noexcept;
+
+            /**
+             * Compte le nombre de positions atteignables en exactement depth coups. Une partie terminée
+             * avant d'atteindre cette profondeur ne compte aucune position.
+             *
+             * @param depth la profondeur de recherche
+             * @return le nombre de positions feuilles.
+             */
+            std::uint64_t perft(int depth);
+
+            /**
+             * Convertit une position en indice de case.
+             *
+             * @param pos la position à convertir
+             * @return l'indice de case correspondant.
+             */
+            static constexpr int toSquare(const Position& pos) noexcept{
+                return Topology::toSquare(pos);
+            }
+
+            /**
+             * Convertit un indice de case en position.
+             *
+             * @param square l'indice de case à convertir
+             * @return la position correspondante.
+             */
+            static constexpr Position toPosition(int square) noexcept{
+                return Topology::toPosition(square);
+            }
+
+        private:
+
+            static constexpr std::int8_t EMPTY = -1;
+            static constexpr std::int8_t BLOCKED = -2;
+
+            struct PieceState{
+                std::int8_t rank;
+                Color color;
+                std::uint8_t square;
+                std::uint8_t recorded;
+                std::int8_t bnf;
+                bool alive;
+                bool moved;
+            };
+
+            struct Undo{
+                Move move;
+                std::int8_t mover;
+                std::int8_t target;
+                PieceState moverState;
+                PieceState targetState;
+                std::array<std::int8_t, 2> lastMoved;
+                std::array<PieceState, 2> lastMovedState;
+            };
+
+            std::array<std::int8_t, SQUARES> cells_;
+            std::array<PieceState, 2 * Topology::ARMY_SIZE> pieces_;
+            std::array<std::int8_t, 2> lastMoved_;
+            std::vector<Undo> history_;
+            Color turn_;
+
+            bool canMove(const PieceState& piece, int to) const noexcept;
+            void notifyMoved(std::int8_t index) noexcept;
+            bool hasLost(Color color) const noexcept;
+            bool hasMobility(Color color) const noexcept;
+    };
+
+    extern template class BasicMoveGen<ClassicVariant>;
+    extern template class BasicMoveGen<BarrageVariant>;
+    extern template class BasicMoveGen<DuelVariant>;
+
+    /**
+     * Générateur de coups des règles classiques.
+     */
+    using MoveGen = BasicMoveGen<ClassicVariant>;
+}
+
+#endif // MOVEGEN_H
@@ -0,0 +1,150 @@
+#include <cctype>
+
+#include "observation.h"
+#include "piece.h"
+
+using namespace stratego::model;
+
+namespace{
+
+    int colorIndex(Color color) noexcept{
+        return color == Color::RED ? 0 : 1;
+    }
+
+    void clearSquare(Observation& obs, int square) noexcept{
+        obs.ranks[square] = Observation::EMPTY;
+        obs.flags[square] = 0;
+    }
+
+    /*
+     * Le pion, impliqué dans un combat, est désormais connu des deux joueurs.
+     */
+    void revealSquare(Observation& obs, int square, const Piece& piece) noexcept{
+        obs.ranks[square] = static_cast<std::int8_t>(piece.rank());
+        obs.flags[square] |= Observation::REVEALED;
+    }
+}
+
+static_assert(Observation::RANK_SYMBOLS.size() == stratego::Config::PIECE_MAX_RANK + 1, "Each rank needs a symbol");
+
+/* ===== Observation ===== */
+
+std::string Observation::encode() const{
+    std::string cases {};
+    for(int y = 1; y < stratego::Config::BOARD_SIZE - 1; y++){
+        for(int x = 1; x < stratego::Config::BOARD_SIZE - 1; x++){
+            int rank {rankAt({x, y})};
+            if(has({x, y}, OWN))
+                cases += RANK_SYMBOLS[rank];
+            else if(!has({x, y}, ENEMY))
+                cases += '.';
+            else if(rank >= 0)
+                cases += static_cast<char>(std::tolower(static_cast<unsigned char>(RANK_SYMBOLS[rank])));
+            else
+                cases += has({x, y}, MOVED) ? '!' : '?';
+        }
+    }
+
+    return cases;
+}
+
+bool Observation::decode(std::string_view cases, Color viewer, Observation& obs) noexcept{
+    constexpr int width {stratego::Config::BOARD_SIZE - 2};
+    if(cases.size() != width * width)
+        return false;
+
+    Observation result {};
+    result.viewer = viewer;
+    result.ranks.fill(EMPTY);
+    for(int i = 0; i < width * width; i++){
+        int square {toSquare({i % width + 1, i / width + 1})};
+        char symbol {cases[i]};
+        size_t rank {RANK_SYMBOLS.find(static_cast<char>(std::toupper(static_cast<unsigned char>(symbol))))};
+        if(symbol == '.'){
+            continue;
+        } else if(symbol == '?' || symbol == '!'){
+            result.ranks[square] = UNKNOWN;
+            result.flags[square] = symbol == '!' ? ENEMY | MOVED : ENEMY;
+        } else if(rank == std::string_view::npos){
+            return false;
+        } else{
+            result.ranks[square] = static_cast<std::int8_t>(rank);
+            result.flags[square] = std::isupper(static_cast<unsigned char>(symbol)) ? OWN : ENEMY | REVEALED;
+        }
+    }
+
+    result.captured = obs.captured;
+    result.plies = obs.plies;
+    result.lastFrom = obs.lastFrom;
+    result.lastTo = obs.lastTo;
+    obs = result;
+    return true;
+}
+
+/* ===== ObservationBuilder ===== */
+
+ObservationBuilder::ObservationBuilder() noexcept : observations_ {}
+{
+    reset();
+}
+
+void ObservationBuilder::reset() noexcept{
+    for(Color color : {Color::RED, Color::BLUE}){
+        Observation& obs {observations_[colorIndex(color)]};
+        obs = {};
+        obs.viewer = color;
+        obs.ranks.fill(Observation::EMPTY);
+    }
+}
+
+void ObservationBuilder::place(const Piece& piece) noexcept{
+    int square {Observation::toSquare(piece.position())};
+    for(Observation& obs : observations_){
+        bool own {piece.color() == obs.viewer};
+        bool known {piece.knownBy(obs.viewer)};
+        obs.ranks[square] = static_cast<std::int8_t>(known ? piece.rank() : Observation::UNKNOWN);
+        obs.flags[square] = (own ? Observation::OWN : Observation::ENEMY) |
+                            (piece.knownBy(Color::RED) && piece.knownBy(Color::BLUE) ? Observation::REVEALED : 0) |
+                            (piece.hasMove() ? Observation::MOVED : 0);
+    }
+}
+
+void ObservationBuilder::move(const Position& from, const Position& to) noexcept{
+    int source {Observation::toSquare(from)}, target {Observation::toSquare(to)};
+    for(Observation& obs : observations_){
+        obs.ranks[target] = obs.ranks[source];
+        obs.flags[target] = obs.flags[source] | Observation::MOVED;
+        clearSquare(obs, source);
+        obs.plies++;
+        obs.lastFrom = static_cast<std::uint8_t>(source);
+        obs.lastTo = static_cast<std::uint8_t>(target);
+    }
+}
+
+void ObservationBuilder::combat(const Position& from, const Position& to, const Piece& attacker, const Piece& defender) noexcept{
+    int source {Observation::toSquare(from)}, target {Observation::toSquare(to)};
+    for(Observation& obs : observations_){
+        if(attacker.alive()){
+            obs.flags[target] = obs.flags[source] | Observation::MOVED;
+            revealSquare(obs, target, attacker);
+        } else if(defender.alive()){
+            revealSquare(obs, target, defender);
+        } else{
+            clearSquare(obs, target);
+        }
+
+        clearSquare(obs, source);
+        for(const Piece* piece : {&attacker, &defender}){
+            if(!piece -> alive())
+                obs.captured[colorIndex(piece -> color())][piece -> rank()]++;
+        }
+
+        obs.plies++;
+        obs.lastFrom = static_cast<std::uint8_t>(source);
+        obs.lastTo = static_cast<std::uint8_t>(target);
+    }
+}
+
+const Observation& ObservationBuilder::of(Color color) const noexcept{
+    return observations_[colorIndex(color)];
+}
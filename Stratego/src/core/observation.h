@@ -0,0 +1,214 @@
+#ifndef OBSERVATION_H
+#define OBSERVATION_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "gamestuff.h"
+
+/*========================================
+* Observations du plateau de jeu depuis
+* la perspective d'un joueur
+*=========================================
+*/
+
+namespace stratego::model {
+
+    /**
+     * Ce qu'un joueur sait légitimement de la partie: ses propres pions, la position des pions
+     * adverses, les rangs adverses révélés lors des combats, les pions ayant déjà bougé et les pions
+     * capturés. Les rangs adverses cachés n'y figurent jamais. La structure est de taille fixe et ne
+     * référence aucun pion, elle peut donc être copiée librement (entrée d'un joueur automatique).
+     *
+     * Les cases sont indexées (y * Config::BOARD_SIZE + x), comme le fait MoveGen.
+     */
+    struct Observation{
+
+        /**
+         * Nombre de cases du plateau de jeu.
+         */
+        static constexpr int SQUARES = Config::BOARD_SIZE * Config::BOARD_SIZE;
+
+        /**
+         * Rang d'une case ne contenant aucun pion.
+         */
+        static constexpr std::int8_t EMPTY = -1;
+
+        /**
+         * Rang d'un pion adverse dont l'identité n'a pas encore été révélée.
+         */
+        static constexpr std::int8_t UNKNOWN = -2;
+
+        /**
+         * Indicateurs associés à chaque case.
+         */
+        enum Flag : std::uint8_t{
+
+            /**
+             * La case contient un pion du joueur.
+             */
+            OWN = 1,
+
+            /**
+             * La case contient un pion adverse.
+             */
+            ENEMY = 2,
+
+            /**
+             * Le pion de la case s'est déjà déplacé (il n'est donc ni une bombe, ni le drapeau).
+             */
+            MOVED = 4,
+
+            /**
+             * L'identité du pion de la case est connue des deux joueurs.
+             */
+            REVEALED = 8
+        };
+
+        /**
+         * Symboles des rangs 0 à Config::PIECE_MAX_RANK dans la représentation textuelle d'une
+         * observation (cf. encode()).
+         */
+        static constexpr std::string_view RANK_SYMBOLS {"ABCDEFGHIJKL"};
+
+        /**
+         * Couleur du joueur dont c'est la perspective.
+         */
+        Color viewer;
+
+        /**
+         * Rang du pion de chaque case, EMPTY ou UNKNOWN.
+         */
+        std::array<std::int8_t, SQUARES> ranks;
+
+        /**
+         * Combinaison d'indicateurs (Flag) de chaque case.
+         */
+        std::array<std::uint8_t, SQUARES> flags;
+
+        /**
+         * Nombre de pions capturés par couleur (rouge puis bleu) puis par rang.
+         */
+        std::array<std::array<std::uint8_t, Config::PIECE_MAX_RANK + 1>, Config::PLAYER_COUNT> captured;
+
+        /**
+         * Nombre d'actions (déplacements et attaques) observées depuis le début de la partie.
+         */
+        int plies;
+
+        /**
+         * Cases de départ et d'arrivée de la dernière action observée (0 si aucune).
+         */
+        std::uint8_t lastFrom, lastTo;
+
+        /**
+         * Convertit une position en indice de case.
+         *
+         * @param pos la position à convertir
+         * @return l'indice de case correspondant.
+         */
+        static constexpr int toSquare(const Position& pos) noexcept{
+            return pos.y * Config::BOARD_SIZE + pos.x;
+        }
+
+        /**
+         * Récupère le rang du pion se trouvant à la position donnée.
+         *
+         * @param pos la position du pion
+         * @return le rang du pion, EMPTY si la case est vide ou UNKNOWN si le pion adverse est caché.
+         */
+        int rankAt(const Position& pos) const noexcept{
+            return ranks[toSquare(pos)];
+        }
+
+        /**
+         * Vérifie si la case de la position donnée possède l'indicateur donné.
+         *
+         * @param pos la position de la case
+         * @param flag l'indicateur à vérifier
+         * @return true si la case possède l'indicateur, false si non.
+         */
+        bool has(const Position& pos, Flag flag) const noexcept{
+            return flags[toSquare(pos)] & flag;
+        }
+
+        /**
+         * Représente les cases jouables du plateau de jeu, ligne par ligne depuis la ligne 1, telles
+         * que les voit le joueur: un symbole de RANK_SYMBOLS pour un pion propre, ce même symbole en
+         * minuscule pour un pion adverse révélé, '?' pour un pion adverse caché, '!' pour un pion
+         * adverse caché s'étant déjà déplacé et '.' pour une case vide.
+         *
+         * @return la représentation textuelle des cases.
+         */
+        std::string encode() const;
+
+        /**
+         * Reconstruit les cases d'une observation depuis leur représentation textuelle (cf. encode()).
+         * Les pions capturés et les actions observées ne sont pas modifiés.
+         *
+         * @param cases la représentation textuelle des cases
+         * @param viewer la couleur du joueur dont c'est la perspective
+         * @param obs l'observation reconstruite
+         * @return true si la représentation est valide, false si non.
+         */
+        static bool decode(std::string_view cases, Color viewer, Observation& obs) noexcept;
+    };
+
+    /**
+     * Construit de manière incrémentale les observations des deux joueurs: chaque action jouée
+     * met à jour les seules cases concernées au lieu de recopier le plateau de jeu.
+     */
+    class ObservationBuilder{
+
+        std::array<Observation, Config::PLAYER_COUNT> observations_;
+
+        public:
+
+            /**
+             * Construit des observations vides.
+             */
+            ObservationBuilder() noexcept;
+
+            /**
+             * Vide les observations des deux joueurs.
+             */
+            void reset() noexcept;
+
+            /**
+             * Ajoute le pion donné, posé sur le plateau de jeu, aux observations.
+             *
+             * @param piece le pion à ajouter
+             */
+            void place(const Piece& piece) noexcept;
+
+            /**
+             * Enregistre le déplacement d'un pion entre les deux positions données.
+             *
+             * @param from la position de départ
+             * @param to la position d'arrivée
+             */
+            void move(const Position& from, const Position& to) noexcept;
+
+            /**
+             * Enregistre l'issue d'un combat: les deux pions sont révélés, le ou les perdants sont
+             * retirés et comptabilisés comme capturés.
+             *
+             * @param from la position de départ de l'attaquant
+             * @param to la position du défenseur
+             * @param attacker le pion attaquant
+             * @param defender le pion attaqué
+             */
+            void combat(const Position& from, const Position& to, const Piece& attacker, const Piece& defender) noexcept;
+
+            /**
+             * Récupère l'observation du joueur de couleur donnée.
+             *
+             * @param color la couleur du joueur
+             * @return l'observation du joueur.
+             */
+            const Observation& of(Color color) const noexcept;
+    };
+}
+
+#endif // OBSERVATION_H
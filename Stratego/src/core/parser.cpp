@@ -2,87 +2,191 @@
 #include "piece.h"
 #include "util.h"
 #include "pieceFactory.h"
+#include "variant.h"
 
-#include <regex>
+#include <mutex>
 
 using namespace stratego::model;
 
-ConfigFileParser::ConfigFileParser(ParseInfo& info, const std::string& filename) :
-    file_ {filename},
+namespace{
+
+    /*
+     * Entrée du cache de validation des fichiers de configuration. La date de modification est
+     * conservée à la nanoseconde: un fichier réécrit dans la même seconde, avec la même taille,
+     * doit être revalidé. L'inode distingue un fichier remplacé (renommage) de l'original.
+     */
+    struct ValidationEntry{
+        dev_t device;
+        ino_t inode;
+        off_t size;
+        time_t seconds;
+        long nanoseconds;
+        bool valid;
+
+        bool matches(const struct stat& info) const noexcept;
+    };
+
+    long modificationNanoseconds(const struct stat& info) noexcept{
+#if defined __APPLE__
+        return info.st_mtimespec.tv_nsec;
+#elif defined __unix__
+        return info.st_mtim.tv_nsec;
+#else
+        return 0;
+#endif
+    }
+
+    bool ValidationEntry::matches(const struct stat& info) const noexcept{
+        return device == info.st_dev && inode == info.st_ino && size == info.st_size
+               && seconds == info.st_mtime && nanoseconds == modificationNanoseconds(info);
+    }
+
+    std::mutex validationMutex {};
+    std::map<std::string, ValidationEntry> validationCache {};
+
+    bool isSeparator(char c) noexcept{
+        return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+}
+
+/* ========================== LayoutParser =========================== */
+LayoutParser::LayoutParser(ParseInfo& info, const Layout& layout) noexcept :
+    layout_ {layout},
     result_ {},
     info_ {info}
-{
-    if(file_.fail())
-        throw std::invalid_argument("Cannot open the given file");
+{}
+
+LayoutParser::LayoutParser(ParseInfo& info) noexcept :
+    layout_ {},
+    result_ {},
+    info_ {info}
+{}
+
+bool LayoutParser::isArmy(const Layout& layout) noexcept{
+    return Topology<ClassicVariant>::isArmy(layout);
 }
 
-void ConfigFileParser::parse(){
+void LayoutParser::parse(){
     if(!canParse())
         throw std::logic_error("Your file cannot be parsed");
 
-    file_.clear();
-    file_.seekg(0);
     result_.clear();
-
-    std::string line {};
-    std::smatch matcher {};
-    std::regex regex {"(10|[1-9]|D|B)" + util::strrepeat("[[:space:]]+(10|[1-9]|D|B)", 9)};
+    int width {Config::BOARD_SIZE - 2};
     int y {info_.color == Color::RED ? info_.board.size() - 2 : 1};
-    while(std::getline(file_, line) && std::regex_match(line, matcher, regex)){
-        for(int x = 1; x < 11; x++){
-            int rank = Piece::toRank(matcher[x].str());
-            result_.push_back(toPiece(rank, x, y));
+    for(int row = 0; row < ROWS; row++){
+        for(int x = 1; x <= width; x++){
+            result_.push_back(toPiece(layout_[row * width + x - 1], x, y));
         }
 
         y += info_.color == Color::RED ? -1 : 1;
     }
 }
 
+bool LayoutParser::canParse() noexcept{
+    return isArmy(layout_);
+}
+
+std::vector<Piece*>& LayoutParser::result() noexcept{
+    return result_;
+}
+
+Piece* LayoutParser::toPiece(int rank, int x, int y) const{
+    Piece* piece {};
+
+    PieceFactory pfactory {};
+    piece = pfactory.createPiece(rank, {x, y}, info_.color, info_.board, info_.graph, info_.hist);
+    return piece;
+}
+
+
+/* ========================== ConfigFileParser =========================== */
+ConfigFileParser::ConfigFileParser(ParseInfo& info, const std::string& filename) :
+    LayoutParser {info},
+    file_ {filename},
+    status_ {UNKNOWN}
+{}
+
 bool ConfigFileParser::canParse() noexcept{
-    file_.clear();
-    file_.seekg(0);
+    if(status_ == UNKNOWN)
+        status_ = decode(file_.content(), layout_) ? VALID : INVALID;
+
+    return status_ == VALID;
+}
+
+const ConfigFileParser::Layout& ConfigFileParser::layout(){
+    if(!canParse())
+        throw std::logic_error("Your file cannot be parsed");
 
-    return canParse(file_);
+    return layout_;
 }
 
 bool ConfigFileParser::canParse(std::ifstream& file_){
-    std::string line {};
-    std::map<int, int> hist {};
-    std::smatch matcher {};
-    std::regex regex {"(10|[1-9]|D|B)" + util::strrepeat("[[:space:]]+(10|[1-9]|D|B)", 9)};
-
-    while(std::getline(file_, line) && std::regex_match(line, matcher, regex)){
-        for(int i = 1; i < 11; i++){
-            int rank = Piece::toRank(matcher[i].str());
-            if(rank < Config::PIECE_MIN_RANK || rank > Config::PIECE_MAX_RANK)
-                return false;
+    std::string content {std::istreambuf_iterator<char>{file_}, std::istreambuf_iterator<char>{}};
+    Layout layout {};
+    return decode(content, layout);
+}
 
-            hist[rank] = hist.find(rank) != hist.end() ? hist[rank] + 1 : 1;
-        }
-    }
+bool ConfigFileParser::canParseFile(const std::string& filepath){
+    struct stat info {};
+    if(stat(filepath.c_str(), &info) == -1)
+        return false;
 
-    if(line.empty()){
-        for(const auto& [key, value] : hist){
-            int count {Piece::pieceInfo[key].count};
-            if(value != count){
-                return false;
-            }
-        }
+    {
+        std::lock_guard<std::mutex> lock {validationMutex};
+        auto it {validationCache.find(filepath)};
+        if(it != validationCache.end() && it -> second.matches(info))
+            return it -> second.valid;
+    }
 
-        return true;
+    bool valid {};
+    try{
+        util::MappedFile file {filepath};
+        Layout layout {};
+        valid = decode(file.content(), layout);
+    } catch(std::invalid_argument&){
+        return false;
     }
 
-    return false;
+    std::lock_guard<std::mutex> lock {validationMutex};
+    validationCache[filepath] = {info.st_dev, info.st_ino, info.st_size, info.st_mtime, modificationNanoseconds(info), valid};
+    return valid;
 }
 
-std::vector<Piece*>& ConfigFileParser::result() noexcept{
-    return result_;
-}
+bool ConfigFileParser::decode(std::string_view content, Layout& layout) noexcept{
+    int width {Config::BOARD_SIZE - 2};
+    int count {};
+    size_t i {};
+
+    while(i < content.size()){
+        size_t end {std::min(content.find('\n', i), content.size())};
+        std::string_view line {content.substr(i, end - i)};
+        i = end + 1;
+
+        int tokens {};
+        size_t j {};
+        while(j < line.size()){
+            while(j < line.size() && isSeparator(line[j])) j++;
+            size_t begin {j};
+            while(j < line.size() && !isSeparator(line[j])) j++;
+            if(begin == j)
+                break;
+
+            int rank;
+            if(count + tokens == Config::ARMY_SIZE || tokens == width || !Piece::tryToRank(line.substr(begin, j - begin), rank))
+                return false;
 
-Piece* ConfigFileParser::toPiece(int rank, int x, int y) const{
-    Piece* piece {};
+            layout[count + tokens] = rank;
+            ++tokens;
+        }
 
-    PieceFactory pfactory {};
-    piece = pfactory.createPiece(rank, {x, y}, info_.color, info_.board, info_.graph, info_.hist);
-    return piece;
+        if(tokens == 0 && count < Config::ARMY_SIZE) // ligne vide avant la fin de l'armée
+            return false;
+        if(tokens != 0 && tokens != width)
+            return false;
+
+        count += tokens;
+    }
+
+    return count == Config::ARMY_SIZE && isArmy(layout);
 }
+
@@ -0,0 +1,27 @@
+#include "perf.h"
+
+using namespace stratego;
+
+perf::Counters::Counters() noexcept :
+    values_ {},
+    mutex_ {},
+    baseline_ {},
+    resetTime_ {std::chrono::steady_clock::now()}
+{}
+
+perf::Snapshot perf::Counters::snapshot() const noexcept{
+    std::array<std::uint64_t, COUNTER_COUNT> values {};
+    std::lock_guard<std::mutex> lock {mutex_};
+    for(int i = 0; i < COUNTER_COUNT; i++)
+        values[i] = values_[i].load(std::memory_order_relaxed) - baseline_[i];
+
+    return {values, std::chrono::duration<double>(std::chrono::steady_clock::now() - resetTime_).count()};
+}
+
+void perf::Counters::reset() noexcept{
+    // les compteurs ne sont écrits que par le thread de la partie: la remise à zéro mémorise leur valeur
+    std::lock_guard<std::mutex> lock {mutex_};
+    for(int i = 0; i < COUNTER_COUNT; i++)
+        baseline_[i] = values_[i].load(std::memory_order_relaxed);
+    resetTime_ = std::chrono::steady_clock::now();
+}
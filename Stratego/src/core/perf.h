@@ -0,0 +1,178 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+/*========================================
+* Compteurs de performance toujours actifs
+* d'un modèle de jeu
+*=========================================
+*/
+
+namespace stratego::perf {
+
+    /**
+     * Regroupe l'ensemble des compteurs de performance.
+     */
+    enum Counter{
+
+        /**
+         * Nombre de déplacements demandés au modèle.
+         */
+        MOVES,
+
+        /**
+         * Nombre d'attaques demandées au modèle.
+         */
+        ATTACKS,
+
+        /**
+         * Nombre de vérifications de légalité (Piece::canMove() et Piece::canAttack()), comptées
+         * une fois par action ou par génération de coups.
+         */
+        LEGALITY_CHECKS,
+
+        /**
+         * Nombre de notifications reçues par les observateurs.
+         */
+        NOTIFICATIONS,
+
+        /**
+         * Nombre d'entrées ajoutées aux historiques.
+         */
+        HISTORY_ENTRIES,
+
+        /**
+         * Nombre de rendus réalisés par les vues.
+         */
+        RENDERS,
+
+        /**
+         * Temps passé dans les rendus, en nanosecondes.
+         */
+        RENDER_NANOS,
+
+        COUNTER_COUNT
+    };
+
+    /**
+     * Tableau de noms permettant de récupérer la valeur textuelle d'un compteur.
+     */
+    constexpr std::array<std::string_view, COUNTER_COUNT> counterNames {
+        "moves", "attacks", "legality checks", "notifications", "history entries", "renders", "render time (ns)"
+    };
+
+    /**
+     * Valeurs des compteurs depuis la dernière remise à zéro.
+     */
+    struct Snapshot{
+
+        /**
+         * Valeur de chaque compteur, indexée par Counter.
+         */
+        std::array<std::uint64_t, COUNTER_COUNT> values;
+
+        /**
+         * Temps écoulé depuis la dernière remise à zéro, en secondes.
+         */
+        double elapsed;
+
+        /**
+         * Calcule le débit du compteur donné.
+         *
+         * @param counter le compteur
+         * @return le nombre d'occurrences par seconde depuis la dernière remise à zéro.
+         */
+        double rate(Counter counter) const noexcept{
+            return elapsed > 0 ? values[counter] / elapsed : 0;
+        }
+    };
+
+    /**
+     * Compteurs de performance d'un modèle de jeu (cf. Model::counters()). Les compteurs ne sont
+     * incrémentés que par le thread jouant la partie, sans contention; ils peuvent être lus et remis
+     * à zéro depuis n'importe quel thread.
+     */
+    class Counters{
+
+        std::array<std::atomic<std::uint64_t>, COUNTER_COUNT> values_;
+        mutable std::mutex mutex_;
+        std::array<std::uint64_t, COUNTER_COUNT> baseline_;
+        std::chrono::steady_clock::time_point resetTime_;
+
+        public:
+
+            /**
+             * Construit des compteurs nuls.
+             */
+            Counters() noexcept;
+
+            Counters(const Counters&) = delete;
+            Counters& operator=(const Counters&) = delete;
+
+            /**
+             * Incrémente le compteur donné. Seul le thread jouant la partie incrémente les compteurs:
+             * une simple écriture atomique suffit.
+             *
+             * @param counter le compteur à incrémenter
+             * @param n la valeur à ajouter
+             */
+            void add(Counter counter, std::uint64_t n = 1) noexcept{
+                std::atomic<std::uint64_t>& value {values_[counter]};
+                value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+            }
+
+            /**
+             * Récupère la valeur des compteurs.
+             *
+             * @return les valeurs des compteurs depuis la dernière remise à zéro.
+             */
+            Snapshot snapshot() const noexcept;
+
+            /**
+             * Remet à zéro l'ensemble des compteurs.
+             */
+            void reset() noexcept;
+    };
+
+    /**
+     * Mesure la durée d'un rendu, depuis sa construction jusqu'à sa destruction, et l'ajoute aux
+     * compteurs RENDERS et RENDER_NANOS du modèle rendu.
+     */
+    class RenderTimer{
+
+        Counters& counters_;
+        std::chrono::steady_clock::time_point begin_;
+
+        public:
+
+            /**
+             * Débute la mesure d'un rendu.
+             *
+             * @param counters les compteurs du modèle rendu
+             */
+            RenderTimer(Counters& counters) noexcept :
+                counters_ {counters},
+                begin_ {std::chrono::steady_clock::now()}
+            {}
+
+            RenderTimer(const RenderTimer&) = delete;
+            RenderTimer& operator=(const RenderTimer&) = delete;
+
+            /**
+             * Termine la mesure du rendu.
+             */
+            ~RenderTimer() noexcept{
+                counters_.add(RENDERS);
+                counters_.add(RENDER_NANOS, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - begin_).count());
+            }
+    };
+}
+
+#endif // PERF_H
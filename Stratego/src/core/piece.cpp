@@ -1,7 +1,7 @@
 #include "piece.h"
+#include "trace.h"
 #include "util.h"
 
-#include <regex>
 
 using namespace stratego::model;
 using namespace stratego;
@@ -30,7 +30,7 @@ Piece::Piece(const PieceInfo& info, const Position& initPos, Color color, std::f
     observers_ {},
     color_ {color},
     info_ {info},
-    revealed_ {true},
+    knownBy_ {static_cast<std::uint8_t>(1u << static_cast<int>(color))},
     winPredicate_ {winPredicate},
     currentPos_ {initPos},
     graph_ {graph},
@@ -68,12 +68,8 @@ bool Piece::alive() const noexcept{
     return alive_;
 }
 
-bool Piece::revealed() const noexcept{
-    return revealed_;
-}
-
-void  Piece::setRevealed(bool state) noexcept{
-    revealed_ = state;
+bool Piece::knownBy(Color viewer) const noexcept{
+    return knownBy_ & (1u << static_cast<int>(viewer));
 }
 
 std::string_view& Piece::name() noexcept{
@@ -104,8 +100,9 @@ void Piece::resetCounter() noexcept{
     bnfCounter_ = 0;
 }
 
-void Piece::move(const Position& pos) noexcept{
-    if(!canMove(pos)){
+void Piece::moveTo(const Position& pos, bool legal) noexcept{
+    STRATEGO_TRACE_SCOPE("Piece::move");
+    if(!legal){
         hasMove_ = false;
         hist_.addFailure("Déplacement invalide. Référez vous aux règles pour en déterminer la cause.");
         hist_.addHint("Tapez RULES pour afficher les règles ou tapez PIECE <id> pour afficher la "
@@ -123,8 +120,7 @@ void Piece::move(const Position& pos) noexcept{
             }
         }
 
-        board_.getCell(currentPos_).piece = nullptr;
-        board_.getCell(pos).piece = this;
+        board_.move(currentPos_, pos);
         currentPos_ = pos;
         hasMove_ = true;
 
@@ -142,6 +138,7 @@ void Piece::move(const Position& pos) noexcept{
 }
 
 void Piece::attack(const Position &pos) noexcept{
+    STRATEGO_TRACE_SCOPE("Piece::attack");
     Piece* opponentPiece {};
     std::string explicitCause {};
     if(!canAttack(pos)){
@@ -165,19 +162,18 @@ void Piece::attack(const Position &pos) noexcept{
 
         opponentPiece = board_.getPiece(pos);
         if(winPredicate_(info_.rank, opponentPiece -> info_.rank)){ // win battle
-            board_.getCell(currentPos_).piece = nullptr;
-            board_.getCell(pos).piece = this;
+            board_.move(currentPos_, pos);
             opponentPiece -> alive_ = false;
             currentPos_ = pos;
             explicitCause.append("Le pion " + std::string{info_.name} + " du joueur "
                                  + (color_ == Color::RED ? "rouge" : "bleu")
                                  + " a gagné le combat.");
         } else{ // lose or draw
-            board_.getCell(currentPos_).piece = nullptr;
+            board_.remove(currentPos_);
             alive_ = false;
 
             if(opponentPiece -> info_.rank == info_.rank){ // draw
-                board_.getCell(pos).piece = nullptr;
+                board_.remove(pos);
                 opponentPiece -> alive_ = false;
                 explicitCause.append("Les deux pions de rang égal on perdu.");
             } else{
@@ -198,19 +194,18 @@ void Piece::attack(const Position &pos) noexcept{
         graph_.consume(StateGraph::ACT);
         hasBeenInCombat_ = true;
         opponentPiece -> hasBeenInCombat_ = true;
-        opponentPiece -> revealed_ = true;
-        revealed_ = true;
+        opponentPiece -> knownBy_ |= knownBy_;
+        knownBy_ |= opponentPiece -> knownBy_;
         hasMove_ = true;
     }
 
     notifyObservers({this, opponentPiece});
 }
 
-bool Piece::canMove(const Position &pos) const noexcept{
+bool Piece::canReach(const Position &pos) const noexcept{
     return isMovable_ &&
         board_.isInside(pos) &&
-        board_.walkableCell(pos) &&
-        (bnfCounter_ < Config::MAX_BNF || (bnfCounter_ >= Config::MAX_BNF && !(pos == recordedPos_)));
+        board_.walkableCell(pos);
 }
 
 bool Piece::canAttack(const Position &pos) const noexcept{
@@ -220,19 +215,23 @@ bool Piece::canAttack(const Position &pos) const noexcept{
         board_.getPiece(pos) -> color() != color_;
 }
 
-int Piece::toRank(const std::string &str){
-    if(std::regex_match(str, std::regex{"( (10|[1-9]|D|B))", std::regex_constants::icase})){
+int Piece::toRank(std::string_view str){
+    int rank;
+    if(!tryToRank(str, rank))
         throw std::invalid_argument("Invalid string to convert to rank");
-    }
 
-    int result;
-    std::string op {str};
-    util::strtoupper(op);
-    if(op == std::string{Config::PIECE_FLAG_INFO.symbol}) result = Config::PIECE_FLAG_INFO.rank;
-    else if(op == std::string{Config::PIECE_BOMB_INFO.symbol}) result = Config::PIECE_BOMB_INFO.rank;
-    else result = std::stoi(op);
+    return rank;
+}
 
-    return result;
+bool Piece::tryToRank(std::string_view str, int& rank) noexcept{
+    for(int i = Config::PIECE_MIN_RANK; i <= Config::PIECE_MAX_RANK; i++){
+        if(util::striequals(str, pieceInfo[i].symbol)){
+            rank = i;
+            return true;
+        }
+    }
+
+    return false;
 }
 
 std::string Piece::description(int rank){
@@ -262,7 +261,12 @@ void Piece::removeObserver(Observer* obs) noexcept{
 
 }
 
+size_t Piece::observerCount() const noexcept{
+    return observers_.size();
+}
+
 void Piece::notifyObservers(std::initializer_list<Observable*> infos) const noexcept{
+    STRATEGO_TRACE_SCOPE("Piece::notifyObservers");
     for(auto& obs : observers_){
         obs -> update(infos);
     }
@@ -279,8 +283,8 @@ Marshal::Marshal(const Position& initPos, Color color, Board& board, StateGraph&
         hist}
 {}
 
-bool Marshal::canMove(const Position& pos) const noexcept{
-    return Piece::canMove(pos) &&
+bool Marshal::canReach(const Position& pos) const noexcept{
+    return Piece::canReach(pos) &&
         ((std::abs(currentPos_.y - pos.y) == 1 && currentPos_.x == pos.x) ||
         (std::abs(currentPos_.x - pos.x) == 1 && currentPos_.y == pos.y));
 }
@@ -303,8 +307,8 @@ General::General(const Position& initPos, Color color, Board& board, StateGraph&
         hist}
 {}
 
-bool General::canMove(const Position& pos) const noexcept{
-     return Piece::canMove(pos)&&
+bool General::canReach(const Position& pos) const noexcept{
+     return Piece::canReach(pos)&&
         ((std::abs(currentPos_.y - pos.y) == 1 && currentPos_.x == pos.x) ||
         (std::abs(currentPos_.x - pos.x) == 1 && currentPos_.y == pos.y));
 }
@@ -327,8 +331,8 @@ Colonel::Colonel(const Position& initPos, Color color, Board& board, StateGraph&
         hist}
 {}
 
-bool Colonel::canMove(const Position& pos) const noexcept{
-    return Piece::canMove(pos)&&
+bool Colonel::canReach(const Position& pos) const noexcept{
+    return Piece::canReach(pos)&&
         ((std::abs(currentPos_.y - pos.y) == 1 && currentPos_.x == pos.x) ||
         (std::abs(currentPos_.x - pos.x) == 1 && currentPos_.y == pos.y));
 }
@@ -351,8 +355,8 @@ Major::Major(const Position& initPos, Color color, Board& board, StateGraph& gra
         hist}
 {}
 
-bool Major::canMove(const Position& pos) const noexcept{
-    return Piece::canMove(pos)&&
+bool Major::canReach(const Position& pos) const noexcept{
+    return Piece::canReach(pos)&&
         ((std::abs(currentPos_.y - pos.y) == 1 && currentPos_.x == pos.x) ||
         (std::abs(currentPos_.x - pos.x) == 1 && currentPos_.y == pos.y));
 }
@@ -375,8 +379,8 @@ Captain::Captain(const Position& initPos, Color color, Board& board, StateGraph&
         hist}
 {}
 
-bool Captain::canMove(const Position& pos) const noexcept{
-    return Piece::canMove(pos) &&
+bool Captain::canReach(const Position& pos) const noexcept{
+    return Piece::canReach(pos) &&
         ((std::abs(currentPos_.y - pos.y) == 1 && currentPos_.x == pos.x) ||
         (std::abs(currentPos_.x - pos.x) == 1 && currentPos_.y == pos.y));
 }
@@ -399,8 +403,8 @@ Lieutenant::Lieutenant(const Position& initPos, Color color, Board& board, State
         hist}
 {}
 
-bool  Lieutenant::canMove(const Position& pos) const noexcept{
-    return Piece::canMove(pos)&&
+bool  Lieutenant::canReach(const Position& pos) const noexcept{
+    return Piece::canReach(pos)&&
         ((std::abs(currentPos_.y - pos.y) == 1 && currentPos_.x == pos.x) ||
         (std::abs(currentPos_.x - pos.x) == 1 && currentPos_.y == pos.y));
 }
@@ -423,8 +427,8 @@ Sergent::Sergent(const Position& initPos, Color color, Board& board, StateGraph&
         hist}
 {}
 
-bool Sergent::canMove(const Position& pos) const noexcept{
-    return Piece::canMove(pos)&&
+bool Sergent::canReach(const Position& pos) const noexcept{
+    return Piece::canReach(pos)&&
         ((std::abs(currentPos_.y - pos.y) == 1 && currentPos_.x == pos.x) ||
         (std::abs(currentPos_.x - pos.x) == 1 && currentPos_.y == pos.y));
 }
@@ -447,8 +451,8 @@ Miner::Miner(const Position& initPos, Color color, Board& board, StateGraph& gra
         hist}
 {}
 
-bool Miner::canMove(const Position& pos) const noexcept{
-    return Piece::canMove(pos) &&
+bool Miner::canReach(const Position& pos) const noexcept{
+    return Piece::canReach(pos) &&
         ((std::abs(currentPos_.y - pos.y) == 1 && currentPos_.x == pos.x) ||
         (std::abs(currentPos_.x - pos.x) == 1 && currentPos_.y == pos.y));
 }
@@ -471,8 +475,8 @@ Scout::Scout(const Position& initPos, Color color, Board& board, StateGraph& gra
         hist}
 {}
 
-bool Scout::canMove(const Position& pos) const noexcept{
-    if(!Piece::canMove(pos) ||
+bool Scout::canReach(const Position& pos) const noexcept{
+    if(!Piece::canReach(pos) ||
         (std::abs(currentPos_.x - pos.x) && currentPos_.y != pos.y) ||
         (std::abs(currentPos_.y - pos.y) && currentPos_.x != pos.x))
     {
@@ -549,8 +553,8 @@ Spy::Spy(const Position& initPos, Color color, Board& board, StateGraph& graph,
         hist}
 {}
 
-bool Spy::canMove(const Position& pos) const noexcept{
-    return Piece::canMove(pos)&&
+bool Spy::canReach(const Position& pos) const noexcept{
+    return Piece::canReach(pos)&&
         ((std::abs(currentPos_.y - pos.y) == 1 && currentPos_.x == pos.x) ||
         (std::abs(currentPos_.x - pos.x) == 1 && currentPos_.y == pos.y));
 }
@@ -575,8 +579,8 @@ Bomb::Bomb(const Position& initPos, Color color, Board& board, StateGraph& graph
     isMovable_ = false;
 }
 
-bool Bomb::canMove(const Position& pos) const noexcept{
-     return Piece::canMove(pos);
+bool Bomb::canReach(const Position& pos) const noexcept{
+     return Piece::canReach(pos);
 }
 
 bool Bomb::canAttack(const Position& pos) const noexcept{
@@ -597,8 +601,8 @@ Flag::Flag(const Position& initPos, Color color, Board& board, StateGraph& graph
     isMovable_ = false;
 }
 
-bool Flag::canMove(const Position& pos) const noexcept{
-    return Piece::canMove(pos);
+bool Flag::canReach(const Position& pos) const noexcept{
+    return Piece::canReach(pos);
 }
 
 bool Flag::canAttack(const Position& pos) const noexcept{
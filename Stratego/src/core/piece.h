@@ -33,7 +33,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -59,7 +59,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -85,7 +85,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -111,7 +111,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -137,7 +137,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -163,7 +163,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -189,7 +189,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -215,7 +215,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -242,7 +242,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -269,7 +269,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -295,7 +295,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 
@@ -322,7 +322,7 @@ namespace stratego::model{
 
 
             // --- Déjà documenté ---
-            bool canMove(const Position& pos) const noexcept;
+            bool canReach(const Position& pos) const noexcept;
             bool canAttack(const Position& pos) const noexcept;
     };
 };
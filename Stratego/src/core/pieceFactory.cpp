@@ -1,3 +1,4 @@
+#include "allocTracker.h"
 #include "pieceFactory.h"
 #include "piece.h"
 
@@ -6,6 +7,7 @@ using namespace stratego::model;
 PieceFactory::PieceFactory() noexcept{}
 
 Piece* PieceFactory::createPiece(int rank, const Position& initPos, Color color, Board& board, StateGraph& graph, History& hist) noexcept{
+    STRATEGO_ALLOC_SUBSYSTEM(PIECES);
     Piece* piece {};
     switch(rank){ // rank
         case Config::PIECE_BOMB_INFO.rank:
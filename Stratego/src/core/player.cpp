@@ -9,7 +9,8 @@ Player::Player(const PlayerInfo& info) noexcept:
     eatenPiecesCounter_ {},
     armyStat_ {},
     battleStat_ {},
-    lastMovedPiece_ {}
+    lastMovedPiece_ {},
+    clock_ {info.timeControl}
 {
     for(int i = Config::PIECE_MIN_RANK; i <= Config::PIECE_MAX_RANK; i++){
         armyStat_[i] = Piece::pieceInfo[i].count;
@@ -66,6 +67,14 @@ const std::map<int, int>& Player::stats() const noexcept{
     return armyStat_;
 }
 
+GameClock& Player::clock() noexcept{
+    return clock_;
+}
+
+const GameClock& Player::clock() const noexcept{
+    return clock_;
+}
+
 void Player::update(std::initializer_list<Observable*> args){
     Piece* p;
     for(Observable* obsv : args){
@@ -0,0 +1,127 @@
+#if defined __unix__ || defined __APPLE__
+    #include <dlfcn.h>
+#endif
+
+#include <cstring>
+
+#include "allocTracker.h"
+#include "pluginBot.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+static_assert(STRATEGO_SQUARES == Observation::SQUARES, "The plugin ABI must match the observation");
+static_assert(STRATEGO_RANKS == Config::PIECE_MAX_RANK + 1, "The plugin ABI must match the ranks");
+static_assert(STRATEGO_ARMY_SIZE == Config::ARMY_SIZE, "The plugin ABI must match the army size");
+static_assert(STRATEGO_OWN == +Observation::OWN && STRATEGO_ENEMY == +Observation::ENEMY &&
+              STRATEGO_MOVED == +Observation::MOVED && STRATEGO_REVEALED == +Observation::REVEALED,
+              "The plugin ABI must match the observation flags");
+
+namespace{
+
+    int32_t toAbi(Color color) noexcept{
+        return color == Color::RED ? STRATEGO_RED : STRATEGO_BLUE;
+    }
+
+    StrategoMove toAbi(const BotMove& move) noexcept{
+        return {static_cast<uint8_t>(Observation::toSquare(move.start)), static_cast<uint8_t>(Observation::toSquare(move.end))};
+    }
+}
+
+PluginBot::PluginBot(const StrategoBotApi& api, std::uint64_t seed, std::shared_ptr<void> library) :
+    library_ {std::move(library)},
+    api_ {&api},
+    bot_ {},
+    color_ {}
+{
+    if(api.abiVersion != STRATEGO_PLUGIN_ABI)
+        throw std::invalid_argument("The plugin was built for another ABI version");
+    if(!api.create || !api.destroy || !api.play)
+        throw std::invalid_argument("The plugin lacks a mandatory function");
+    if(!(bot_ = api.create(seed)))
+        throw std::runtime_error("The plugin cannot create a bot");
+}
+
+std::unique_ptr<PluginBot> PluginBot::load(const std::string& path, [[maybe_unused]] std::uint64_t seed){
+#if defined __unix__ || defined __APPLE__
+    void* handle {dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL)};
+    if(!handle)
+        throw std::runtime_error("Cannot load the plugin " + path + ": " + dlerror());
+
+    // la bibliothèque reste chargée tant qu'un bot l'utilise (dlopen compte les chargements)
+    std::shared_ptr<void> library {handle, [](void* h){ dlclose(h); }};
+    auto entry {reinterpret_cast<StrategoPluginEntry>(dlsym(handle, STRATEGO_PLUGIN_ENTRY))};
+    const StrategoBotApi* api {entry ? entry() : nullptr};
+    if(!api)
+        throw std::runtime_error("The library " + path + " is not a bot plugin");
+
+    return std::make_unique<PluginBot>(*api, seed, std::move(library));
+#else
+    throw std::runtime_error("Cannot load the plugin " + path + ": plugins are not supported on this platform");
+#endif
+}
+
+PluginBot::~PluginBot(){
+    api_ -> destroy(bot_);
+}
+
+void PluginBot::start(const Layout& layout, Color color){
+    color_ = color;
+    if(!api_ -> setup)
+        return;
+
+    int8_t army[STRATEGO_ARMY_SIZE];
+    for(int i = 0; i < STRATEGO_ARMY_SIZE; i++)
+        army[i] = static_cast<int8_t>(layout[i]);
+
+    api_ -> setup(bot_, toAbi(color), army);
+}
+
+BotMove PluginBot::play(const Model& model){
+    STRATEGO_ALLOC_SUBSYSTEM(BOT);
+    Color color {model.currentPlayer().color()};
+    color_ = color;
+    std::vector<BotMove> moves {legalMoves(model)};
+    if(moves.empty())
+        throw std::logic_error("The current player cannot move");
+
+    const Observation& obs {model.observation(color)};
+    StrategoObservation view {};
+    view.viewer = toAbi(obs.viewer);
+    view.plies = obs.plies;
+    std::memcpy(view.ranks, obs.ranks.data(), sizeof view.ranks);
+    std::memcpy(view.flags, obs.flags.data(), sizeof view.flags);
+    for(int c = 0; c < Config::PLAYER_COUNT; c++)
+        std::memcpy(view.captured[c], obs.captured[c].data(), sizeof view.captured[c]);
+    view.lastFrom = obs.lastFrom;
+    view.lastTo = obs.lastTo;
+
+    std::vector<StrategoMove> choices {};
+    choices.reserve(moves.size());
+    for(const BotMove& move : moves)
+        choices.push_back(toAbi(move));
+
+    GameClock::Duration budget {Bot::budget(model)};
+    int64_t micros {budget == GameClock::Duration::max() ? -1 :
+                    std::chrono::duration_cast<std::chrono::microseconds>(budget).count()};
+    int32_t index {api_ -> play(bot_, &view, choices.data(), static_cast<int32_t>(choices.size()), micros)};
+    if(index < 0 || index >= static_cast<int32_t>(moves.size()))
+        throw std::runtime_error("The plugin " + name() + " chose no legal move");
+
+    return moves[index];
+}
+
+void PluginBot::finish(GameOutcome outcome){
+    if(!api_ -> result || !color_)
+        return;
+
+    int32_t result {STRATEGO_DRAW};
+    if(outcome != GameOutcome::DRAW)
+        result = (outcome == GameOutcome::RED_WIN) == (*color_ == Color::RED) ? STRATEGO_WIN : STRATEGO_LOSS;
+
+    api_ -> result(bot_, result);
+}
+
+std::string PluginBot::name() const{
+    return api_ -> name ? api_ -> name : "plugin";
+}
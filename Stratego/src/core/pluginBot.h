@@ -0,0 +1,80 @@
+#ifndef PLUGINBOT_H
+#define PLUGINBOT_H
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "bot.h"
+#include "botPlugin.h"
+
+/*========================================
+* Bots chargés dynamiquement (plugins)
+*=========================================
+*/
+
+namespace stratego{
+
+    /**
+     * Joueur automatique délégant le choix de ses coups à un plugin: une bibliothèque partagée
+     * chargée dans le processus (dlopen) et exposant l'interface binaire C de botPlugin.h. Contrairement
+     * à EngineBot, aucun échange entre processus n'a lieu: un coup ne coûte qu'un appel de fonction.
+     *
+     * Le plugin ne choisit qu'un indice parmi les coups légaux qui lui sont donnés: il ne peut jouer
+     * un coup refusé par le modèle de jeu.
+     */
+    class PluginBot : public Bot{
+
+        std::shared_ptr<void> library_;
+        const StrategoBotApi* api_;
+        void* bot_;
+        std::optional<model::Color> color_;
+
+        public:
+
+            /**
+             * Construit un bot depuis les fonctions d'un plugin.
+             *
+             * @throw std::invalid_argument si les fonctions ne respectent pas l'interface binaire
+             * (version différente ou fonction obligatoire nulle)
+             * @throw std::runtime_error si le plugin ne peut créer d'instance
+             *
+             * @param api les fonctions du plugin
+             * @param seed la graine du bot
+             * @param library la bibliothèque fournissant les fonctions, maintenue chargée par le bot
+             */
+            PluginBot(const StrategoBotApi& api, std::uint64_t seed, std::shared_ptr<void> library = {});
+
+            PluginBot(const PluginBot&) = delete;
+
+            PluginBot& operator=(const PluginBot&) = delete;
+
+            /**
+             * Charge le plugin de chemin donné et en crée une instance. Disponible sous linux et apple
+             * uniquement.
+             *
+             * @throw std::runtime_error si la bibliothèque ne peut être chargée ou n'exporte pas
+             * STRATEGO_PLUGIN_ENTRY
+             * @throw std::invalid_argument si le plugin ne respecte pas l'interface binaire
+             *
+             * @param path le chemin de la bibliothèque partagée
+             * @param seed la graine du bot
+             * @return le bot créé.
+             */
+            static std::unique_ptr<PluginBot> load(const std::string& path, std::uint64_t seed);
+
+            /**
+             * Destructeur de PluginBot. Détruit l'instance du plugin.
+             */
+            ~PluginBot();
+
+
+            // --- Déjà documenté ---
+            void start(const model::Layout& layout, model::Color color) override;
+            BotMove play(const Model& model) override;
+            void finish(GameOutcome outcome) override;
+            std::string name() const override;
+    };
+}
+
+#endif // PLUGINBOT_H
@@ -0,0 +1,156 @@
+#include <algorithm>
+
+#include "beliefTracker.h"
+#include "searchEngine.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    constexpr int INFINITE = 2 * SearchEngine::WIN;
+
+    /*
+     * Valeur matérielle de chaque rang, indexée par rang (le drapeau est valorisé par la fin de partie).
+     */
+    constexpr std::array<int, Config::PIECE_MAX_RANK + 1> VALUES {0, 30, 10, 25, 15, 20, 30, 40, 60, 80, 100, 20};
+
+    MoveGen::Snapshot determinize(const Observation& obs, const BeliefTracker& beliefs){
+        MoveGen::Snapshot snapshot {};
+        std::array<int, MoveGen::Topology::ARMY_SIZE> hidden {};
+        int hiddenCount {};
+        for(int square = 0; square < MoveGen::SQUARES; square++){
+            Color color {obs.flags[square] & Observation::OWN ? obs.viewer : obs.viewer == Color::RED ? Color::BLUE : Color::RED};
+            snapshot[square] = {obs.ranks[square], color};
+            if(obs.ranks[square] == Observation::UNKNOWN)
+                hidden[hiddenCount++] = square;
+        }
+
+        std::array<int, BeliefTracker::RANKS> remaining {beliefs.remaining()};
+        for(int assigned = 0; assigned < hiddenCount; assigned++){
+            int bestSlot {-1}, bestRank {-1};
+            float bestProb {-1};
+            for(int i = 0; i < hiddenCount; i++){
+                if(snapshot[hidden[i]].rank != Observation::UNKNOWN)
+                    continue;
+
+                BeliefTracker::Distribution dist {beliefs.distribution(MoveGen::toPosition(hidden[i]))};
+                for(int rank = 0; rank < BeliefTracker::RANKS; rank++){
+                    if(dist[rank] > bestProb && (remaining[rank] > 0 || bestRank == -1)){
+                        bestSlot = i;
+                        bestRank = rank;
+                        bestProb = dist[rank];
+                    }
+                }
+            }
+
+            snapshot[hidden[bestSlot]].rank = static_cast<std::int8_t>(bestRank);
+            if(remaining[bestRank] > 0)
+                remaining[bestRank]--;
+        }
+
+        return snapshot;
+    }
+}
+
+SearchEngine::SearchEngine(const std::atomic<bool>& stop, Clock::time_point deadline) noexcept :
+    stop_ {stop},
+    deadline_ {deadline},
+    nodes_ {},
+    interrupted_ {false}
+{}
+
+MoveGen SearchEngine::position(const Observation& obs){
+    BeliefTracker beliefs {obs.viewer};
+    beliefs.reset(obs);
+    return MoveGen{determinize(obs, beliefs), obs.viewer};
+}
+
+int SearchEngine::evaluate(const MoveGen& gen) noexcept{
+    int score {};
+    for(int square = 0; square < MoveGen::SQUARES; square++){
+        int rank {gen.rankAt(square)};
+        if(rank != MoveGen::Topology::EMPTY_SLOT)
+            score += gen.colorAt(square) == gen.turn() ? VALUES[rank] : -VALUES[rank];
+    }
+
+    return score;
+}
+
+/* ===== Recherche ===== */
+
+std::optional<Hint> SearchEngine::search(MoveGen gen, int maxDepth, const Progress& progress, const std::vector<BotMove>* legal){
+    MoveGen::MoveList moves;
+    int count {gen.generate(moves)};
+    if(legal){
+        auto refused {[&](const MoveGen::Move& move){
+            return std::none_of(legal -> begin(), legal -> end(), [&](const BotMove& allowed){
+                return MoveGen::toSquare(allowed.start) == move.from && MoveGen::toSquare(allowed.end) == move.to;
+            });
+        }};
+        count = static_cast<int>(std::remove_if(moves.begin(), moves.begin() + count, refused) - moves.begin());
+    }
+    int bestIndex {};
+    std::optional<Hint> best {};
+    interrupted_ = false;
+    for(int depth = 1; depth <= maxDepth && count > 0; depth++){
+        // le meilleur coup de la profondeur précédente est examiné en premier
+        std::swap(moves[0], moves[bestIndex]);
+        int alpha {-INFINITE}, iterationBest {};
+        for(int i = 0; i < count && !interrupted(); i++){
+            gen.make(moves[i]);
+            int score {-negamax(gen, depth - 1, -INFINITE, -alpha)};
+            gen.unmake();
+            if(score > alpha){
+                alpha = score;
+                iterationBest = i;
+            }
+        }
+
+        if(interrupted_)
+            break;
+
+        bestIndex = iterationBest;
+        best = Hint{MoveGen::toPosition(moves[bestIndex].from), MoveGen::toPosition(moves[bestIndex].to), depth, alpha};
+        if(progress)
+            progress(*best);
+    }
+
+    return best;
+}
+
+int SearchEngine::negamax(MoveGen& gen, int depth, int alpha, int beta){
+    if(interrupted())
+        return 0;
+    if(gen.gameOver()){
+        Color opponent {gen.turn() == Color::RED ? Color::BLUE : Color::RED};
+        return gen.hasWon(gen.turn()) ? WIN + depth : gen.hasWon(opponent) ? -WIN - depth : 0;
+    }
+    if(depth == 0)
+        return evaluate(gen);
+
+    MoveGen::MoveList moves;
+    int count {gen.generate(moves)};
+    if(count == 0)
+        return evaluate(gen);
+
+    for(int i = 0; i < count; i++){
+        gen.make(moves[i]);
+        int score {-negamax(gen, depth - 1, -beta, -alpha)};
+        gen.unmake();
+        if(score >= beta)
+            return score;
+        if(score > alpha)
+            alpha = score;
+    }
+
+    return alpha;
+}
+
+bool SearchEngine::interrupted() noexcept{
+    if(!interrupted_)
+        interrupted_ = stop_.load(std::memory_order_relaxed) ||
+                       (++nodes_ % DEADLINE_PERIOD == 0 && deadline_ != Clock::time_point::max() && Clock::now() >= deadline_);
+
+    return interrupted_;
+}
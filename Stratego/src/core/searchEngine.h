@@ -0,0 +1,141 @@
+#ifndef SEARCHENGINE_H
+#define SEARCHENGINE_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <optional>
+
+#include "bot.h"
+#include "moveGen.h"
+#include "observation.h"
+
+namespace stratego{
+
+    /**
+     * Coup suggéré au joueur courant par le moteur de recherche.
+     */
+    struct Hint{
+
+        /**
+         * Position du pion à déplacer.
+         */
+        model::Position start;
+
+        /**
+         * Position d'arrivée du pion.
+         */
+        model::Position end;
+
+        /**
+         * Profondeur de recherche (en demi-coups) ayant produit la suggestion.
+         */
+        int depth;
+
+        /**
+         * Évaluation de la position après le coup, du point de vue du joueur courant.
+         */
+        int score;
+    };
+
+    /**
+     * Moteur de recherche synchrone: approfondissement itératif d'une recherche alpha-bêta
+     * (évaluation matérielle) sur une position compacte (cf. MoveGen). Le moteur ne référence aucun
+     * modèle de jeu, il peut donc être exécuté par n'importe quel thread sur une copie de la
+     * position, pendant que le modèle continue d'évoluer.
+     *
+     * L'indicateur d'arrêt donné est consulté à chaque nœud: le lever interrompt la recherche, le
+     * résultat de la dernière profondeur terminée étant conservé. Une échéance peut également être
+     * donnée (gestion du temps d'un joueur automatique); elle n'est consultée que tous les
+     * DEADLINE_PERIOD nœuds.
+     */
+    class SearchEngine{
+
+        public:
+
+            /**
+             * Horloge monotone mesurant l'échéance de la recherche.
+             */
+            using Clock = std::chrono::steady_clock;
+
+        private:
+
+            const std::atomic<bool>& stop_;
+            Clock::time_point deadline_;
+            unsigned nodes_;
+            bool interrupted_;
+
+        public:
+
+            /**
+             * Valeur d'une position gagnée.
+             */
+            static constexpr int WIN = 100000;
+
+            /**
+             * Nombre de nœuds parcourus entre deux consultations de l'échéance.
+             */
+            static constexpr unsigned DEADLINE_PERIOD = 1024;
+
+            /**
+             * Fonction appelée à chaque profondeur terminée avec la meilleure suggestion obtenue.
+             */
+            using Progress = std::function<void(const Hint&)>;
+
+            /**
+             * Construit un moteur de recherche interrompu par l'indicateur donné ou à l'échéance donnée.
+             *
+             * @param stop l'indicateur d'arrêt, devant survivre au moteur
+             * @param deadline l'instant au-delà duquel la recherche est interrompue
+             */
+            explicit SearchEngine(const std::atomic<bool>& stop, Clock::time_point deadline = Clock::time_point::max()) noexcept;
+
+            /**
+             * Recherche le meilleur coup du joueur devant jouer dans la position donnée, jusqu'à la
+             * profondeur donnée, jusqu'à l'arrêt ou jusqu'à l'échéance.
+             *
+             * La position construite par position() ne connaît pas l'historique des allers-retours
+             * des pions: un coup qu'elle génère peut être refusé par le modèle de jeu. Seuls les coups
+             * légaux du modèle donnés sont alors examinés à la racine.
+             *
+             * @param gen la position de départ
+             * @param maxDepth la profondeur maximale (en demi-coups)
+             * @param progress la fonction appelée à chaque profondeur terminée
+             * @param legal les coups légaux du modèle de jeu (cf. Bot::legalMoves()) ou nullptr pour
+             * examiner tous les coups de la position
+             * @return la suggestion de la dernière profondeur terminée ou std::nullopt si aucune
+             * profondeur n'a pu être terminée ou si le joueur ne peut jouer aucun coup.
+             */
+            std::optional<Hint> search(model::MoveGen gen, int maxDepth, const Progress& progress = {},
+                                       const std::vector<BotMove>* legal = nullptr);
+
+            /**
+             * Évalue le matériel de la position donnée du point de vue du joueur devant jouer.
+             *
+             * @param gen la position
+             * @return l'évaluation matérielle.
+             */
+            static int evaluate(const model::MoveGen& gen) noexcept;
+
+            /**
+             * Construit la position de recherche depuis l'observation d'un joueur: les pions
+             * adverses cachés reçoivent, tant qu'il en reste, le rang le plus probable selon
+             * BeliefTracker. La position n'est donc construite depuis aucune information cachée.
+             *
+             * @param obs l'observation du joueur devant jouer
+             * @return la position de recherche.
+             */
+            static model::MoveGen position(const model::Observation& obs);
+
+        private:
+
+            int negamax(model::MoveGen& gen, int depth, int alpha, int beta);
+
+            /*
+             * Vérifie si la recherche doit être interrompue (arrêt demandé ou échéance atteinte).
+             */
+            bool interrupted() noexcept;
+    };
+}
+
+#endif // SEARCHENGINE_H
@@ -0,0 +1,143 @@
+#include "setupGen.h"
+#include "piece.h"
+
+using namespace stratego::model;
+
+namespace{
+
+    constexpr int WIDTH = stratego::Config::BOARD_SIZE - 2;
+    constexpr int ROWS = LayoutParser::ROWS;
+
+    /*
+     * Colonnes de la rangée avant faisant face à une case praticable (et non à de l'eau).
+     */
+    const std::array<bool, WIDTH>& openColumns() noexcept{
+        static const std::array<bool, WIDTH> columns {[](){
+            std::array<bool, WIDTH> result {};
+            Board board {};
+            for(int x = 0; x < WIDTH; x++)
+                result[x] = board.getCell(x + 1, board.size() / 2).type == Cell::NORMAL;
+
+            return result;
+        }()};
+
+        return columns;
+    }
+
+    /*
+     * Retire une occurrence du rang donné de la réserve de pions donnée.
+     */
+    void take(Layout& pool, int& size, int rank) noexcept{
+        for(int i = 0; i < size; i++){
+            if(pool[i] == rank){
+                pool[i] = pool[--size];
+                return;
+            }
+        }
+    }
+}
+
+SetupGenerator::SetupGenerator(std::uint64_t seed, const SetupConstraints& constraints) noexcept :
+    state_ {seed},
+    constraints_ {constraints},
+    army_ {}
+{
+    int i {};
+    for(int rank = Config::PIECE_MIN_RANK; rank <= Config::PIECE_MAX_RANK; rank++){
+        for(int j = 0; j < Piece::pieceInfo[rank].count; j++)
+            army_[i++] = rank;
+    }
+}
+
+void SetupGenerator::seed(std::uint64_t seed) noexcept{
+    state_ = seed;
+}
+
+Layout SetupGenerator::next() noexcept{
+    Layout layout;
+    do{
+        fill(layout);
+    } while(!canMove(layout));
+
+    return layout;
+}
+
+const SetupConstraints& SetupGenerator::constraints() const noexcept{
+    return constraints_;
+}
+
+bool SetupGenerator::canMove(const Layout& layout) noexcept{
+    const std::array<bool, WIDTH>& open {openColumns()};
+    for(int x = 0; x < WIDTH; x++){
+        int rank {layout[(ROWS - 1) * WIDTH + x]};
+        if(open[x] && rank != Config::PIECE_FLAG_INFO.rank && rank != Config::PIECE_BOMB_INFO.rank)
+            return true;
+    }
+
+    return false;
+}
+
+bool SetupGenerator::satisfies(const Layout& layout, const SetupConstraints& constraints) noexcept{
+    int flag {static_cast<int>(std::find(layout.begin(), layout.end(), Config::PIECE_FLAG_INFO.rank) - layout.begin())};
+    if(flag == Config::ARMY_SIZE)
+        return false;
+    if(constraints.flagInBackRow && flag >= WIDTH)
+        return false;
+
+    if(constraints.bombsAroundFlag){
+        int row {flag / WIDTH}, col {flag % WIDTH};
+        if((col > 0 && layout[flag - 1] != Config::PIECE_BOMB_INFO.rank) ||
+           (col < WIDTH - 1 && layout[flag + 1] != Config::PIECE_BOMB_INFO.rank) ||
+           (row > 0 && layout[flag - WIDTH] != Config::PIECE_BOMB_INFO.rank) ||
+           (row < ROWS - 1 && layout[flag + WIDTH] != Config::PIECE_BOMB_INFO.rank))
+            return false;
+    }
+
+    return true;
+}
+
+std::uint64_t SetupGenerator::random() noexcept{
+    // splitmix64
+    std::uint64_t z {state_ += 0x9E3779B97F4A7C15ULL};
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+int SetupGenerator::random(int bound) noexcept{
+    return static_cast<int>(((random() >> 32) * static_cast<std::uint64_t>(bound)) >> 32);
+}
+
+void SetupGenerator::fill(Layout& layout) noexcept{
+    Layout pool {army_};
+    int size {Config::ARMY_SIZE};
+    layout.fill(-1);
+
+    if(constraints_.flagInBackRow || constraints_.bombsAroundFlag){
+        int flag {random(constraints_.flagInBackRow ? WIDTH : Config::ARMY_SIZE)};
+        layout[flag] = Config::PIECE_FLAG_INFO.rank;
+        take(pool, size, Config::PIECE_FLAG_INFO.rank);
+
+        if(constraints_.bombsAroundFlag){
+            int row {flag / WIDTH}, col {flag % WIDTH};
+            std::array<int, 4> neighbours {col > 0 ? flag - 1 : -1,
+                                           col < WIDTH - 1 ? flag + 1 : -1,
+                                           row > 0 ? flag - WIDTH : -1,
+                                           row < ROWS - 1 ? flag + WIDTH : -1};
+            for(int cell : neighbours){
+                if(cell != -1){
+                    layout[cell] = Config::PIECE_BOMB_INFO.rank;
+                    take(pool, size, Config::PIECE_BOMB_INFO.rank);
+                }
+            }
+        }
+    }
+
+    for(int& cell : layout){
+        if(cell == -1){
+            int i {random(size)};
+            cell = pool[i];
+            pool[i] = pool[--size];
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#ifndef SETUPGEN_H
+#define SETUPGEN_H
+
+#include <cstdint>
+
+#include "setupStore.h"
+
+namespace stratego::model {
+
+    /**
+     * Contraintes de placement optionnelles imposées aux dispositions générées.
+     */
+    struct SetupConstraints{
+        /**
+         * Le drapeau est placé sur la rangée arrière (la plus éloignée du centre du plateau de jeu).
+         */
+        bool flagInBackRow {false};
+
+        /**
+         * Chaque case voisine (horizontalement ou verticalement) du drapeau est occupée par une bombe.
+         */
+        bool bombsAroundFlag {false};
+    };
+
+    /**
+     * Générateur de dispositions de départ aléatoires et valides: chaque disposition générée respecte
+     * le nombre de pions de chaque rang, permet à au moins un pion de bouger au premier tour et
+     * satisfait les contraintes de placement données.
+     *
+     * Le générateur est déterministe pour une graine donnée et ne réalise aucune allocation.
+     */
+    class SetupGenerator{
+
+        public:
+
+            /**
+             * Construit un générateur de dispositions.
+             *
+             * @param seed la graine du générateur
+             * @param constraints les contraintes de placement à respecter
+             */
+            explicit SetupGenerator(std::uint64_t seed, const SetupConstraints& constraints = {}) noexcept;
+
+            /**
+             * Réinitialise la graine du générateur.
+             *
+             * @param seed la nouvelle graine du générateur
+             */
+            void seed(std::uint64_t seed) noexcept;
+
+            /**
+             * Génère une nouvelle disposition de départ.
+             *
+             * @return une disposition valide respectant les contraintes du générateur.
+             */
+            Layout next() noexcept;
+
+            /**
+             * Récupère les contraintes de placement du générateur.
+             *
+             * @return les contraintes de placement du générateur.
+             */
+            const SetupConstraints& constraints() const noexcept;
+
+            /**
+             * Vérifie si un pion de la disposition donnée peut bouger dès le premier tour, c'est-à-dire
+             * si un pion mobile se trouve sur la rangée avant face à une case qui n'est pas de l'eau.
+             *
+             * @param layout la disposition à vérifier
+             * @return true si un pion peut bouger, false si non.
+             */
+            static bool canMove(const Layout& layout) noexcept;
+
+            /**
+             * Vérifie si la disposition donnée satisfait les contraintes de placement données.
+             *
+             * @param layout la disposition à vérifier
+             * @param constraints les contraintes de placement à vérifier
+             * @return true si toutes les contraintes sont satisfaites, false si non.
+             */
+            static bool satisfies(const Layout& layout, const SetupConstraints& constraints) noexcept;
+
+        private:
+
+            std::uint64_t state_;
+            SetupConstraints constraints_;
+            Layout army_;
+
+            std::uint64_t random() noexcept;
+            int random(int bound) noexcept;
+            void fill(Layout& layout) noexcept;
+    };
+}
+
+#endif // SETUPGEN_H
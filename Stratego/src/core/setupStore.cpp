@@ -0,0 +1,206 @@
+#include "setupStore.h"
+#include "piece.h"
+
+using namespace stratego::model;
+
+namespace{
+
+    constexpr int WIDTH = stratego::Config::BOARD_SIZE - 2;
+    constexpr size_t HEADER_SIZE = SetupStore::MAGIC.size() + 4;
+}
+
+/* ========================== PackedSetup =========================== */
+PackedSetup::PackedSetup() noexcept :
+    bytes_ {}
+{}
+
+PackedSetup::PackedSetup(const Layout& layout) :
+    bytes_ {}
+{
+    for(int i = 0; i < Config::ARMY_SIZE; i++){
+        if(layout[i] < Config::PIECE_MIN_RANK || layout[i] > Config::PIECE_MAX_RANK)
+            throw std::invalid_argument("Invalid rank in the given layout");
+
+        bytes_[i / 2] |= static_cast<std::uint8_t>(layout[i] << (4 * (i % 2)));
+    }
+}
+
+PackedSetup::PackedSetup(const Bytes& bytes) noexcept :
+    bytes_ {bytes}
+{}
+
+int PackedSetup::rankAt(int i) const noexcept{
+    return (bytes_[i / 2] >> (4 * (i % 2))) & 0xF;
+}
+
+Layout PackedSetup::layout() const noexcept{
+    Layout layout {};
+    for(int i = 0; i < Config::ARMY_SIZE; i++)
+        layout[i] = rankAt(i);
+
+    return layout;
+}
+
+PackedSetup PackedSetup::mirror() const noexcept{
+    PackedSetup result {};
+    for(int i = 0; i < Config::ARMY_SIZE; i++){
+        int j {i - i % WIDTH + WIDTH - 1 - i % WIDTH};
+        result.bytes_[j / 2] |= static_cast<std::uint8_t>(rankAt(i) << (4 * (j % 2)));
+    }
+
+    return result;
+}
+
+PackedSetup PackedSetup::canonical() const noexcept{
+    PackedSetup mirrored {mirror()};
+    return mirrored < *this ? mirrored : *this;
+}
+
+std::uint64_t PackedSetup::hash() const noexcept{
+    std::uint64_t hash {14695981039346656037ULL};
+    for(std::uint8_t byte : bytes_){
+        hash ^= byte;
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+const PackedSetup::Bytes& PackedSetup::bytes() const noexcept{
+    return bytes_;
+}
+
+bool stratego::model::operator==(const PackedSetup& lhs, const PackedSetup& rhs) noexcept{
+    return lhs.bytes() == rhs.bytes();
+}
+
+bool stratego::model::operator<(const PackedSetup& lhs, const PackedSetup& rhs) noexcept{
+    return lhs.bytes() < rhs.bytes();
+}
+
+
+/* ========================== SetupStore =========================== */
+SetupStore::SetupStore() noexcept :
+    setups_ {},
+    index_ {}
+{}
+
+SetupStore SetupStore::load(const std::string& filepath){
+    util::MappedFile file {filepath};
+    std::string_view content {file.content()};
+    if(content.size() < HEADER_SIZE || content.substr(0, MAGIC.size()) != MAGIC)
+        throw std::invalid_argument("Not a setup store file");
+
+    std::uint32_t count {};
+    for(size_t i = 0; i < 4; i++)
+        count |= static_cast<std::uint32_t>(static_cast<unsigned char>(content[MAGIC.size() + i])) << (8 * i);
+
+    if(content.size() != HEADER_SIZE + static_cast<size_t>(count) * PackedSetup::BYTES)
+        throw std::invalid_argument("Truncated setup store file");
+
+    SetupStore store {};
+    store.setups_.reserve(count);
+    store.index_.reserve(count);
+    for(size_t i = 0; i < count; i++){
+        PackedSetup::Bytes bytes {};
+        std::copy_n(content.data() + HEADER_SIZE + i * PackedSetup::BYTES, PackedSetup::BYTES, bytes.begin());
+        PackedSetup setup {bytes};
+        if(!LayoutParser::isArmy(setup.layout()))
+            throw std::invalid_argument("Corrupted setup in setup store file");
+
+        setup = setup.canonical();
+        if(store.find(setup) == -1){
+            store.index_.emplace(setup.hash(), store.setups_.size());
+            store.setups_.push_back(setup);
+        }
+    }
+
+    return store;
+}
+
+void SetupStore::save(const std::string& filepath) const{
+    std::ofstream ofs {filepath, std::ios::binary | std::ios::trunc};
+    if(ofs.fail())
+        throw std::invalid_argument("Cannot open the given file");
+
+    std::uint32_t count {static_cast<std::uint32_t>(setups_.size())};
+    char header[HEADER_SIZE];
+    std::copy(MAGIC.begin(), MAGIC.end(), header);
+    for(size_t i = 0; i < 4; i++)
+        header[MAGIC.size() + i] = static_cast<char>((count >> (8 * i)) & 0xFF);
+
+    ofs.write(header, HEADER_SIZE);
+    for(const PackedSetup& setup : setups_)
+        ofs.write(reinterpret_cast<const char*>(setup.bytes().data()), PackedSetup::BYTES);
+
+    if(ofs.fail())
+        throw std::invalid_argument("Cannot write the given file");
+}
+
+bool SetupStore::add(const Layout& layout){
+    if(!LayoutParser::isArmy(layout))
+        throw std::invalid_argument("The given layout is not a complete army");
+
+    PackedSetup setup {PackedSetup{layout}.canonical()};
+    if(find(setup) != -1)
+        return false;
+
+    index_.emplace(setup.hash(), setups_.size());
+    setups_.push_back(setup);
+    return true;
+}
+
+bool SetupStore::importFile(const std::string& filepath){
+    util::MappedFile file {filepath};
+    Layout layout {};
+    if(!ConfigFileParser::decode(file.content(), layout))
+        throw std::invalid_argument("Your file cannot be parsed");
+
+    return add(layout);
+}
+
+void SetupStore::exportFile(size_t i, const std::string& filepath) const{
+    std::string text {toText(at(i))};
+    std::ofstream ofs {filepath, std::ios::trunc};
+    if(ofs.fail())
+        throw std::invalid_argument("Cannot open the given file");
+
+    ofs << text;
+}
+
+bool SetupStore::contains(const Layout& layout) const noexcept{
+    for(int rank : layout){
+        if(rank < Config::PIECE_MIN_RANK || rank > Config::PIECE_MAX_RANK)
+            return false;
+    }
+
+    return find(PackedSetup{layout}.canonical()) != -1;
+}
+
+Layout SetupStore::at(size_t i) const{
+    return setups_.at(i).layout();
+}
+
+size_t SetupStore::size() const noexcept{
+    return setups_.size();
+}
+
+std::string SetupStore::toText(const Layout& layout){
+    std::string text {};
+    for(int i = 0; i < Config::ARMY_SIZE; i++){
+        text += Piece::pieceInfo[layout[i]].symbol;
+        text += (i + 1) % WIDTH == 0 ? '\n' : ' ';
+    }
+
+    return text;
+}
+
+long SetupStore::find(const PackedSetup& setup) const noexcept{
+    auto range {index_.equal_range(setup.hash())};
+    for(auto it = range.first; it != range.second; ++it){
+        if(setups_[it -> second] == setup)
+            return static_cast<long>(it -> second);
+    }
+
+    return -1;
+}
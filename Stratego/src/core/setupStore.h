@@ -0,0 +1,255 @@
+#ifndef SETUPSTORE_H
+#define SETUPSTORE_H
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+
+#include "gamestuff.h"
+
+namespace stratego::model {
+
+    /**
+     * Disposition de départ d'une armée compactée sur 4 bits par pion (20 octets pour 40 pions).
+     * Le pion d'indice pair occupe les 4 bits de poids faible de son octet, le pion d'indice
+     * impair les 4 bits de poids fort.
+     */
+    class PackedSetup{
+
+        public:
+
+            /**
+             * Nombre d'octets occupés par une disposition compactée.
+             */
+            static constexpr int BYTES = Config::ARMY_SIZE / 2;
+
+            using Bytes = std::array<std::uint8_t, BYTES>;
+
+            /**
+             * Construit une disposition compactée vide (uniquement composée de drapeaux).
+             */
+            PackedSetup() noexcept;
+
+            /**
+             * Compacte la disposition donnée.
+             *
+             * @throw std::invalid_argument si l'un des rangs ne peut être représenté
+             *
+             * @param layout la disposition à compacter
+             */
+            explicit PackedSetup(const Layout& layout);
+
+            /**
+             * Reconstruit une disposition compactée depuis ses octets.
+             *
+             * @param bytes les octets de la disposition
+             */
+            explicit PackedSetup(const Bytes& bytes) noexcept;
+
+            /**
+             * Récupère le rang du pion d'indice donné.
+             *
+             * @param i l'indice du pion (0 <= i < Config::ARMY_SIZE)
+             * @return le rang du pion d'indice donné.
+             */
+            int rankAt(int i) const noexcept;
+
+            /**
+             * Décompacte la disposition.
+             *
+             * @return les rangs des pions de la disposition.
+             */
+            Layout layout() const noexcept;
+
+            /**
+             * Calcule l'image miroir (gauche/droite) de la disposition.
+             *
+             * @return la disposition dont chaque rangée est inversée.
+             */
+            PackedSetup mirror() const noexcept;
+
+            /**
+             * Calcule la forme canonique de la disposition: la plus petite (ordre lexicographique des
+             * octets) entre la disposition et son image miroir. Deux dispositions symétriques possèdent
+             * ainsi la même forme canonique.
+             *
+             * @return la forme canonique de la disposition.
+             */
+            PackedSetup canonical() const noexcept;
+
+            /**
+             * Calcule l'empreinte (FNV-1a 64 bits) des octets de la disposition.
+             *
+             * @return l'empreinte de la disposition.
+             */
+            std::uint64_t hash() const noexcept;
+
+            /**
+             * Récupère les octets de la disposition.
+             *
+             * @return les octets de la disposition.
+             */
+            const Bytes& bytes() const noexcept;
+
+        private:
+
+            Bytes bytes_;
+    };
+
+    /**
+     * Vérifie si les deux dispositions compactées sont identiques.
+     *
+     * @param lhs la première disposition
+     * @param rhs la deuxième disposition
+     * @return true si les deux dispositions possèdent les mêmes octets, false si non.
+     */
+    bool operator==(const PackedSetup& lhs, const PackedSetup& rhs) noexcept;
+
+    /**
+     * Compare lexicographiquement les octets des deux dispositions compactées.
+     *
+     * @param lhs la première disposition
+     * @param rhs la deuxième disposition
+     * @return true si la première disposition précède la deuxième, false si non.
+     */
+    bool operator<(const PackedSetup& lhs, const PackedSetup& rhs) noexcept;
+
+    /**
+     * Base de données binaire de dispositions de départ. Les dispositions sont stockées sous forme
+     * canonique et dédoublonnées par empreinte: une disposition et son image miroir ne sont
+     * stockées qu'une seule fois. Chaque disposition est accessible en temps constant par son indice.
+     *
+     * Le format de fichier est composé d'un en-tête (MAGIC suivi du nombre de dispositions sur 4
+     * octets en little endian) suivi des dispositions compactées (PackedSetup::BYTES octets chacune).
+     */
+    class SetupStore{
+
+        public:
+
+            /**
+             * Signature identifiant un fichier de base de données de dispositions.
+             */
+            static constexpr std::string_view MAGIC {"STRSETUP"};
+
+            /**
+             * Construit une base de données de dispositions vide.
+             */
+            SetupStore() noexcept;
+
+            /**
+             * Charge la base de données de dispositions depuis le fichier binaire donné.
+             *
+             * @throw std::invalid_argument si le fichier ne peut être ouvert ou s'il est corrompu
+             *
+             * @param filepath le chemin vers le fichier binaire
+             * @return la base de données chargée.
+             */
+            static SetupStore load(const std::string& filepath);
+
+            /**
+             * Sauvegarde la base de données de dispositions dans le fichier binaire donné.
+             *
+             * @throw std::invalid_argument si le fichier ne peut être écrit
+             *
+             * @param filepath le chemin vers le fichier binaire
+             */
+            void save(const std::string& filepath) const;
+
+            /**
+             * Ajoute la disposition donnée à la base de données si ni elle ni son image miroir
+             * n'y sont déjà présentes.
+             *
+             * @throw std::invalid_argument si la disposition donnée ne décrit pas une armée complète
+             *
+             * @param layout la disposition à ajouter
+             * @return true si la disposition a été ajoutée, false s'il s'agit d'un doublon.
+             */
+            bool add(const Layout& layout);
+
+            /**
+             * Ajoute la disposition décrite par le fichier de configuration texte donné.
+             *
+             * @throw std::invalid_argument si le fichier ne peut être ouvert ou parsé
+             *
+             * @param filepath le chemin vers le fichier de configuration
+             * @return true si la disposition a été ajoutée, false s'il s'agit d'un doublon.
+             */
+            bool importFile(const std::string& filepath);
+
+            /**
+             * Écrit la disposition d'indice donné dans un fichier de configuration texte.
+             *
+             * @throw std::out_of_range si l'indice donné est invalide
+             * @throw std::invalid_argument si le fichier ne peut être écrit
+             *
+             * @param i l'indice de la disposition
+             * @param filepath le chemin vers le fichier de configuration à écrire
+             */
+            void exportFile(size_t i, const std::string& filepath) const;
+
+            /**
+             * Vérifie si la disposition donnée (ou son image miroir) est présente.
+             *
+             * @param layout la disposition à rechercher
+             * @return true si la disposition est présente, false si non.
+             */
+            bool contains(const Layout& layout) const noexcept;
+
+            /**
+             * Récupère la disposition (forme canonique) d'indice donné.
+             *
+             * @throw std::out_of_range si l'indice donné est invalide
+             *
+             * @param i l'indice de la disposition
+             * @return la disposition d'indice donné.
+             */
+            Layout at(size_t i) const;
+
+            /**
+             * Tire une disposition au hasard. La disposition ou son image miroir est retournée avec
+             * une probabilité égale.
+             *
+             * @throw std::out_of_range si la base de données est vide
+             *
+             * @param gen le générateur aléatoire à utiliser
+             * @return une disposition tirée au hasard.
+             */
+            template<class URBG>
+            Layout draw(URBG& gen) const;
+
+            /**
+             * Récupère le nombre de dispositions stockées.
+             *
+             * @return le nombre de dispositions stockées.
+             */
+            size_t size() const noexcept;
+
+            /**
+             * Convertit la disposition donnée au format texte des fichiers de configuration.
+             *
+             * @param layout la disposition à convertir
+             * @return le contenu du fichier de configuration correspondant.
+             */
+            static std::string toText(const Layout& layout);
+
+        private:
+
+            std::vector<PackedSetup> setups_;
+            std::unordered_multimap<std::uint64_t, size_t> index_;
+
+            long find(const PackedSetup& setup) const noexcept;
+    };
+
+    template<class URBG>
+    Layout SetupStore::draw(URBG& gen) const{
+        if(setups_.empty())
+            throw std::out_of_range("Cannot draw from an empty setup store");
+
+        std::uniform_int_distribution<size_t> dist {0, 2 * setups_.size() - 1};
+        size_t n {dist(gen)};
+        const PackedSetup& setup {setups_[n / 2]};
+        return n % 2 == 0 ? setup.layout() : setup.mirror().layout();
+    }
+}
+
+#endif // SETUPSTORE_H
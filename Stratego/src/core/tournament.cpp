@@ -0,0 +1,468 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include "setupGen.h"
+#include "tournament.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    constexpr std::string_view MAGIC {"STRTOURNAMENT 1"};
+
+    /*
+     * Nombre maximal d'appariements essayés pour éviter qu'une ronde suisse ne répète une
+     * confrontation.
+     */
+    constexpr int SWISS_SEARCH_LIMIT = 100000;
+
+    std::uint64_t mix(std::uint64_t seed, std::uint64_t value) noexcept{
+        // splitmix64
+        std::uint64_t z {seed + 0x9E3779B97F4A7C15ULL * (value + 1)};
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    std::string_view outcomeName(GameOutcome outcome) noexcept{
+        return outcome == GameOutcome::RED_WIN ? "red" : outcome == GameOutcome::BLUE_WIN ? "blue" : "draw";
+    }
+}
+
+/* ===== Classements ===== */
+
+double Score::points() const noexcept{
+    return wins + draws / 2.0;
+}
+
+int Score::games() const noexcept{
+    return wins + draws + losses;
+}
+
+std::vector<Rating> stratego::eloRatings(const std::vector<std::vector<Score>>& results, double prior, double z){
+    const double k {std::log(10.0) / 400};
+    size_t n {results.size()};
+    std::vector<double> elo(n, 0.0), information(n, 0.0);
+
+    // méthode de Newton, un bot à la fois: la vraisemblance est concave en chaque classement
+    for(int iteration = 0; iteration < 1000; iteration++){
+        double change {};
+        for(size_t i = 0; i < n; i++){
+            double gradient {}, curvature {};
+            auto add {[&](double score, double games, double opponent){
+                double p {1 / (1 + std::exp(k * (opponent - elo[i])))};
+                gradient += score - games * p;
+                curvature += games * p * (1 - p);
+            }};
+
+            add(prior / 2, prior, 0);
+            for(size_t j = 0; j < n; j++){
+                if(j != i && results[i][j].games() > 0)
+                    add(results[i][j].points(), results[i][j].games(), elo[j]);
+            }
+
+            information[i] = curvature;
+            if(curvature > 0){
+                double step {gradient / (k * curvature)};
+                elo[i] += step;
+                change = std::max(change, std::abs(step));
+            }
+        }
+
+        if(change < 1e-6)
+            break;
+    }
+
+    double mean {n ? std::accumulate(elo.begin(), elo.end(), 0.0) / n : 0};
+    std::vector<Rating> ratings {};
+    for(size_t i = 0; i < n; i++){
+        double margin {information[i] > 0 ? z / (k * std::sqrt(information[i])) : INFINITY};
+        ratings.push_back({elo[i] - mean, margin});
+    }
+
+    return ratings;
+}
+
+/* ===== Tournoi ===== */
+
+Tournament::Tournament(std::vector<std::string> bots, const TournamentSettings& settings, SetupStore pool) :
+    bots_ {std::move(bots)},
+    settings_ {settings},
+    pool_ {std::move(pool)},
+    rounds_ {},
+    games_ {},
+    played_ {},
+    results_ {},
+    byes_ {},
+    checkpoint_ {}
+{
+    if(bots_.size() < 2)
+        throw std::invalid_argument("A tournament needs at least two bots");
+    if(settings_.rounds <= 0)
+        throw std::invalid_argument("A tournament needs at least one round");
+
+    results_.assign(bots_.size(), std::vector<Score>(bots_.size(), Score{}));
+    byes_.assign(bots_.size(), 0);
+}
+
+std::vector<Encounter> Tournament::roundRobin(int bots, int round){
+    // méthode du cercle: le premier bot est fixe, les autres tournent d'une place à chaque ronde
+    int size {bots + bots % 2};
+    std::vector<int> circle(size);
+    circle[0] = 0;
+    for(int i = 1; i < size; i++)
+        circle[i] = 1 + (i - 1 + round) % (size - 1);
+
+    std::vector<Encounter> encounters {};
+    for(int i = 0; i < size / 2; i++){
+        int first {circle[i]}, second {circle[size - 1 - i]};
+        if(first >= bots || second >= bots){
+            encounters.push_back({std::min(first, second), Encounter::BYE});
+            continue;
+        }
+        if((round + i) % 2) // alterne l'ordre des confrontations du bot fixe
+            std::swap(first, second);
+
+        encounters.push_back({first, second});
+    }
+
+    return encounters;
+}
+
+std::vector<Encounter> Tournament::swiss(){
+    int n {static_cast<int>(bots_.size())};
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](int a, int b){ return points(a) > points(b); });
+
+    std::vector<Encounter> encounters {};
+    if(n % 2){ // le bot le moins bien classé parmi les moins exemptés est exempté
+        auto bye {std::min_element(order.rbegin(), order.rend(), [this](int a, int b){ return byes_[a] < byes_[b]; })};
+        encounters.push_back({*bye, Encounter::BYE});
+        byes_[*bye]++;
+        order.erase(std::next(bye).base());
+    }
+
+    std::set<std::pair<int, int>> met {};
+    for(const auto& round : rounds_){
+        for(const Encounter& encounter : round)
+            met.insert(std::minmax(encounter.first, encounter.second));
+    }
+
+    // chaque bot est apparié au mieux classé des bots restants qu'il n'a pas encore rencontré
+    std::vector<int> partner(n, -1);
+    int budget {SWISS_SEARCH_LIMIT};
+    std::function<bool(size_t)> pair {[&](size_t i) -> bool{
+        while(i < order.size() && partner[order[i]] != -1)
+            i++;
+        if(i == order.size())
+            return true;
+
+        for(size_t j = i + 1; j < order.size() && budget > 0; j++){
+            int a {order[i]}, b {order[j]};
+            if(partner[b] != -1 || met.count(std::minmax(a, b)))
+                continue;
+
+            budget--;
+            partner[a] = b;
+            partner[b] = a;
+            if(pair(i + 1))
+                return true;
+
+            partner[a] = partner[b] = -1;
+        }
+
+        return false;
+    }};
+
+    if(!pair(0)){ // toutes les confrontations ont déjà eu lieu: les bots voisins au classement sont appariés
+        for(size_t i = 0; i + 1 < order.size(); i += 2){
+            partner[order[i]] = order[i + 1];
+            partner[order[i + 1]] = order[i];
+        }
+    }
+
+    for(int a : order){
+        if(partner[a] != -1 && std::find(order.begin(), order.end(), a) < std::find(order.begin(), order.end(), partner[a]))
+            encounters.push_back({a, partner[a]});
+    }
+
+    return encounters;
+}
+
+std::vector<Encounter> Tournament::nextRound(){
+    int round {static_cast<int>(rounds_.size())};
+    if(settings_.pairing == Pairing::SWISS)
+        return swiss();
+
+    int n {static_cast<int>(bots_.size())};
+    int perCycle {n + n % 2 - 1};
+    std::vector<Encounter> encounters {roundRobin(n, round % perCycle)};
+    if((round / perCycle) % 2){ // les cycles impairs inversent l'ordre des confrontations
+        for(Encounter& encounter : encounters){
+            if(encounter.second != Encounter::BYE)
+                std::swap(encounter.first, encounter.second);
+        }
+    }
+
+    return encounters;
+}
+
+GameRecord Tournament::play(int round, int encounter, int leg) const{
+    const Encounter& match {rounds_[round][encounter]};
+    GameRecord game {round, encounter, leg, leg ? match.second : match.first, leg ? match.first : match.second,
+                     GameOutcome::DRAW, false};
+
+    // les deux parties d'une confrontation sont jouées sur les mêmes dispositions
+    std::uint64_t seed {mix(mix(settings_.seed, round), encounter)};
+    std::mt19937_64 gen {seed};
+    SetupGenerator generator {seed};
+    Layout red {pool_.size() == 0 ? generator.next() : pool_.draw(gen)};
+    Layout blue {pool_.size() == 0 ? generator.next() : pool_.draw(gen)};
+
+    // un bot qui ne peut être créé ou qui échoue à jouer perd la partie par forfait
+    Color culprit {Color::RED};
+    std::unique_ptr<Bot> redBot {}, blueBot {};
+    try{
+        redBot = Bot::create(bots_[game.red], mix(seed, 2 * leg));
+        culprit = Color::BLUE;
+        blueBot = Bot::create(bots_[game.blue], mix(seed, 2 * leg + 1));
+
+        Arena arena {settings_.maxTurns, settings_.timeControl, settings_.reveal, settings_.materialMargin};
+        game.outcome = arena.play(red, blue, *redBot, *blueBot);
+    } catch(const BotFailure& failure){
+        game.outcome = failure.color() == Color::RED ? GameOutcome::BLUE_WIN : GameOutcome::RED_WIN;
+        game.forfeit = true;
+    } catch(const std::exception&){
+        if(blueBot) // erreur interne, non imputable aux bots
+            throw;
+
+        game.outcome = culprit == Color::RED ? GameOutcome::BLUE_WIN : GameOutcome::RED_WIN;
+        game.forfeit = true;
+    }
+
+    return game;
+}
+
+void Tournament::record(const GameRecord& game){
+    games_.push_back(game);
+    played_.insert({game.round, game.encounter, game.leg});
+
+    Score& red {results_[game.red][game.blue]};
+    Score& blue {results_[game.blue][game.red]};
+    if(game.outcome == GameOutcome::DRAW){
+        red.draws++;
+        blue.draws++;
+    } else if(game.outcome == GameOutcome::RED_WIN){
+        red.wins++;
+        blue.losses++;
+    } else{
+        red.losses++;
+        blue.wins++;
+    }
+
+    if(checkpoint_.is_open()){
+        checkpoint_ << "game " << game.round << ' ' << game.encounter << ' ' << game.leg << ' ' << game.red << ' '
+                    << game.blue << ' ' << outcomeName(game.outcome) << ' ' << game.forfeit << '\n' << std::flush;
+        if(!checkpoint_)
+            throw std::invalid_argument("The checkpoint cannot be written");
+    }
+}
+
+void Tournament::run(int threads, const std::function<void(const GameRecord&)>& progress){
+    for(int round = 0; round < roundCount(); round++){
+        if(round == static_cast<int>(rounds_.size()))
+            rounds_.push_back(nextRound());
+
+        std::vector<std::tuple<int, int, int>> pending {};
+        for(int encounter = 0; encounter < static_cast<int>(rounds_[round].size()); encounter++){
+            for(int leg = 0; leg < 2 && rounds_[round][encounter].second != Encounter::BYE; leg++){
+                if(!played_.count({round, encounter, leg}))
+                    pending.emplace_back(round, encounter, leg);
+            }
+        }
+
+        std::atomic<size_t> next {0};
+        std::mutex mutex {};
+        std::exception_ptr error {};
+        auto worker {[&](){
+            size_t i;
+            while((i = next.fetch_add(1)) < pending.size()){
+                auto [r, encounter, leg] {pending[i]};
+                try{
+                    GameRecord game {play(r, encounter, leg)};
+
+                    std::lock_guard lock {mutex};
+                    if(error)
+                        return;
+                    record(game);
+                    if(progress)
+                        progress(game);
+                } catch(...){
+                    std::lock_guard lock {mutex};
+                    if(!error)
+                        error = std::current_exception();
+                    next = pending.size();
+                }
+            }
+        }};
+
+        std::vector<std::thread> workers {};
+        for(int i = 1; i < std::min<int>(threads, pending.size()); i++)
+            workers.emplace_back(worker);
+        worker();
+        for(std::thread& thread : workers)
+            thread.join();
+
+        if(error)
+            std::rethrow_exception(error);
+    }
+}
+
+/* ===== Reprise ===== */
+
+std::string Tournament::header() const{
+    auto millis {[](std::chrono::steady_clock::duration d){
+        return std::chrono::duration_cast<std::chrono::milliseconds>(d).count();
+    }};
+
+    std::ostringstream stream {};
+    stream << MAGIC << '\n'
+           << "pairing " << (settings_.pairing == Pairing::SWISS ? "swiss" : "roundrobin") << ' ' << settings_.rounds << '\n'
+           << "rules " << (settings_.reveal ? "reveal" : "classic") << ' ' << settings_.maxTurns << ' '
+           << settings_.materialMargin << ' ' << millis(settings_.timeControl.initial) << ' '
+           << millis(settings_.timeControl.increment) << '\n'
+           << "seed " << settings_.seed << " pool " << pool_.size() << '\n';
+    for(const std::string& bot : bots_)
+        stream << "bot " << bot << '\n';
+
+    return stream.str();
+}
+
+void Tournament::resume(const std::string& filepath){
+    if(!games_.empty() || checkpoint_.is_open())
+        throw std::logic_error("The tournament has already started");
+
+    std::string expected {header()}, content {};
+    {
+        std::ifstream ifs {filepath, std::ios::binary};
+        content.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+    }
+
+    if(!content.empty() && content.compare(0, expected.size(), expected) != 0)
+        throw std::invalid_argument("The checkpoint describes another tournament");
+
+    // seules les lignes complètes sont relues: la dernière a pu être tronquée par l'interruption
+    size_t begin {std::min(expected.size(), content.size())}, end;
+    while((end = content.find('\n', begin)) != std::string::npos){
+        std::istringstream line {content.substr(begin, end - begin)};
+        begin = end + 1;
+
+        std::string keyword, outcome, rest;
+        GameRecord game {};
+        if(!(line >> keyword >> game.round >> game.encounter >> game.leg >> game.red >> game.blue >> outcome >> game.forfeit)
+           || (line >> rest) || keyword != "game" || (outcome != "red" && outcome != "blue" && outcome != "draw"))
+            throw std::invalid_argument("The checkpoint is corrupted");
+
+        game.outcome = outcome == "red" ? GameOutcome::RED_WIN : outcome == "blue" ? GameOutcome::BLUE_WIN : GameOutcome::DRAW;
+
+        // les rondes sont recalculées dans l'ordre: une ronde suisse ne dépend que des précédentes
+        int round {static_cast<int>(rounds_.size())};
+        if(game.round == round && round < roundCount()){
+            if(round > 0){ // la ronde précédente doit être terminée
+                long games {2 * std::count_if(rounds_.back().begin(), rounds_.back().end(),
+                                              [](const Encounter& e){ return e.second != Encounter::BYE; })};
+                if(std::count_if(played_.begin(), played_.end(), [&](const auto& p){ return std::get<0>(p) == round - 1; }) != games)
+                    throw std::invalid_argument("The checkpoint does not match the tournament");
+            }
+
+            rounds_.push_back(nextRound());
+        }
+
+        if(game.round < 0 || game.round >= static_cast<int>(rounds_.size()) || game.encounter < 0
+           || game.encounter >= static_cast<int>(rounds_[game.round].size()) || game.leg < 0 || game.leg > 1
+           || played_.count({game.round, game.encounter, game.leg}))
+            throw std::invalid_argument("The checkpoint does not match the tournament");
+
+        const Encounter& match {rounds_[game.round][game.encounter]};
+        if(match.second == Encounter::BYE || game.red != (game.leg ? match.second : match.first)
+           || game.blue != (game.leg ? match.first : match.second))
+            throw std::invalid_argument("The checkpoint does not match the tournament");
+
+        record(game);
+    }
+
+    // le fichier est réécrit sans la ligne tronquée avant d'y ajouter de nouvelles parties
+    std::string temporary {filepath + ".tmp"};
+    {
+        std::ofstream ofs {temporary, std::ios::binary | std::ios::trunc};
+        ofs << expected << content.substr(std::min(expected.size(), content.size()), begin - std::min(expected.size(), content.size()));
+        if(!ofs.flush())
+            throw std::invalid_argument("The checkpoint cannot be written");
+    }
+    if(std::rename(temporary.c_str(), filepath.c_str()) != 0)
+        throw std::invalid_argument("The checkpoint cannot be written");
+
+    checkpoint_.open(filepath, std::ios::binary | std::ios::app);
+    if(!checkpoint_)
+        throw std::invalid_argument("The checkpoint cannot be written");
+}
+
+/* ===== Accesseurs ===== */
+
+int Tournament::roundCount() const noexcept{
+    if(settings_.pairing == Pairing::SWISS)
+        return settings_.rounds;
+
+    int n {static_cast<int>(bots_.size())};
+    return settings_.rounds * (n + n % 2 - 1);
+}
+
+int Tournament::gameCount() const noexcept{
+    int n {static_cast<int>(bots_.size())};
+    return roundCount() * (n / 2) * 2;
+}
+
+const std::vector<std::string>& Tournament::bots() const noexcept{
+    return bots_;
+}
+
+const std::vector<std::vector<Encounter>>& Tournament::rounds() const noexcept{
+    return rounds_;
+}
+
+const std::vector<GameRecord>& Tournament::games() const noexcept{
+    return games_;
+}
+
+const std::vector<std::vector<Score>>& Tournament::results() const noexcept{
+    return results_;
+}
+
+Score Tournament::score(int bot) const{
+    Score total {};
+    for(const Score& score : results_.at(bot)){
+        total.wins += score.wins;
+        total.draws += score.draws;
+        total.losses += score.losses;
+    }
+
+    return total;
+}
+
+double Tournament::points(int bot) const{
+    return score(bot).points() + 2.0 * byes_.at(bot);
+}
+
+std::vector<Rating> Tournament::ratings() const{
+    return eloRatings(results_);
+}
@@ -0,0 +1,313 @@
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include <cstdint>
+#include <functional>
+#include <fstream>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "arena.h"
+#include "setupStore.h"
+
+/*========================================
+* Tournois entre bots
+*=========================================
+*/
+
+namespace stratego{
+
+    /**
+     * Système d'appariement d'un tournoi.
+     */
+    enum class Pairing : char{
+        ROUND_ROBIN,
+        SWISS
+    };
+
+    /**
+     * Paramètres d'un tournoi (cf. Tournament).
+     */
+    struct TournamentSettings{
+
+        /**
+         * Système d'appariement.
+         */
+        Pairing pairing = Pairing::ROUND_ROBIN;
+
+        /**
+         * Nombre de cycles d'un tournoi toutes rondes, ou nombre de rondes d'un tournoi suisse.
+         */
+        int rounds = 1;
+
+        /**
+         * Nombre de tours au bout duquel une partie est arbitrée (cf. Arena).
+         */
+        int maxTurns = Arena::DEFAULT_MAX_TURNS;
+
+        /**
+         * Écart de pions capturés attribuant la victoire d'une partie arbitrée (cf. Arena).
+         */
+        int materialMargin = 0;
+
+        /**
+         * Contrôle du temps des parties (non chronométrées par défaut).
+         */
+        model::TimeControl timeControl = {};
+
+        /**
+         * true pour jouer la variante Reveal, false pour la version classique.
+         */
+        bool reveal = false;
+
+        /**
+         * Graine dont dépendent les appariements, les dispositions et les graines des bots.
+         */
+        std::uint64_t seed = 1;
+    };
+
+    /**
+     * Bilan des parties d'un bot (contre un adversaire ou contre tous).
+     */
+    struct Score{
+        int wins;
+        int draws;
+        int losses;
+
+        /**
+         * Calcule le nombre de points du bilan (une égalité comptant pour un demi-point).
+         *
+         * @return le nombre de points du bilan.
+         */
+        double points() const noexcept;
+
+        /**
+         * Calcule le nombre de parties du bilan.
+         *
+         * @return le nombre de parties du bilan.
+         */
+        int games() const noexcept;
+    };
+
+    /**
+     * Classement Elo d'un bot et marge d'erreur de ce classement.
+     */
+    struct Rating{
+        double elo;
+        double margin;
+    };
+
+    /**
+     * Calcule le classement Elo de chaque bot depuis les bilans de leurs confrontations, par maximum
+     * de vraisemblance du modèle de Bradley-Terry (logistique, 400 points d'écart pour une espérance
+     * de 10 contre 1). Comme BayesElo, chaque bot dispute en plus prior nulles virtuelles contre un
+     * adversaire classé 0: les classements restent finis lorsqu'un bot gagne ou perd toutes ses
+     * parties. Les classements sont centrés sur 0.
+     *
+     * @param results les bilans de chaque bot (ligne) contre chaque adversaire (colonne)
+     * @param prior le nombre de nulles virtuelles de chaque bot
+     * @param z le quantile de la loi normale correspondant au niveau de confiance des marges
+     * @return le classement de chaque bot.
+     */
+    std::vector<Rating> eloRatings(const std::vector<std::vector<Score>>& results, double prior = 2, double z = 1.96);
+
+    /**
+     * Confrontation de deux bots lors d'une ronde, jouée en deux parties: first joue rouge puis
+     * bleu, avec les mêmes dispositions. Un bot exempté de la ronde est apparié à BYE.
+     */
+    struct Encounter{
+        static constexpr int BYE = -1;
+
+        int first;
+        int second;
+    };
+
+    /**
+     * Partie jouée lors d'un tournoi.
+     */
+    struct GameRecord{
+        int round;
+        int encounter;
+        int leg;
+        int red;
+        int blue;
+        GameOutcome outcome;
+
+        /**
+         * true si la partie a été perdue par forfait: le bot perdant n'a pu être démarré, a échoué à
+         * choisir un coup ou a joué un coup invalide.
+         */
+        bool forfeit;
+    };
+
+    /**
+     * Tournoi entre bots (cf. Bot::create()), toutes rondes ou suisse. Chaque confrontation se joue
+     * en deux parties sur les mêmes dispositions, les couleurs étant inversées: aucun bot n'est
+     * avantagé par sa couleur ou par les dispositions tirées. Les parties d'une ronde sont jouées
+     * en parallèle par un ensemble de threads; une partie trop longue est arbitrée par l'Arena.
+     *
+     * Toutes les parties ne dépendent que de la graine du tournoi. Un fichier de reprise (cf.
+     * resume()) conserve l'issue de chaque partie terminée: un tournoi interrompu reprend là où il
+     * s'est arrêté.
+     */
+    class Tournament{
+
+        std::vector<std::string> bots_;
+        TournamentSettings settings_;
+        model::SetupStore pool_;
+        std::vector<std::vector<Encounter>> rounds_;
+        std::vector<GameRecord> games_;
+        std::set<std::tuple<int, int, int>> played_;
+        std::vector<std::vector<Score>> results_;
+        std::vector<int> byes_;
+        std::ofstream checkpoint_;
+
+        public:
+
+            /**
+             * Construit un tournoi.
+             *
+             * @throw std::invalid_argument si moins de deux bots sont donnés ou si le nombre de
+             * rondes n'est pas positif
+             *
+             * @param bots les noms des bots participants (cf. Bot::create())
+             * @param settings les paramètres du tournoi
+             * @param pool les dispositions tirées au hasard pour les parties (générées par
+             * SetupGenerator si aucune n'est donnée)
+             */
+            Tournament(std::vector<std::string> bots, const TournamentSettings& settings, model::SetupStore pool = {});
+
+            /**
+             * Reprend le tournoi depuis le fichier de reprise donné, créé s'il n'existe pas, puis y
+             * enregistre l'issue de chaque nouvelle partie. Une ligne tronquée par l'interruption du
+             * tournoi est ignorée.
+             *
+             * @throw std::invalid_argument si le fichier ne peut être écrit ou s'il décrit un autre
+             * tournoi
+             *
+             * @param filepath le chemin du fichier de reprise
+             */
+            void resume(const std::string& filepath);
+
+            /**
+             * Joue les parties restantes du tournoi. La fonction de suivi est appelée après chaque
+             * partie, une seule à la fois: elle peut consulter le tournoi.
+             *
+             * @throw std::invalid_argument si le fichier de reprise ne peut plus être écrit
+             *
+             * @param threads le nombre de parties jouées simultanément
+             * @param progress la fonction de suivi, appelée avec la partie terminée
+             */
+            void run(int threads, const std::function<void(const GameRecord&)>& progress = {});
+
+            /**
+             * Calcule le nombre de rondes du tournoi.
+             *
+             * @return le nombre de rondes du tournoi.
+             */
+            int roundCount() const noexcept;
+
+            /**
+             * Calcule le nombre de parties du tournoi (deux par confrontation).
+             *
+             * @return le nombre de parties du tournoi.
+             */
+            int gameCount() const noexcept;
+
+            /**
+             * Récupère les bots participants.
+             *
+             * @return les noms des bots participants.
+             */
+            const std::vector<std::string>& bots() const noexcept;
+
+            /**
+             * Récupère les confrontations des rondes commencées.
+             *
+             * @return les confrontations de chaque ronde commencée.
+             */
+            const std::vector<std::vector<Encounter>>& rounds() const noexcept;
+
+            /**
+             * Récupère les parties jouées, dans l'ordre où elles se sont terminées.
+             *
+             * @return les parties jouées.
+             */
+            const std::vector<GameRecord>& games() const noexcept;
+
+            /**
+             * Récupère les bilans de chaque bot (ligne) contre chaque adversaire (colonne).
+             *
+             * @return les bilans des confrontations.
+             */
+            const std::vector<std::vector<Score>>& results() const noexcept;
+
+            /**
+             * Calcule le bilan d'un bot contre tous ses adversaires.
+             *
+             * @param bot l'indice du bot
+             * @return le bilan du bot.
+             */
+            Score score(int bot) const;
+
+            /**
+             * Calcule le nombre de points d'un bot au classement du tournoi: les points de ses
+             * parties et, en système suisse, deux points par ronde exemptée (les deux parties d'une
+             * confrontation).
+             *
+             * @param bot l'indice du bot
+             * @return le nombre de points du bot.
+             */
+            double points(int bot) const;
+
+            /**
+             * Calcule le classement Elo des bots depuis les parties jouées (cf. eloRatings()).
+             *
+             * @return le classement de chaque bot.
+             */
+            std::vector<Rating> ratings() const;
+
+            /**
+             * Calcule les confrontations d'une ronde d'un tournoi toutes rondes (méthode du cercle):
+             * chaque bot rencontre chacun de ses adversaires une fois sur (bots - 1) rondes, (bots)
+             * rondes pour un nombre impair de bots.
+             *
+             * @param bots le nombre de bots
+             * @param round l'indice de la ronde
+             * @return les confrontations de la ronde.
+             */
+            static std::vector<Encounter> roundRobin(int bots, int round);
+
+        private:
+
+            /*
+             * Calcule les confrontations de la ronde suivante depuis les parties jouées.
+             */
+            std::vector<Encounter> nextRound();
+
+            /*
+             * Apparie les bots selon le système suisse.
+             */
+            std::vector<Encounter> swiss();
+
+            /*
+             * Enregistre une partie jouée.
+             */
+            void record(const GameRecord& game);
+
+            /*
+             * Joue une partie d'une confrontation. Seul l'échec d'un bot (création ou BotFailure) est
+             * sanctionné d'un forfait: toute autre erreur est propagée.
+             */
+            GameRecord play(int round, int encounter, int leg) const;
+
+            /*
+             * Décrit le tournoi en tête du fichier de reprise.
+             */
+            std::string header() const;
+    };
+}
+
+#endif // TOURNAMENT_H
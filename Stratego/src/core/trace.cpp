@@ -0,0 +1,134 @@
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+
+#include "trace.h"
+
+using namespace stratego;
+
+namespace{
+
+    struct Event{
+        const char* name;
+        std::uint64_t begin;
+        std::uint64_t end;
+    };
+
+    /*
+     * Tampon d'un thread: seul son thread propriétaire y écrit, la publication des intervalles
+     * se faisant par le compteur atomique (release/acquire). Les tampons sont chaînés dans une liste
+     * globale, jamais libérée, afin de pouvoir exporter les intervalles des threads terminés.
+     */
+    struct Buffer{
+        std::array<Event, trace::BUFFER_CAPACITY> events;
+        std::atomic<std::size_t> count;
+        std::atomic<std::size_t> dropped;
+        std::uint32_t tid;
+        Buffer* next;
+    };
+
+    std::atomic<Buffer*> buffers {nullptr};
+    std::atomic<std::uint32_t> threadCount {0};
+    const auto epoch {std::chrono::steady_clock::now()};
+
+    std::uint64_t now() noexcept{
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    Buffer* localBuffer() noexcept{
+        thread_local Buffer* local {};
+        if(!local){
+            local = new (std::nothrow) Buffer{{}, {0}, {0}, ++threadCount, buffers.load(std::memory_order_relaxed)};
+            if(local){
+                while(!buffers.compare_exchange_weak(local -> next, local, std::memory_order_release, std::memory_order_relaxed));
+            }
+        }
+
+        return local;
+    }
+
+    /*
+     * Écrit la chaîne donnée en échappant les caractères réservés de JSON.
+     */
+    void writeString(std::ostream& out, const char* str){
+        out << '"';
+        for(; *str; str++){
+            if(*str == '"' || *str == '\\')
+                out << '\\';
+            out << *str;
+        }
+        out << '"';
+    }
+}
+
+trace::Span::Span(const char* name) noexcept :
+    name_ {name},
+    begin_ {now()}
+{}
+
+trace::Span::~Span() noexcept{
+    std::uint64_t end {now()};
+    Buffer* buffer {localBuffer()};
+    if(!buffer)
+        return;
+
+    std::size_t count {buffer -> count.load(std::memory_order_relaxed)};
+    if(count == BUFFER_CAPACITY){
+        buffer -> dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer -> events[count] = {name_, begin_, end};
+    buffer -> count.store(count + 1, std::memory_order_release);
+}
+
+std::size_t trace::recorded() noexcept{
+    std::size_t total {};
+    for(Buffer* buffer {buffers.load(std::memory_order_acquire)}; buffer; buffer = buffer -> next)
+        total += buffer -> count.load(std::memory_order_acquire);
+
+    return total;
+}
+
+std::size_t trace::dropped() noexcept{
+    std::size_t total {};
+    for(Buffer* buffer {buffers.load(std::memory_order_acquire)}; buffer; buffer = buffer -> next)
+        total += buffer -> dropped.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+void trace::clear() noexcept{
+    for(Buffer* buffer {buffers.load(std::memory_order_acquire)}; buffer; buffer = buffer -> next){
+        buffer -> count.store(0, std::memory_order_release);
+        buffer -> dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+void trace::writeChrome(std::ostream& out){
+    out << "{\"traceEvents\":[";
+    bool first {true};
+    for(Buffer* buffer {buffers.load(std::memory_order_acquire)}; buffer; buffer = buffer -> next){
+        std::size_t count {buffer -> count.load(std::memory_order_acquire)};
+        for(std::size_t i = 0; i < count; i++){
+            const Event& event {buffer -> events[i]};
+            out << (first ? "\n" : ",\n") << "{\"name\":";
+            writeString(out, event.name);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer -> tid
+                << ",\"ts\":" << event.begin / 1000 << '.' << event.begin % 1000 / 100
+                << ",\"dur\":" << (event.end - event.begin) / 1000 << '.' << (event.end - event.begin) % 1000 / 100 << '}';
+            first = false;
+        }
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+void trace::exportChrome(const std::string& filepath){
+    std::ofstream ofs {filepath, std::ios::trunc};
+    if(ofs.fail())
+        throw std::invalid_argument("Cannot open the given file");
+
+    writeChrome(ofs);
+}
@@ -0,0 +1,104 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+/*========================================
+* Instrumentation du temps passé dans les
+* différentes couches de l'application
+*=========================================
+*/
+
+namespace stratego::trace {
+
+    /**
+     * Intervalle de temps mesuré, depuis sa construction jusqu'à sa destruction, et enregistré dans
+     * le tampon du thread courant. Chaque thread écrit uniquement dans son propre tampon (sans
+     * verrou): les intervalles enregistrés au-delà de sa capacité sont ignorés et comptabilisés par
+     * dropped().
+     *
+     * Cette classe n'est normalement pas employée directement mais au travers de la macro
+     * STRATEGO_TRACE_SCOPE, qui ne produit aucun code si STRATEGO_TRACE n'est pas défini
+     * (qmake CONFIG+=trace).
+     */
+    class Span{
+
+        const char* name_;
+        std::uint64_t begin_;
+
+        public:
+
+            /**
+             * Débute un intervalle de temps.
+             *
+             * @param name le nom de l'intervalle, devant rester valide jusqu'à l'exportation (littéral)
+             */
+            explicit Span(const char* name) noexcept;
+
+            Span(const Span&) = delete;
+            Span& operator=(const Span&) = delete;
+
+            /**
+             * Termine l'intervalle de temps et l'enregistre.
+             */
+            ~Span() noexcept;
+    };
+
+    /**
+     * Nombre maximal d'intervalles enregistrés par thread.
+     */
+    constexpr std::size_t BUFFER_CAPACITY = 1 << 16;
+
+    /**
+     * Récupère le nombre d'intervalles enregistrés, tous threads confondus.
+     *
+     * @return le nombre d'intervalles enregistrés.
+     */
+    std::size_t recorded() noexcept;
+
+    /**
+     * Récupère le nombre d'intervalles ignorés faute de place dans les tampons.
+     *
+     * @return le nombre d'intervalles ignorés.
+     */
+    std::size_t dropped() noexcept;
+
+    /**
+     * Vide les tampons de l'ensemble des threads. Aucun intervalle ne doit être en cours
+     * d'enregistrement lors de l'appel.
+     */
+    void clear() noexcept;
+
+    /**
+     * Écrit les intervalles enregistrés au format Chrome Trace Event (JSON), lisible par
+     * chrome://tracing ou Perfetto.
+     *
+     * @param out le flux dans lequel écrire
+     */
+    void writeChrome(std::ostream& out);
+
+    /**
+     * Écrit les intervalles enregistrés au format Chrome Trace Event dans le fichier donné.
+     *
+     * @throw std::invalid_argument si le fichier ne peut être ouvert
+     *
+     * @param filepath le chemin du fichier à écrire
+     */
+    void exportChrome(const std::string& filepath);
+}
+
+#define STRATEGO_TRACE_CONCAT_(a, b) a##b
+#define STRATEGO_TRACE_CONCAT(a, b) STRATEGO_TRACE_CONCAT_(a, b)
+
+#ifdef STRATEGO_TRACE
+#define STRATEGO_TRACE_SCOPE(name) ::stratego::trace::Span STRATEGO_TRACE_CONCAT(traceSpan_, __LINE__) {name}
+#define STRATEGO_TRACE_EXPORT(filepath) ::stratego::trace::exportChrome(filepath)
+#else
+#define STRATEGO_TRACE_SCOPE(name) static_cast<void>(0)
+#define STRATEGO_TRACE_EXPORT(filepath) static_cast<void>(0)
+#endif
+
+#endif // TRACE_H
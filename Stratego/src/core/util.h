@@ -8,12 +8,22 @@
 */
 
 #include <algorithm>
+#include <fstream>
 #include <sstream>
+#include <stdexcept>
+#include <string_view>
 #include <vector>
 #include <iostream>
 
 #include <dirent.h>
 #include <stdlib.h>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #define OS_WIN 0
 #define OS_UNIX 1
@@ -83,6 +93,19 @@ namespace util {
         });
     }
 
+    /**
+     * Compare deux chaînes sans tenir compte de la casse (conforme au locale C employé).
+     *
+     * @param str1 la première chaîne
+     * @param str2 la deuxième chaîne
+     * @return true si les deux chaînes sont égales à la casse près, false si non.
+     */
+    inline bool striequals(std::string_view str1, std::string_view str2) noexcept{
+        return str1.size() == str2.size() && std::equal(str1.begin(), str1.end(), str2.begin(), [](unsigned char c1, unsigned char c2){
+            return std::tolower(c1) == std::tolower(c2);
+        });
+    }
+
     /**
      * Vérifié si la chaîne donnée est convertible en entier.
      *
@@ -168,6 +191,80 @@ namespace util {
         return result;
     }
 
+    /**
+     * Fichier chargé en lecture seule. Sous unix et apple, le fichier est projeté en mémoire (mmap)
+     * et son contenu est accessible sans copie. Sous windows, le fichier est lu en une seule fois.
+     */
+    class MappedFile{
+
+        const char* data_;
+        size_t size_;
+        std::string buffer_;
+
+        public:
+
+            MappedFile(const MappedFile& file) = delete;
+            MappedFile& operator=(const MappedFile& file) = delete;
+
+            /**
+             * Charge le fichier identifié par le chemin donné.
+             *
+             * @throw std::invalid_argument si le fichier ne peut être ouvert
+             *
+             * @param filepath le chemin vers le fichier à charger
+             */
+            MappedFile(const std::string& filepath) : data_ {}, size_ {}, buffer_ {}{
+#ifndef _WIN32
+                int fd {::open(filepath.c_str(), O_RDONLY)};
+                struct stat info {};
+                if(fd == -1 || fstat(fd, &info) == -1 || !S_ISREG(info.st_mode)){
+                    if(fd != -1) ::close(fd);
+                    throw std::invalid_argument("Cannot open the given file");
+                }
+
+                size_ = static_cast<size_t>(info.st_size);
+                if(size_){
+                    void* addr {mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0)};
+                    if(addr == MAP_FAILED){
+                        ::close(fd);
+                        throw std::invalid_argument("Cannot map the given file");
+                    }
+
+                    data_ = static_cast<const char*>(addr);
+                }
+
+                ::close(fd);
+#else
+                std::ifstream ifs {filepath, std::ios::binary};
+                if(ifs.fail())
+                    throw std::invalid_argument("Cannot open the given file");
+
+                buffer_.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+                data_ = buffer_.data();
+                size_ = buffer_.size();
+#endif
+            }
+
+            /**
+             * Récupère le contenu du fichier.
+             *
+             * @return une vue sur le contenu du fichier.
+             */
+            std::string_view content() const noexcept{
+                return {data_, size_};
+            }
+
+            /**
+             * Libère le fichier chargé.
+             */
+            ~MappedFile(){
+#ifndef _WIN32
+                if(data_)
+                    munmap(const_cast<char*>(data_), size_);
+#endif
+            }
+    };
+
     /**
      * Localise la cible dans la chaîne path donnée.
      *
@@ -0,0 +1,258 @@
+#ifndef VARIANT_H
+#define VARIANT_H
+
+#include <algorithm>
+#include <cstdint>
+
+#include "gamestuff.h"
+
+/*========================================
+* Variantes de jeu: topologie du plateau
+* et composition des armées
+*=========================================
+*/
+
+namespace stratego::model {
+
+    /**
+     * Variante classique: plateau de 10x10 cases, deux lacs de 2x2 cases au centre et armées
+     * complètes de 40 pions sur 4 rangées.
+     *
+     * Une variante est décrite par les membres statiques suivants:
+     * - NAME: le nom de la variante;
+     * - SIZE: le côté de la zone de jeu, hors murs;
+     * - ROWS: le nombre de rangées de mise en place de chaque joueur;
+     * - LAKES: les cases d'eau, en coordonnées du plateau (murs compris);
+     * - ARMY: le nombre de pions de chaque rang, indexé par rang.
+     *
+     * Toute structure respectant cette description, lacs personnalisés compris, peut être utilisée
+     * par Topology et BasicMoveGen.
+     */
+    struct ClassicVariant{
+        static constexpr std::string_view NAME {"classic"};
+        static constexpr int SIZE {Config::BOARD_SIZE - 2};
+        static constexpr int ROWS {4};
+        static constexpr std::array<Position, 8> LAKES {{
+            {3, 5}, {4, 5}, {3, 6}, {4, 6}, {7, 5}, {8, 5}, {7, 6}, {8, 6}
+        }};
+        static constexpr std::array<int, Config::PIECE_MAX_RANK + 1> ARMY {
+            Config::PIECE_FLAG_INFO.count, Config::PIECE_SPY_INFO.count, Config::PIECE_SCOUT_INFO.count,
+            Config::PIECE_MINER_INFO.count, Config::PIECE_SERGENT_INFO.count, Config::PIECE_LIEUTENANT_INFO.count,
+            Config::PIECE_CAPTAIN_INFO.count, Config::PIECE_MAJOR_INFO.count, Config::PIECE_COLONEL_INFO.count,
+            Config::PIECE_GENERAL_INFO.count, Config::PIECE_MARSHAL_INFO.count, Config::PIECE_BOMB_INFO.count
+        };
+    };
+
+    /**
+     * Variante Barrage: plateau classique, armées réduites à 8 pions (drapeau, bombe, espionne,
+     * deux éclaireurs, démineur, général et maréchal) placés librement sur les 4 rangées.
+     */
+    struct BarrageVariant : ClassicVariant{
+        static constexpr std::string_view NAME {"barrage"};
+        static constexpr std::array<int, Config::PIECE_MAX_RANK + 1> ARMY {1, 1, 2, 1, 0, 0, 0, 0, 0, 1, 1, 1};
+    };
+
+    /**
+     * Variante Duel: plateau de 8x8 cases, deux lacs de 1x2 cases et armées de 24 pions sur 3
+     * rangées.
+     */
+    struct DuelVariant{
+        static constexpr std::string_view NAME {"duel"};
+        static constexpr int SIZE {8};
+        static constexpr int ROWS {3};
+        static constexpr std::array<Position, 4> LAKES {{{3, 4}, {3, 5}, {6, 4}, {6, 5}}};
+        static constexpr std::array<int, Config::PIECE_MAX_RANK + 1> ARMY {1, 1, 4, 3, 2, 2, 2, 2, 1, 1, 1, 4};
+    };
+
+    /**
+     * Constantes de topologie d'une variante, calculées à la compilation: dimensions du plateau
+     * (murs compris), masque des cases d'eau, table des cases voisines et placement des armées. Les
+     * cases sont indexées (y * SIZE + x), comme le fait MoveGen.
+     *
+     * @tparam Variant la variante décrite (cf. ClassicVariant)
+     */
+    template<class Variant>
+    struct Topology{
+
+        /**
+         * Côté du plateau de jeu, murs compris.
+         */
+        static constexpr int SIZE {Variant::SIZE + 2};
+
+        /**
+         * Nombre de cases du plateau de jeu, murs compris.
+         */
+        static constexpr int SQUARES {SIZE * SIZE};
+
+        /**
+         * Nombre d'emplacements d'une disposition (rangées de mise en place).
+         */
+        static constexpr int SLOTS {Variant::ROWS * Variant::SIZE};
+
+        /**
+         * Valeur d'un emplacement de disposition ne contenant aucun pion.
+         */
+        static constexpr int EMPTY_SLOT {-1};
+
+        /**
+         * Nombre de pions d'une armée.
+         */
+        static constexpr int ARMY_SIZE {[](){
+            int size {};
+            for(int count : Variant::ARMY)
+                size += count;
+            return size;
+        }()};
+
+        /**
+         * Disposition d'une armée: rang du pion de chaque emplacement (ou EMPTY_SLOT), rangée du
+         * fond en premier, comme pour LayoutParser.
+         */
+        using Layout = std::array<int, SLOTS>;
+
+        static_assert(SQUARES <= 256, "Squares must be indexable by a byte");
+        static_assert(2 * ARMY_SIZE <= 127, "Pieces must be indexable by a signed byte");
+        static_assert(ARMY_SIZE <= SLOTS, "The army does not fit in the setup rows");
+        static_assert(2 * Variant::ROWS < Variant::SIZE, "The setup areas must be separated");
+
+        /**
+         * Décalages d'indice vers les cases voisines (même ordre que Bot::legalMoves()).
+         */
+        static constexpr std::array<int, 4> DIRECTIONS {SIZE, -SIZE, 1, -1};
+
+        /**
+         * Masque des cases d'eau.
+         */
+        static constexpr std::array<bool, SQUARES> WATER {[](){
+            std::array<bool, SQUARES> water {};
+            for(const Position& lake : Variant::LAKES)
+                water[lake.y * SIZE + lake.x] = true;
+            return water;
+        }()};
+
+        /**
+         * Masque des cases praticables (ni mur, ni eau).
+         */
+        static constexpr std::array<bool, SQUARES> WALKABLE {[](){
+            std::array<bool, SQUARES> walkable {};
+            for(int square = 0; square < SQUARES; square++){
+                int x {square % SIZE}, y {square / SIZE};
+                walkable[square] = x > 0 && x < SIZE - 1 && y > 0 && y < SIZE - 1 && !WATER[square];
+            }
+            return walkable;
+        }()};
+
+        /**
+         * Cases praticables voisines de chaque case, dans l'ordre de DIRECTIONS, complétées par -1.
+         */
+        static constexpr std::array<std::array<std::int16_t, 4>, SQUARES> NEIGHBOURS {[](){
+            std::array<std::array<std::int16_t, 4>, SQUARES> neighbours {};
+            for(int square = 0; square < SQUARES; square++){
+                int count {};
+                for(int dir : DIRECTIONS){
+                    int to {square + dir};
+                    if(to >= 0 && to < SQUARES && WALKABLE[to])
+                        neighbours[square][count++] = static_cast<std::int16_t>(to);
+                }
+                while(count < 4)
+                    neighbours[square][count++] = -1;
+            }
+            return neighbours;
+        }()};
+
+        static_assert([](){
+            for(const Position& lake : Variant::LAKES){
+                if(lake.x < 1 || lake.x > Variant::SIZE || lake.y <= Variant::ROWS || lake.y > Variant::SIZE - Variant::ROWS)
+                    return false;
+            }
+            return true;
+        }(), "Lakes must lie between the setup areas");
+
+        /**
+         * Convertit une position en indice de case.
+         *
+         * @param pos la position à convertir
+         * @return l'indice de case correspondant.
+         */
+        static constexpr int toSquare(const Position& pos) noexcept{
+            return pos.y * SIZE + pos.x;
+        }
+
+        /**
+         * Convertit un indice de case en position.
+         *
+         * @param square l'indice de case à convertir
+         * @return la position correspondante.
+         */
+        static constexpr Position toPosition(int square) noexcept{
+            return {square % SIZE, square / SIZE};
+        }
+
+        /**
+         * Calcule la case de l'emplacement de disposition donné, placée comme le ferait LayoutParser:
+         * la rangée du fond du joueur rouge est la dernière rangée du plateau, celle du joueur bleu la
+         * première.
+         *
+         * @param color la couleur du joueur
+         * @param slot l'indice d'emplacement dans la disposition
+         * @return l'indice de la case correspondante.
+         */
+        static constexpr int setupSquare(Color color, int slot) noexcept{
+            int row {slot / Variant::SIZE};
+            int x {slot % Variant::SIZE + 1};
+            return toSquare({x, color == Color::RED ? SIZE - 2 - row : 1 + row});
+        }
+
+        /**
+         * Vérifie si la disposition donnée décrit une armée complète de la variante: chaque rang
+         * apparaît le nombre de fois prévu et les autres emplacements sont vides.
+         *
+         * @param layout la disposition à vérifier
+         * @return true si la disposition est une armée complète, false si non.
+         */
+        static constexpr bool isArmy(const Layout& layout) noexcept{
+            std::array<int, Config::PIECE_MAX_RANK + 1> hist {};
+            for(int rank : layout){
+                if(rank == EMPTY_SLOT)
+                    continue;
+                if(rank < Config::PIECE_MIN_RANK || rank > Config::PIECE_MAX_RANK)
+                    return false;
+
+                ++hist[rank];
+            }
+
+            for(int rank = Config::PIECE_MIN_RANK; rank <= Config::PIECE_MAX_RANK; rank++){
+                if(hist[rank] != Variant::ARMY[rank])
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * Tire une disposition aléatoire (sans garantie de mobilité) de la variante.
+         *
+         * @param rng le générateur aléatoire à utiliser
+         * @return une disposition aléatoire.
+         */
+        template<class URBG>
+        static Layout randomLayout(URBG& rng){
+            Layout layout {};
+            layout.fill(EMPTY_SLOT);
+            int slot {};
+            for(int rank = Config::PIECE_MIN_RANK; rank <= Config::PIECE_MAX_RANK; rank++){
+                for(int i = 0; i < Variant::ARMY[rank]; i++)
+                    layout[slot++] = rank;
+            }
+
+            std::shuffle(layout.begin(), layout.end(), rng);
+            return layout;
+        }
+    };
+
+    static_assert(Topology<ClassicVariant>::SIZE == Config::BOARD_SIZE, "The classic variant must match Board");
+    static_assert(Topology<ClassicVariant>::ARMY_SIZE == Config::ARMY_SIZE, "The classic variant must match Config");
+    static_assert(Topology<ClassicVariant>::SLOTS == Config::ARMY_SIZE, "The classic variant must match LayoutParser");
+}
+
+#endif // VARIANT_H
@@ -0,0 +1,9 @@
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../config.pri)
+
+SOURCES += \
+        main.cpp
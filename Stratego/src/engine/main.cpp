@@ -0,0 +1,94 @@
+#include <atomic>
+#include <optional>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <config.h>
+#include <engineBot.h>
+#include <searchEngine.h>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    int usage(){
+        std::cerr << "Utilisation: engine [profondeur]\n"
+                  << "Moteur de référence dialoguant selon le protocole de EngineBot sur son entrée et sa sortie standard.\n";
+
+        return 1;
+    }
+
+    /*
+     * Choisit le coup du moteur parmi les coups permis: la suggestion du moteur de recherche, ou le
+     * premier coup permis si la suggestion ne l'est pas (ou si le temps de réflexion est écoulé avant
+     * la fin de la première profondeur).
+     */
+    std::optional<BotMove> bestMove(const Observation& obs, const std::vector<BotMove>& allowed, int maxDepth,
+                                    SearchEngine::Clock::time_point deadline){
+        if(allowed.empty())
+            return std::nullopt;
+
+        std::atomic<bool> stop {false};
+        SearchEngine engine {stop, deadline};
+        std::optional<Hint> hint {engine.search(SearchEngine::position(obs), maxDepth)};
+        for(const BotMove& move : allowed){
+            if(hint && move.start == hint -> start && move.end == hint -> end)
+                return move;
+        }
+
+        return allowed.front();
+    }
+}
+
+int main(int argc, char** argv){
+    Config::setDynamicResources(argv[0]);
+    if(argc > 2)
+        return usage();
+
+    int maxDepth {argc == 2 ? std::stoi(argv[1]) : SearchBot::MAX_DEPTH};
+    Color color {Color::RED};
+    Observation obs {};
+    std::vector<BotMove> moves {};
+    std::string line;
+    while(std::getline(std::cin, line)){
+        std::istringstream stream {line};
+        std::string command;
+        stream >> command;
+        if(command == "sep"){
+            std::cout << "id name search" << maxDepth << "\nsepok" << std::endl;
+        } else if(command == "isready"){
+            std::cout << "readyok" << std::endl;
+        } else if(command == "newgame"){
+            std::string name;
+            stream >> name;
+            color = name == "blue" ? Color::BLUE : Color::RED;
+        } else if(command == "position"){
+            if(!EngineBot::parsePosition(line, color, obs, moves))
+                std::cout << "info string invalid position" << std::endl;
+        } else if(command == "go"){
+            SearchEngine::Clock::time_point deadline {SearchEngine::Clock::time_point::max()};
+            std::vector<BotMove> allowed {};
+            std::string word;
+            while(stream >> word && word != "searchmoves"){
+                std::string value;
+                stream >> value;
+                if(word == "movetime")
+                    deadline = SearchEngine::Clock::now() + std::chrono::milliseconds{std::stoll(value)};
+            }
+            while(stream >> word){
+                BotMove move {};
+                if(EngineBot::parseMove(word, move))
+                    allowed.push_back(move);
+            }
+
+            std::optional<BotMove> move {bestMove(obs, allowed, maxDepth, deadline)};
+            std::cout << "bestmove " << (move ? EngineBot::formatMove(*move) : "none") << std::endl;
+        } else if(command == "quit"){
+            break;
+        }
+    }
+
+    return 0;
+}
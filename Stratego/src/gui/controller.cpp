@@ -1,3 +1,5 @@
+#include <trace.h>
+
 #include "vcstuff.h"
 
 using namespace stratego;
@@ -36,10 +38,16 @@ void Controller::nextPlayer(){
 }
 
 void Controller::moveAttack(const model::Position &startPos, const model::Position &endPos){
+    STRATEGO_TRACE_SCOPE("Controller::moveAttack");
     model_ -> moveAttack(startPos, endPos);
 }
 
+void Controller::timeout(){
+    model_ -> timeout();
+}
+
 void Controller::nextTurn(){
+    STRATEGO_TRACE_SCOPE("Controller::nextTurn");
     model_ -> nextTurn();
 }
 
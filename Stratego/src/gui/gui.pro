@@ -17,10 +17,12 @@ SOURCES += \
     qcomponent.cpp \
     qconfigwindow.cpp \
     qendgamedialog.cpp \
+    qengine.cpp \
     qgamewindow.cpp \
     qgraveyard.cpp \
     qinputconfig.cpp \
     qpanel.cpp \
+    qperfpanel.cpp \
     qpiece.cpp \
     qpiecestats.cpp \
     qpiecestorage.cpp \
@@ -35,9 +37,11 @@ HEADERS += \
     qboard.h \
     qcell.h \
     qcomponent.h \
+    qengine.h \
     qgraveyard.h \
     qinputconfig.h \
     qpanel.h \
+    qperfpanel.h \
     qpiece.h \
     qpiecestats.h \
     qpiecestorage.h \
@@ -1,6 +1,8 @@
 #include <QApplication>
 #include <QMessageBox>
 #include <QScreen>
+#include <allocTracker.h>
+#include <trace.h>
 
 #include "vcstuff.h"
 
@@ -11,12 +13,24 @@ int main(int argc, char *argv[]){
 
     QApplication a(argc, argv);
     Model* model {new Stratego};
+    if(argc > 1){ // partie chronométrée: cadence "minutes[+secondes d'incrément]"
+        try{
+            model -> setTimeControl(model::TimeControl::parse(argv[1]));
+        } catch(const std::invalid_argument&){
+            QMessageBox::critical(nullptr, "Erreur", QString{"La cadence '%1' n'est pas valide (ex: 5+3, 10)."}.arg(argv[1]));
+            delete model;
+            return 1;
+        }
+    }
+
     Controller controller {model};
     int ret;
 
     controller.start();
     ret = a.exec();
     delete model;
+    STRATEGO_TRACE_EXPORT("stratego-trace.json");
+    STRATEGO_ALLOC_REPORT(std::cerr);
 
     return ret;
 }
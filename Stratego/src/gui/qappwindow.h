@@ -4,10 +4,12 @@
 #include <QFrame>
 #include <QVBoxLayout>
 #include <QThread>
+#include <QTimer>
 #include <model.h>
 
 #include "qcomponent.h"
 #include "qcell.h"
+#include "qengine.h"
 #include "qpanel.h"
 #include "qinputconfig.h"
 
@@ -143,9 +145,15 @@ namespace stratego::view{
         const Model* model_;
         QVBoxLayout* container_;
         QLabel* title_;
+        QLabel* clocks_;
+        QTimer* clockTimer_;
         QPushButton* nextButton_;
+        QPushButton* hintButton_;
+        QPushButton* autoButton_;
+        QPushButton* analysisButton_;
         QGamePanel* gamePanel_;
         QCell* lastClickedBoardCell_;
+        QEngine* engine_;
 
         public:
 
@@ -183,6 +191,9 @@ namespace stratego::view{
         private:
 
             void updateTitle();
+            void updateClocks();
+            void cancelEngine();
+            void requestEngine(EngineRequest::Kind kind, int maxDepth);
 
         private slots:
 
@@ -191,6 +202,15 @@ namespace stratego::view{
             void error(const QString& error);
             void next();
             void clicked(stratego::view::QCell* cell);
+            void hint();
+            void autoPlay();
+            void analyse();
+            void engineProgressed(stratego::view::EngineRequest::Kind kind, const stratego::Hint& hint);
+            void hintFound(const stratego::Hint& hint);
+            void moveChosen(const model::Position& startPos, const model::Position& endPos);
+            void analysed(const stratego::view::EngineAnalysis& analysis);
+            void engineFailed();
+            void tick();
 
         signals:
 
@@ -229,6 +249,21 @@ namespace stratego::view{
              * Signale que le bouton "next" a été cliqué.
              */
             void nextClicked();
+
+            /**
+             * Signale que le moteur de jeu a produit une information à afficher (progression d'une
+             * recherche, suggestion de coup ou analyse de la position).
+             *
+             * @param info l'information à afficher
+             * @param timeout le temps d'affichage de l'information (référez vous à la documentation du
+             * slot "showMessage()" de la classe QStatusBar)
+             */
+            void engineUpdated(const QString& info, int timeout = 0);
+
+            /**
+             * Signale que le temps du joueur courant s'est écoulé avant qu'il n'ait agi.
+             */
+            void timedOut();
     };
 }
 #endif // QAPPWINDOW_H
@@ -2,6 +2,9 @@
 #include <QMimeData>
 #include <regex>
 #include <../core/util.h>
+#include <allocTracker.h>
+#include <perf.h>
+#include <trace.h>
 
 #include "qboard.h"
 
@@ -12,7 +15,8 @@ QBoard::QBoard(const Model* model, QWidget* parent) :
     container_ {new QGridLayout},
     cells_ {},
     model_ {model},
-    lastClickedCells_ {}
+    lastClickedCells_ {},
+    viewer_ {}
 {
     const model::Board& board {model_ -> board()};
     for(int i = 0; i < board.size(); i++){
@@ -50,44 +54,39 @@ void QBoard::decompose(){
 }
 
 void QBoard::reload(){
+    STRATEGO_TRACE_SCOPE("QBoard::reload");
+    perf::RenderTimer timer {model_ -> counters()};
+    STRATEGO_ALLOC_PHASE(RENDER);
+    STRATEGO_ALLOC_SUBSYSTEM(VIEW);
     const model::Board& board {model_ -> board()};
     if(!lastClickedCells_.empty()){
-        for(QCell* cell : lastClickedCells_){
-            model::Cell currentCell {board.getCell(cell -> col(), cell -> row())};
-            cell -> qpiece().setPiece(currentCell.piece);
-            cell -> reload();
-        }
+        for(QCell* cell : lastClickedCells_)
+            reloadCell(cell, board.getCell(cell -> col(), cell -> row()));
 
         lastClickedCells_.clear();
     } else{
-        for(QCell* cell : cells_){
-            model::Cell currentCell {board.getCell(cell -> col(), cell -> row())};
-            cell -> qpiece().setPiece(currentCell.piece);
-            cell -> reload();
-        }
+        for(QCell* cell : cells_)
+            reloadCell(cell, board.getCell(cell -> col(), cell -> row()));
     }
 }
 
 void QBoard::reload(model::Color color, bool setup){
+    STRATEGO_TRACE_SCOPE("QBoard::reload");
+    perf::RenderTimer timer {model_ -> counters()};
+    STRATEGO_ALLOC_PHASE(RENDER);
+    STRATEGO_ALLOC_SUBSYSTEM(VIEW);
     const model::Board& board {model_ -> board()};
+    viewer_ = color;
     if(setup){
         int bound {color == model::Color::BLUE ? Config::ARMY_SIZE : static_cast<int>(cells_.size())};
         for(int i {color == model::Color::BLUE ? 0 : Config::ARMY_SIZE + 12}; i < bound; i++){
             QCell* cell {cells_[i]};
-            model::Cell currentCell {board.getCell(cell -> col(), cell -> row())};
-
-            cell -> qpiece().setPiece(currentCell.piece);
-            cell -> reload();
+            reloadCell(cell, board.getCell(cell -> col(), cell -> row()));
         }
     } else{
-        for(QCell* cell : cells_){
-            if(cell -> qpiece().piece() && cell -> qpiece().piece() -> color() == color){
-                model::Cell currentCell {board.getCell(cell -> col(), cell -> row())};
-
-                cell -> qpiece().setPiece(currentCell.piece);
-                cell -> reload();
-            }
-        }
+        // la visibilité ne dépend que de la perspective: toutes les cellules sont recalculées
+        for(QCell* cell : cells_)
+            reloadCell(cell, board.getCell(cell -> col(), cell -> row()));
     }
 }
 
@@ -159,26 +158,39 @@ void QBoard::clear(model::Color color){
     for(int i {color == model::Color::BLUE ? 0 : Config::ARMY_SIZE + 12}; i < bound; i++){
         QCell* cell {cells_[i]};
 
-        board.getCell(cell -> col(), cell -> row()).piece = nullptr;
+        board.remove({cell -> col(), cell -> row()});
         cell -> decompose();
         cell -> reload();
     }
 }
 
 void QBoard::hideColor(model::Color color){
-    for(QCell* cell : cells_){
-        if(cell -> qpiece().piece() && cell -> qpiece().piece() -> color() == color){
-            cell -> qpiece().piece() -> setRevealed(false);
-            cell -> reload();
-        }
+    if(viewer_ == color)
+        viewer_.reset();
+
+    for(const model::Piece* piece : model_ -> board().pieces(color)){
+        model::Position pos {piece -> position()};
+        QCell* cell {dynamic_cast<QCell*>(container_ -> itemAtPosition(pos.y, pos.x) -> widget())};
+        cell -> setRevealed(isVisible(piece));
+        cell -> reload();
     }
 }
 
+bool QBoard::isVisible(const model::Piece* piece) const noexcept{
+    return piece && model_ -> isVisible(*piece, viewer_);
+}
+
+void QBoard::reloadCell(QCell* cell, const model::Cell& boardCell){
+    cell -> qpiece().setPiece(boardCell.piece);
+    cell -> setRevealed(isVisible(boardCell.piece));
+    cell -> reload();
+}
+
 void QBoard::highlightPossibleMoves(const model::Piece* piece){
     for(int i = model::Direction::UP; i <= model::Direction::RIGHT; i++){
         model::Direction::Value currentDirection {static_cast<model::Direction::Value>(i)};
         model::Position currentPos {piece -> position()};
-        while(piece -> canMove(currentPos + currentDirection)){
+        while(model_ -> canMove(*piece, currentPos + currentDirection)){
             currentPos = currentPos + currentDirection;
             QCell* currentCell {dynamic_cast<QCell*>(container_ -> itemAtPosition(currentPos.y, currentPos.x) -> widget())};
             currentCell -> highlight(true);
@@ -208,15 +220,15 @@ void QBoard::hovered(const QCell* cell){
     model::Cell::Type type {cell -> type()};
 
     // highlighting of possible pieces move
-    if(piece && piece -> revealed()){
+    if(isVisible(piece)){
         highlightPossibleMoves(piece);
     }
 
     // hover info
-    if(piece && piece -> revealed()){
+    if(isVisible(piece)){
         emit cellHovered(("Pièce " + std::string{piece -> name()} + " de rang "
                           + std::to_string(piece -> rank()) + " - " + piece -> description()).c_str());
-    } else if(piece && !piece -> revealed()){
+    } else if(piece){
         std::string color {piece -> color() == model::Color::RED ? "rouge" : "bleu"};
         emit cellHovered(("Pièce caché de couleur " + color).c_str());
     } else{
@@ -226,7 +238,7 @@ void QBoard::hovered(const QCell* cell){
 
 void QBoard::leaved(QCell *cell){
     const model::Piece* piece {cell -> qpiece().piece()};
-    if(piece && piece -> revealed()){
+    if(isVisible(piece)){
         clearHighlights();
     }
     emit cellLeaved();
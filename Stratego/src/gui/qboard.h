@@ -7,6 +7,7 @@
 #include <QDragEnterEvent>
 #include <QDragLeaveEvent>
 #include <model.h>
+#include <optional>
 
 #include "qcomponent.h"
 #include "qcell.h"
@@ -24,6 +25,7 @@ namespace stratego::view{
         std::vector<QCell*> cells_;
         const Model* model_;
         std::vector<QCell*> lastClickedCells_;
+        std::optional<model::Color> viewer_;
 
         public:
 
@@ -42,9 +44,9 @@ namespace stratego::view{
             void connectSlots() override;
 
             /**
-             * Recharge la plateau de jeu pour les pions de couleur donnée.
+             * Recharge la plateau de jeu depuis la perspective du joueur de couleur donnée.
              *
-             * @param color la couleur des pions à recharger
+             * @param color la couleur du joueur observant le plateau
              * @param setup spécifie sur le rechargement à lieu lors de la phase de configuration du
              * plateau de jeu ou non.
              */
@@ -65,7 +67,8 @@ namespace stratego::view{
             void clear(model::Color color);
 
             /**
-             * Cache les pions de couleur donnée du plateau de jeu.
+             * Cache les pions de couleur donnée du plateau de jeu: si le plateau était affiché depuis
+             * la perspective de cette couleur, seuls les pions connus des deux joueurs restent visibles.
              *
              * @param color la couleur des pions à cacher
              */
@@ -95,6 +98,8 @@ namespace stratego::view{
 
         private:
 
+            bool isVisible(const model::Piece* piece) const noexcept;
+            void reloadCell(QCell* cell, const model::Cell& boardCell);
             void highlightPossibleMoves(const model::Piece* piece);
             void clearHighlights();
             std::string adjustAbsolutePath(const std::string& filepath);
@@ -12,7 +12,8 @@ QCell::QCell(model::Cell::Type type, int row, int col, model::Piece* piece, QWid
     type_ {type},
     piece_ {piece},
     row_ {row},
-    col_ {col}
+    col_ {col},
+    revealed_ {true}
 {}
 
 
@@ -50,13 +51,13 @@ void QCell::reload(){
         setIcon(QIcon{pixmap});
         setIconSize(QSize{50, 50});
         setStyleSheet("background-color: transparent");
-    } else if(piece_.piece() && piece_.piece() -> revealed()){
+    } else if(piece_.piece() && revealed_){
         model::Color color {piece_.piece() -> color()};
         setIcon(piece_.icon());
         setIconSize(QSize{30, 30});
         setToolTip((std::string(piece_.piece() -> info().symbol) + " " + std::string{piece_.piece() -> name()}).c_str());
         setStyleSheet((std::string{"QPushButton{background-color: "} + (color == model::Color::RED ? "black" : "white") + "}").c_str());
-    } else if(piece_.piece() && !piece_.piece() -> revealed()){
+    } else if(piece_.piece() && !revealed_){
         model::Color color {piece_.piece() -> color()};
         setIcon(QIcon{});
         setStyleSheet((std::string{"QPushButton{background-color: "} + (color == model::Color::RED ? "black" : "white") + "}").c_str());
@@ -105,6 +106,10 @@ void QCell::setCol(int col){
     col_ = col;
 }
 
+void QCell::setRevealed(bool revealed){
+    revealed_ = revealed;
+}
+
 void QCell::highlight(bool state){
     if(state){
         setStyleSheet("background-color: green");
@@ -26,6 +26,7 @@ namespace stratego::view{
         model::Cell::Type type_;
         QPiece piece_;
         int row_, col_;
+        bool revealed_;
 
         public:
 
@@ -76,6 +77,14 @@ namespace stratego::view{
              */
             void setCol(int col);
 
+            /**
+             * Change la visibilité de l'identité du pion affiché, appliquée lors du prochain
+             * rechargement de la cellule.
+             *
+             * @param revealed true pour afficher l'identité du pion, false pour le cacher
+             */
+            void setRevealed(bool revealed);
+
             /**
              * Récupère la qpiece qui se trouve dans cette cellule. Cette objet
              * représente une icône vide ou pleine en fonction de son état (donc en fonction
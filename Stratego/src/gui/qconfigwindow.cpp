@@ -192,7 +192,7 @@ void QConfigWindow::boardClicked(QCell* cell){
             lastClickedStorageCell_ -> qpiece().setPiece(piece);
             cell -> qpiece().setPiece(prevPiece);
 
-            board.getCell(cellCol, cellRow).piece = prevPiece;
+            board.place({cellCol, cellRow}, prevPiece);
             if(piece) lastClickedStorageCell_ -> qpiece().piece() -> setPosition({0, 0});
             if(prevPiece) prevPiece -> setPosition(model::Position{cell -> col(), cell -> row()});
 
@@ -219,8 +219,8 @@ void QConfigWindow::boardClicked(QCell* cell){
             if(prevPiece) lastClickedBoardCell_ -> qpiece().piece() -> setPosition(model::Position{cellCol, cellRow});
 
             // swap internally
-            board.getCell(prevCol, prevRow).piece = piece;
-            board.getCell(cellCol, cellRow).piece = prevPiece;
+            board.place({prevCol, prevRow}, piece);
+            board.place({cellCol, cellRow}, prevPiece);
 
             // swap on the UI
             cell -> qpiece().setPiece(prevPiece);
@@ -252,7 +252,7 @@ void QConfigWindow::storageClicked(QCell* cell){
             lastClickedBoardCell_ -> qpiece().setPiece(piece);
             cell -> qpiece().setPiece(prevPiece);
 
-            board.getCell(prevCol, prevRow).piece = piece;
+            board.place({prevCol, prevRow}, piece);
             if(piece) lastClickedBoardCell_ -> qpiece().piece() -> setPosition({prevCol, prevRow});
             if(prevPiece) prevPiece -> setPosition({0, 0});
 
@@ -0,0 +1,114 @@
+#include <bot.h>
+#include <trace.h>
+
+#include "qengine.h"
+
+using namespace stratego;
+using namespace stratego::view;
+
+/* ========== QEngineWorker ========== */
+void QEngineWorker::run(const EngineRequest& request){
+    STRATEGO_TRACE_SCOPE("QEngineWorker::run");
+    if(*request.stop)
+        return;
+
+    if(request.kind == EngineRequest::ANALYSIS){
+        model::BeliefTracker beliefs {request.observation.viewer};
+        beliefs.reset(request.observation);
+        emit analysed(request.id, {SearchEngine::evaluate(SearchEngine::position(request.observation)), beliefs.remaining()});
+        return;
+    }
+
+    SearchEngine engine {*request.stop, request.deadline};
+    std::optional<Hint> hint {engine.search(SearchEngine::position(request.observation), request.maxDepth, [&](const Hint& best){
+        emit progressed(request.id, best);
+    }, &request.legal)};
+    emit searched(request.id, hint.value_or(Hint{}), hint.has_value());
+}
+
+
+/* ========== QEngine ========== */
+QEngine::QEngine(QObject* parent) :
+    QObject{parent},
+    thread_ {},
+    worker_ {new QEngineWorker},
+    lastId_ {},
+    current_ {},
+    kind_ {EngineRequest::HINT},
+    stop_ {std::make_shared<std::atomic<bool>>(true)}
+{
+    qRegisterMetaType<stratego::Hint>();
+    qRegisterMetaType<stratego::view::EngineRequest>();
+    qRegisterMetaType<stratego::view::EngineAnalysis>();
+
+    worker_ -> moveToThread(&thread_);
+    QObject::connect(&thread_, &QThread::finished, worker_, &QObject::deleteLater);
+    QObject::connect(this, &QEngine::submitted, worker_, &QEngineWorker::run);
+    QObject::connect(worker_, &QEngineWorker::progressed, this, &QEngine::workerProgressed);
+    QObject::connect(worker_, &QEngineWorker::searched, this, &QEngine::workerSearched);
+    QObject::connect(worker_, &QEngineWorker::analysed, this, &QEngine::workerAnalysed);
+    thread_.start();
+}
+
+quint64 QEngine::request(EngineRequest::Kind kind, const Model& model, int maxDepth){
+    if(model.currentState() != model::StateGraph::PLAYER_TURN)
+        throw std::logic_error("Current model's state doesn't allow the engine to be requested");
+
+    cancel();
+    stop_ = std::make_shared<std::atomic<bool>>(false);
+    current_ = ++lastId_;
+    kind_ = kind;
+
+    SearchEngine::Clock::time_point deadline {SearchEngine::Clock::time_point::max()};
+    model::GameClock::Duration budget {Bot::budget(model)};
+    if(kind == EngineRequest::MOVE && budget != model::GameClock::Duration::max())
+        deadline = SearchEngine::Clock::now() + budget;
+
+    emit submitted({current_, kind, maxDepth, model.observation(model.currentPlayer().color()), Bot::legalMoves(model),
+                    stop_, deadline});
+
+    return current_;
+}
+
+void QEngine::cancel() noexcept{
+    *stop_ = true;
+    current_ = 0;
+}
+
+bool QEngine::busy() const noexcept{
+    return current_ != 0;
+}
+
+QEngine::~QEngine(){
+    cancel();
+    thread_.quit();
+    thread_.wait();
+}
+
+
+/* ======================== SLOTS ======================== */
+void QEngine::workerProgressed(quint64 id, const Hint& hint){
+    if(id == current_)
+        emit progressed(kind_, hint);
+}
+
+void QEngine::workerSearched(quint64 id, const Hint& hint, bool found){
+    if(id != current_)
+        return;
+
+    current_ = 0;
+    if(!found)
+        emit failed();
+    else if(kind_ == EngineRequest::MOVE)
+        emit moveChosen(hint.start, hint.end);
+    else
+        emit hintFound(hint);
+}
+
+void QEngine::workerAnalysed(quint64 id, const EngineAnalysis& analysis){
+    if(id != current_)
+        return;
+
+    current_ = 0;
+    emit analysed(analysis);
+}
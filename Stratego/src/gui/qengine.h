@@ -0,0 +1,269 @@
+#ifndef QENGINE_H
+#define QENGINE_H
+
+#include <QMetaType>
+#include <QObject>
+#include <QThread>
+#include <memory>
+#include <beliefTracker.h>
+#include <bot.h>
+#include <model.h>
+#include <searchEngine.h>
+
+namespace stratego::view{
+
+    /**
+     * Travail adressé au moteur de jeu. La requête transporte une copie de l'observation du joueur
+     * courant (cf. Observation): le thread de travail ne lit jamais le modèle de jeu, qui n'est
+     * modifié et affiché que par le thread de l'interface. Le plateau de jeu ne peut donc jamais être
+     * affiché dans un état intermédiaire pendant une recherche.
+     */
+    struct EngineRequest{
+
+        /**
+         * Nature du travail demandé.
+         */
+        enum Kind{
+
+            /**
+             * Choisir et jouer le coup du joueur courant.
+             */
+            MOVE,
+
+            /**
+             * Suggérer un coup au joueur courant.
+             */
+            HINT,
+
+            /**
+             * Analyser la position du joueur courant.
+             */
+            ANALYSIS
+        };
+
+        /**
+         * Identifiant de la requête (strictement croissant).
+         */
+        quint64 id;
+
+        /**
+         * Nature du travail demandé.
+         */
+        Kind kind;
+
+        /**
+         * Profondeur de recherche maximale (en demi-coups).
+         */
+        int maxDepth;
+
+        /**
+         * Copie de l'observation du joueur courant.
+         */
+        model::Observation observation;
+
+        /**
+         * Coups légaux du joueur courant selon le modèle de jeu (cf. Bot::legalMoves()), seuls
+         * coups pouvant être suggérés ou joués.
+         */
+        std::vector<BotMove> legal;
+
+        /**
+         * Indicateur d'annulation de la requête, partagé avec QEngine.
+         */
+        std::shared_ptr<std::atomic<bool>> stop;
+
+        /**
+         * Échéance de la recherche: temps de réflexion du joueur courant pour un coup joué par le
+         * moteur (cf. Bot::budget()), aucune sinon.
+         */
+        SearchEngine::Clock::time_point deadline;
+    };
+
+    /**
+     * Résultat de l'analyse d'une position.
+     */
+    struct EngineAnalysis{
+
+        /**
+         * Évaluation matérielle de la position du point de vue du joueur courant, les pions
+         * adverses cachés étant remplacés par leurs rangs les plus probables.
+         */
+        int material;
+
+        /**
+         * Nombre de pions adverses encore cachés de chaque rang.
+         */
+        std::array<int, model::BeliefTracker::RANKS> hidden;
+    };
+
+    /**
+     * Exécute les requêtes adressées au moteur de jeu. Un QEngineWorker vit dans le thread de travail
+     * de QEngine: ses slots y sont invoqués par des connexions en file d'attente et ses signaux sont
+     * rapatriés de la même manière dans le thread de l'interface.
+     */
+    class QEngineWorker : public QObject{
+
+        Q_OBJECT
+
+        public slots:
+
+            /**
+             * Exécute la requête donnée, sauf si elle a été annulée entre-temps.
+             *
+             * @param request la requête à exécuter
+             */
+            void run(const stratego::view::EngineRequest& request);
+
+        signals:
+
+            /**
+             * Signale qu'une profondeur de recherche a été terminée.
+             *
+             * @param id l'identifiant de la requête
+             * @param hint la meilleure suggestion à cette profondeur
+             */
+            void progressed(quint64 id, const stratego::Hint& hint);
+
+            /**
+             * Signale la fin d'une recherche.
+             *
+             * @param id l'identifiant de la requête
+             * @param hint la meilleure suggestion
+             * @param found false si aucune profondeur n'a pu être terminée, true si non
+             */
+            void searched(quint64 id, const stratego::Hint& hint, bool found);
+
+            /**
+             * Signale la fin d'une analyse.
+             *
+             * @param id l'identifiant de la requête
+             * @param analysis le résultat de l'analyse
+             */
+            void analysed(quint64 id, const stratego::view::EngineAnalysis& analysis);
+    };
+
+    /**
+     * Moteur de jeu de l'interface: exécute les coups automatiques, les suggestions et les analyses
+     * dans un thread de travail (QThread), de sorte que la boucle d'évènements n'est jamais bloquée.
+     *
+     * Une seule requête est active à la fois: toute nouvelle requête annule la précédente, dont les
+     * résultats tardifs sont ignorés. Les signaux de QEngine sont émis dans le thread de l'interface.
+     */
+    class QEngine : public QObject{
+
+        Q_OBJECT
+
+        QThread thread_;
+        QEngineWorker* worker_;
+        quint64 lastId_;
+        quint64 current_;
+        EngineRequest::Kind kind_;
+        std::shared_ptr<std::atomic<bool>> stop_;
+
+        public:
+
+            /**
+             * Profondeur de recherche des coups automatiques (en demi-coups).
+             */
+            static constexpr int MOVE_DEPTH = 6;
+
+            /**
+             * Profondeur de recherche des suggestions (en demi-coups).
+             */
+            static constexpr int HINT_DEPTH = 8;
+
+            /**
+             * Construit un nouveau moteur et démarre son thread de travail.
+             *
+             * @param parent le parent auquel appartient le moteur
+             */
+            QEngine(QObject* parent = nullptr);
+
+            /**
+             * Soumet une requête portant sur la position du joueur courant du modèle de jeu donné,
+             * se trouvant dans l'état PLAYER_TURN. La requête active est annulée. Un coup joué par le
+             * moteur (MOVE) est de plus limité au temps de réflexion du joueur courant.
+             *
+             * @throw std::logic_error si le modèle de jeu ne se trouve pas dans l'état PLAYER_TURN
+             *
+             * @param kind la nature du travail demandé
+             * @param model le modèle de jeu
+             * @param maxDepth la profondeur de recherche maximale (en demi-coups)
+             * @return l'identifiant de la requête.
+             */
+            quint64 request(EngineRequest::Kind kind, const Model& model, int maxDepth = MOVE_DEPTH);
+
+            /**
+             * Annule la requête active. Ses résultats, même déjà en file d'attente, sont ignorés.
+             */
+            void cancel() noexcept;
+
+            /**
+             * Vérifie si une requête est active.
+             *
+             * @return true si une requête est active, false si non.
+             */
+            bool busy() const noexcept;
+
+            /**
+             * Destructeur de QEngine. Annule la requête active et attend la fin du thread de travail.
+             */
+            ~QEngine();
+
+        private slots:
+
+            void workerProgressed(quint64 id, const stratego::Hint& hint);
+            void workerSearched(quint64 id, const stratego::Hint& hint, bool found);
+            void workerAnalysed(quint64 id, const stratego::view::EngineAnalysis& analysis);
+
+        signals:
+
+            /**
+             * Signale qu'une profondeur de recherche de la requête active a été terminée.
+             *
+             * @param kind la nature de la requête (MOVE ou HINT)
+             * @param hint la meilleure suggestion à cette profondeur
+             */
+            void progressed(stratego::view::EngineRequest::Kind kind, const stratego::Hint& hint);
+
+            /**
+             * Signale que le coup automatique du joueur courant a été choisi.
+             *
+             * @param startPos la position de départ du pion
+             * @param endPos la position de destination du pion
+             */
+            void moveChosen(const model::Position& startPos, const model::Position& endPos);
+
+            /**
+             * Signale que la suggestion de la requête active est définitive.
+             *
+             * @param hint la suggestion
+             */
+            void hintFound(const stratego::Hint& hint);
+
+            /**
+             * Signale que l'analyse de la requête active est terminée.
+             *
+             * @param analysis le résultat de l'analyse
+             */
+            void analysed(const stratego::view::EngineAnalysis& analysis);
+
+            /**
+             * Signale que la requête active n'a produit aucun résultat.
+             */
+            void failed();
+
+            /**
+             * Transmet une requête au thread de travail.
+             *
+             * @param request la requête
+             */
+            void submitted(const stratego::view::EngineRequest& request);
+    };
+}
+
+Q_DECLARE_METATYPE(stratego::Hint)
+Q_DECLARE_METATYPE(stratego::view::EngineRequest)
+Q_DECLARE_METATYPE(stratego::view::EngineAnalysis)
+
+#endif // QENGINE_H
@@ -8,9 +8,15 @@ QGameWindow::QGameWindow(const Model* model, QWidget* parent) :
     model_ {model},
     container_ {new QVBoxLayout},
     title_ {new QLabel},
+    clocks_ {new QLabel},
+    clockTimer_ {new QTimer{this}},
     nextButton_ {new QPushButton{"&Next"}},
+    hintButton_ {new QPushButton{"&Indice"}},
+    autoButton_ {new QPushButton{"&Jouer pour moi"}},
+    analysisButton_ {new QPushButton{"&Analyse"}},
     gamePanel_ {new QGamePanel{model_}},
-    lastClickedBoardCell_ {}
+    lastClickedBoardCell_ {},
+    engine_ {new QEngine{this}}
 {
     addChildren({gamePanel_});
     setLayout(container_);
@@ -27,12 +33,21 @@ void QGameWindow::compose(){
     title_ -> setTextFormat(Qt::RichText);
     title_ -> setText(title.c_str());
     title_ -> setAlignment(Qt::AlignCenter);
+    clocks_ -> setAlignment(Qt::AlignCenter);
+    clocks_ -> setVisible(!model_ -> timeControl().unlimited());
+    updateClocks();
 
     container_ -> addWidget(title_);
+    container_ -> addWidget(clocks_);
     container_ -> addWidget(nextButton_);
+    container_ -> addWidget(hintButton_);
+    container_ -> addWidget(autoButton_);
+    container_ -> addWidget(analysisButton_);
     container_ -> addWidget(gamePanel_);
 
     nextButton_ -> setDisabled(true);
+    if(!model_ -> timeControl().unlimited())
+        clockTimer_ -> start(100);
 
     QComponent::compose();
 }
@@ -43,11 +58,13 @@ void QGameWindow::decompose(){
 
 void QGameWindow::reload(){
     updateTitle();
+    updateClocks();
     QComponent::reload();
 }
 
 void QGameWindow::reload(model::Color color){
     updateTitle();
+    updateClocks();
     gamePanel_ -> stats() -> reload();
     gamePanel_ -> board() -> reload(color, false);
 }
@@ -65,6 +82,16 @@ void QGameWindow::connectSlots(){
 
     QObject::connect(gamePanel_ -> board(), &QBoard::cellClicked, this, &QGameWindow::clicked);
     QObject::connect(nextButton_, &QPushButton::clicked, this, &QGameWindow::next);
+    QObject::connect(hintButton_, &QPushButton::clicked, this, &QGameWindow::hint);
+    QObject::connect(autoButton_, &QPushButton::clicked, this, &QGameWindow::autoPlay);
+    QObject::connect(analysisButton_, &QPushButton::clicked, this, &QGameWindow::analyse);
+    QObject::connect(clockTimer_, &QTimer::timeout, this, &QGameWindow::tick);
+
+    QObject::connect(engine_, &QEngine::progressed, this, &QGameWindow::engineProgressed);
+    QObject::connect(engine_, &QEngine::hintFound, this, &QGameWindow::hintFound);
+    QObject::connect(engine_, &QEngine::moveChosen, this, &QGameWindow::moveChosen);
+    QObject::connect(engine_, &QEngine::analysed, this, &QGameWindow::analysed);
+    QObject::connect(engine_, &QEngine::failed, this, &QGameWindow::engineFailed);
 }
 
 
@@ -72,12 +99,27 @@ void QGameWindow::connectSlots(){
 void QGameWindow::swapDisability(){
    gamePanel_ -> board() -> setDisabled(!(gamePanel_ -> board() -> isEnabled() ^ true));
    nextButton_ -> setDisabled(!(nextButton_ -> isEnabled() ^ true));
+   for(QPushButton* button : {hintButton_, autoButton_, analysisButton_})
+       button -> setDisabled(!gamePanel_ -> board() -> isEnabled());
 }
 
 void QGameWindow::hideCurrentPlayerColor(){
+    cancelEngine();
     gamePanel_ -> board() -> hideColor(model_ -> currentPlayer().color());
 }
 
+void QGameWindow::cancelEngine(){
+    engine_ -> cancel();
+}
+
+void QGameWindow::requestEngine(EngineRequest::Kind kind, int maxDepth){
+    if(model_ -> currentState() != model::StateGraph::PLAYER_TURN)
+        return;
+
+    engine_ -> request(kind, *model_, maxDepth);
+    emit engineUpdated("Réflexion en cours...");
+}
+
 void QGameWindow::updateTitle(){
     model::Player player {model_ -> currentPlayer()};
     std::string title {"<h3>Au tour de <strong><font color='" +
@@ -86,6 +128,19 @@ void QGameWindow::updateTitle(){
     title_ -> setText(title.c_str());
 }
 
+void QGameWindow::updateClocks(){
+    if(model_ -> timeControl().unlimited())
+        return;
+
+    std::string clocks {};
+    for(const model::Player* player : model_ -> players()){
+        clocks += "<font color='" + std::string{player -> color() == model::Color::RED ? "red" : "blue"} + "'>"
+                  + player -> pseudo() + "</font> " + model::GameClock::format(player -> clock().remaining()) + "&nbsp;&nbsp;";
+    }
+
+    clocks_ -> setText(clocks.c_str());
+}
+
 
 
 /* Slots */
@@ -106,6 +161,7 @@ void QGameWindow::clicked(QCell* cell){
         int prevRow {lastClickedBoardCell_ -> row()}, prevCol {lastClickedBoardCell_ -> col()};
         int cellRow {cell -> row()}, cellCol {cell -> col()};
         lastClickedBoardCell_ = nullptr;
+        cancelEngine();
         emit pieceMove(model::Position{prevCol, prevRow}, model::Position{cellCol, cellRow});
     } else if(cell -> qpiece().piece() && cell -> qpiece().piece() -> color() == model_ -> currentPlayer().color()){
         lastClickedBoardCell_ = cell;
@@ -115,3 +171,63 @@ void QGameWindow::clicked(QCell* cell){
 void QGameWindow::next(){
     emit nextClicked();
 }
+
+void QGameWindow::hint(){
+    requestEngine(EngineRequest::HINT, QEngine::HINT_DEPTH);
+}
+
+void QGameWindow::autoPlay(){
+    requestEngine(EngineRequest::MOVE, QEngine::MOVE_DEPTH);
+}
+
+void QGameWindow::analyse(){
+    requestEngine(EngineRequest::ANALYSIS, 0);
+}
+
+void QGameWindow::engineProgressed(EngineRequest::Kind kind, const Hint& hint){
+    std::string prefix {kind == EngineRequest::MOVE ? "Réflexion: " : "Suggestion: "};
+    emit engineUpdated((prefix + std::string{hint.start} + " -> " + std::string{hint.end}
+                        + " (profondeur " + std::to_string(hint.depth) + ")").c_str());
+}
+
+void QGameWindow::hintFound(const Hint& hint){
+    emit engineUpdated(("Suggestion: " + std::string{hint.start} + " -> " + std::string{hint.end}
+                        + " (profondeur " + std::to_string(hint.depth) + ", évaluation "
+                        + std::to_string(hint.score) + ")").c_str());
+}
+
+void QGameWindow::moveChosen(const model::Position& startPos, const model::Position& endPos){
+    // le coup a été calculé sur une copie: il n'est appliqué que si la main n'a pas changé entre-temps
+    if(model_ -> currentState() != model::StateGraph::PLAYER_TURN)
+        return;
+
+    lastClickedBoardCell_ = nullptr;
+    emit engineUpdated(("Coup joué: " + std::string{startPos} + " -> " + std::string{endPos}).c_str());
+    emit pieceMove(startPos, endPos);
+}
+
+void QGameWindow::analysed(const EngineAnalysis& analysis){
+    int hidden {};
+    for(int count : analysis.hidden)
+        hidden += count;
+
+    emit engineUpdated(("Analyse: matériel " + std::to_string(analysis.material) + ", "
+                        + std::to_string(hidden) + " pions adverses cachés").c_str());
+}
+
+void QGameWindow::engineFailed(){
+    emit engineUpdated("Aucun coup n'a pu être trouvé.");
+}
+
+void QGameWindow::tick(){
+    model::StateGraph::State state {model_ -> currentState()};
+    if(state != model::StateGraph::PLAYER_TURN && state != model::StateGraph::GAME_TURN)
+        return;
+
+    updateClocks();
+    if(state == model::StateGraph::PLAYER_TURN && model_ -> currentPlayer().clock().flagged()){
+        cancelEngine();
+        lastClickedBoardCell_ = nullptr;
+        emit timedOut();
+    }
+}
@@ -0,0 +1,64 @@
+#include "qperfpanel.h"
+
+using namespace stratego::view;
+
+QPerfPanel::QPerfPanel(const Model* model, QWidget* parent) :
+    QFrame{parent, Qt::Tool},
+    model_ {model},
+    container_ {new QGridLayout},
+    timer_ {new QTimer{this}},
+    resetButton_ {new QPushButton{"&Reset"}},
+    valueLabels_ {},
+    rateLabels_ {}
+{
+    setLayout(container_);
+}
+
+void QPerfPanel::compose(){
+    setWindowTitle("Stratego - Performances");
+    setStyleSheet("padding: 2 5");
+    for(int i = 0; i < perf::COUNTER_COUNT; i++){
+        valueLabels_[i] = new QLabel{"0"};
+        rateLabels_[i] = new QLabel{};
+        valueLabels_[i] -> setAlignment(Qt::AlignRight);
+        rateLabels_[i] -> setAlignment(Qt::AlignRight);
+        container_ -> addWidget(new QLabel{std::string{perf::counterNames[i]}.c_str()}, i, 0);
+        container_ -> addWidget(valueLabels_[i], i, 1);
+        container_ -> addWidget(rateLabels_[i], i, 2);
+    }
+
+    container_ -> addWidget(resetButton_, perf::COUNTER_COUNT, 0, 1, 3);
+    container_ -> setSpacing(4);
+    timer_ -> start(REFRESH_INTERVAL);
+    QComponent::compose();
+}
+
+void QPerfPanel::decompose(){
+    timer_ -> stop();
+    QComponent::decompose();
+}
+
+void QPerfPanel::reload(){
+    if(!isVisible())
+        return;
+
+    perf::Snapshot snapshot {model_ -> counters().snapshot()};
+    for(int i = 0; i < perf::COUNTER_COUNT; i++){
+        perf::Counter counter {static_cast<perf::Counter>(i)};
+        valueLabels_[i] -> setText(QString::number(snapshot.values[i]));
+        rateLabels_[i] -> setText(counter == perf::RENDER_NANOS ?
+                                      QString{"%1 µs/rendu"}.arg(snapshot.values[perf::RENDERS] ?
+                                          snapshot.values[i] / 1000.0 / snapshot.values[perf::RENDERS] : 0, 0, 'f', 1) :
+                                      QString{"%1/s"}.arg(snapshot.rate(counter), 0, 'f', 1));
+    }
+
+    QComponent::reload();
+}
+
+void QPerfPanel::connectSlots(){
+    QObject::connect(timer_, &QTimer::timeout, this, [this](){ reload(); });
+    QObject::connect(resetButton_, &QPushButton::clicked, this, [this](){
+        model_ -> counters().reset();
+        reload();
+    });
+}
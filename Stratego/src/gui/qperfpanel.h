@@ -0,0 +1,54 @@
+#ifndef QPERFPANEL_H
+#define QPERFPANEL_H
+
+#include <QFrame>
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QTimer>
+#include <model.h>
+
+#include "qcomponent.h"
+
+namespace stratego::view{
+
+    /**
+     * Panneau de débogage affichant en continu les compteurs de performance du modèle
+     * (cf. Model::counters()) ainsi que leur débit.
+     */
+    class QPerfPanel : public QFrame, public QComponent{
+
+        Q_OBJECT
+
+        const Model* model_;
+        QGridLayout* container_;
+        QTimer* timer_;
+        QPushButton* resetButton_;
+        std::array<QLabel*, perf::COUNTER_COUNT> valueLabels_;
+        std::array<QLabel*, perf::COUNTER_COUNT> rateLabels_;
+
+        public:
+
+            /**
+             * Intervalle de rafraîchissement du panneau, en millisecondes.
+             */
+            static constexpr int REFRESH_INTERVAL = 500;
+
+            /**
+             * Construit un nouveau panneau de débogage des compteurs du modèle donné.
+             *
+             * @param model le modèle utilisé
+             * @param parent le parent auquel appartient ce panneau
+             */
+            QPerfPanel(const Model* model, QWidget* parent = nullptr);
+
+
+            // --- Déjà documenté ---
+            void compose() override;
+            void decompose() override;
+            void reload() override;
+            void connectSlots() override;
+    };
+}
+
+#endif // QPERFPANEL_H
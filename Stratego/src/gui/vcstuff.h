@@ -9,6 +9,7 @@
 #include "qappdialog.h"
 #include "qappwindow.h"
 #include "qcomponent.h"
+#include "qperfpanel.h"
 
 namespace stratego{
 
@@ -30,6 +31,7 @@ namespace stratego{
             view::QStartGameDialog* startGameDialog_;
             view::QGameWindow* gameWindow_;
             view::QEndGameDialog* endGameDialog_;
+            view::QPerfPanel* perfPanel_;
             QStatusBar* statusBar_;
 
         public:
@@ -64,6 +66,7 @@ namespace stratego{
 
             void displayError(const QString& error);
             void displaySuccess(const QString& error);
+            void togglePerfPanel();
     };
 
     /**
@@ -136,6 +139,11 @@ namespace stratego{
              */
             void moveAttack(const model::Position& startPos, const model::Position& endPos);
 
+            /**
+             * Constate l'écoulement du temps du joueur courant.
+             */
+            void timeout();
+
             /**
              * Signale le modèle que la partie de jeu courante devrait être testé pour déterminer
              * si cette-dernière est terminée ou non.
@@ -1,7 +1,10 @@
 #include <QApplication>
+#include <allocTracker.h>
 #include <eventMgr.h>
 #include <config.h>
+#include <trace.h>
 #include <QResizeEvent>
+#include <QShortcut>
 
 #include "vcstuff.h"
 
@@ -15,6 +18,7 @@ View::View(Controller& controller, Model* model) :
     startGameDialog_ {new view::QStartGameDialog{this}},
     gameWindow_ {},
     endGameDialog_ {},
+    perfPanel_ {new view::QPerfPanel{model, this}},
     statusBar_ {new QStatusBar}
 
 {
@@ -32,6 +36,10 @@ void View::compose(){
 
     startAppDialog_ -> compose();
     startGameDialog_ -> compose();
+
+    perfPanel_ -> compose();
+    perfPanel_ -> connectSlots();
+    QObject::connect(new QShortcut{QKeySequence{Qt::Key_F12}, this}, &QShortcut::activated, this, &View::togglePerfPanel);
 }
 
 void View::decompose(){
@@ -61,12 +69,16 @@ void View::connectSlotsConfigWindow(){
 void View::connectSlotsGameWindow(){
     QObject::connect(gameWindow_, &view::QGameWindow::cellHovered, statusBar_, &QStatusBar::showMessage);
     QObject::connect(gameWindow_, &view::QGameWindow::cellLeaved, statusBar_, &QStatusBar::clearMessage);
+    QObject::connect(gameWindow_, &view::QGameWindow::engineUpdated, statusBar_, &QStatusBar::showMessage);
 
     QObject::connect(gameWindow_, &view::QGameWindow::pieceMove, &controller_, &Controller::moveAttack);
     QObject::connect(gameWindow_, &view::QGameWindow::nextClicked, &controller_, &Controller::nextTurn);
+    QObject::connect(gameWindow_, &view::QGameWindow::timedOut, &controller_, &Controller::timeout);
 }
 
 void View::update(std::initializer_list<Observable *> args){
+    STRATEGO_TRACE_SCOPE("View::update");
+    STRATEGO_ALLOC_SUBSYSTEM(VIEW);
     model::StateGraph::State state {model_ -> currentState()};
     static bool firstRound {true}, setup {true}, requestReload {true};
 
@@ -174,3 +186,8 @@ void View::displayError(const QString& error){
 void View::displaySuccess(const QString& success){
     QMessageBox::information(this, "Succès", success);
 }
+
+void View::togglePerfPanel(){
+    perfPanel_ -> setVisible(!perfPanel_ -> isVisible());
+    perfPanel_ -> reload();
+}
@@ -0,0 +1,75 @@
+/*========================================
+* Plugin de bot d'exemple (cf. botPlugin.h):
+* joue un coup légal au hasard, en
+* préférant les attaques
+*=========================================
+*/
+
+#include <stdlib.h>
+
+#include <botPlugin.h>
+
+typedef struct RandomBot{
+    uint64_t state;
+} RandomBot;
+
+/*
+ * Générateur xorshift64: la graine nulle est remplacée, le générateur ne sortant jamais de zéro.
+ */
+static uint64_t nextRandom(RandomBot* bot){
+    uint64_t x = bot -> state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return bot -> state = x;
+}
+
+static void* create(uint64_t seed){
+    RandomBot* bot = malloc(sizeof *bot);
+    if(bot)
+        bot -> state = seed ? seed : 0x9E3779B97F4A7C15ULL;
+
+    return bot;
+}
+
+static void destroy(void* bot){
+    free(bot);
+}
+
+static int32_t play(void* data, const StrategoObservation* obs, const StrategoMove* moves, int32_t count, int64_t budget){
+    RandomBot* bot = data;
+    int32_t attacks = 0;
+    (void) budget;
+    for(int32_t i = 0; i < count; i++)
+        attacks += (obs -> flags[moves[i].to] & STRATEGO_ENEMY) != 0;
+
+    // une attaque une fois sur deux lorsqu'il en existe
+    if(attacks > 0 && nextRandom(bot) % 2 == 0){
+        int32_t chosen = (int32_t) (nextRandom(bot) % (uint64_t) attacks);
+        for(int32_t i = 0; i < count; i++){
+            if((obs -> flags[moves[i].to] & STRATEGO_ENEMY) && chosen-- == 0)
+                return i;
+        }
+    }
+
+    return count > 0 ? (int32_t) (nextRandom(bot) % (uint64_t) count) : -1;
+}
+
+static const StrategoBotApi API = {
+    STRATEGO_PLUGIN_ABI,
+    "random-plugin",
+    create,
+    destroy,
+    NULL,
+    play,
+    NULL
+};
+
+#if defined _WIN32
+__declspec(dllexport)
+#else
+__attribute__((visibility("default")))
+#endif
+const StrategoBotApi* strategoBotPlugin(void){
+    return &API;
+}
@@ -0,0 +1,9 @@
+TEMPLATE = lib
+CONFIG += plugin
+CONFIG -= qt
+
+TARGET = randomplugin
+INCLUDEPATH += ../core
+
+SOURCES += \
+        randomPlugin.c
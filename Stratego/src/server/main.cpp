@@ -0,0 +1,63 @@
+#include <csignal>
+#include <iostream>
+#include <string>
+
+#include <unistd.h>
+
+#include <config.h>
+#include <eventLoop.h>
+#include <gameServer.h>
+
+using namespace stratego;
+
+namespace{
+
+    int stopPipe[2] {-1, -1};
+
+    int usage(){
+        std::cerr << "Utilisation:\n"
+                  << "\tserver <socket> [parties maximum]\n";
+
+        return 1;
+    }
+
+    /*
+     * Demande l'arrêt du serveur: seule l'écriture dans un tube est permise dans un gestionnaire de signal.
+     */
+    void requestStop(int){
+        char byte {};
+        [[maybe_unused]] ssize_t written {write(stopPipe[1], &byte, 1)};
+    }
+}
+
+int main(int argc, char** argv){
+    if(argc < 2 || argc > 3)
+        return usage();
+
+    Config::setDynamicResources(argv[0]);
+    try{
+        ServerLimits limits {};
+        if(argc == 3)
+            limits.maxGames = std::stoul(argv[2]);
+
+        EventLoop loop {};
+        GameServer server {loop, argv[1], limits};
+        if(pipe(stopPipe) == -1)
+            throw std::runtime_error("Cannot create the stop pipe");
+
+        loop.watch(stopPipe[0], [&loop](){ loop.quit(); });
+        std::signal(SIGINT, requestStop);
+        std::signal(SIGTERM, requestStop);
+        std::signal(SIGPIPE, SIG_IGN);
+
+        std::cout << "Serveur à l'écoute sur " << argv[1] << std::endl;
+        loop.run();
+        loop.unwatch(stopPipe[0]);
+        std::cout << "Serveur arrêté (" << server.games() << " partie(s) interrompue(s))" << std::endl;
+    } catch(std::exception& e){
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
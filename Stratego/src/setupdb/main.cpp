@@ -0,0 +1,126 @@
+#include <iostream>
+
+#include <arena.h>
+#include <setupGen.h>
+#include <setupStore.h>
+#include <util.h>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    int usage(){
+        std::cerr << "Utilisation:\n"
+                  << "\tsetupdb import <base> <fichier|dossier>...\n"
+                  << "\tsetupdb export <base> <dossier>\n"
+                  << "\tsetupdb generate <base> <nombre> [graine] [--flag-back] [--bombs-around-flag]\n"
+                  << "\tsetupdb info <base>\n";
+
+        return 1;
+    }
+
+    /*
+     * Charge la base de données de chemin donné ou en créé une vide si elle n'existe pas encore.
+     */
+    SetupStore openStore(const std::string& filepath){
+        struct stat info {};
+        return stat(filepath.c_str(), &info) == -1 ? SetupStore{} : SetupStore::load(filepath);
+    }
+
+    int importSetups(const std::string& dbpath, int count, char** paths){
+        SetupStore store {openStore(dbpath)};
+        int added {}, duplicates {}, invalid {};
+        auto importOne {[&](const std::string& filepath){
+            try{
+                // une disposition dont aucun pion ne peut se déplacer ne pourrait être jouée par setupeval
+                util::MappedFile file {filepath};
+                Layout layout {};
+                if(!ConfigFileParser::decode(file.content(), layout) || !Arena::playable(layout))
+                    throw std::invalid_argument("Your file cannot be played");
+
+                store.add(layout) ? added++ : duplicates++;
+            } catch(std::invalid_argument&){
+                std::cerr << "Fichier ignoré (invalide): " << filepath << std::endl;
+                invalid++;
+            }
+        }};
+
+        for(int i = 0; i < count; i++){
+            std::string path {paths[i]};
+            struct stat info {};
+            if(stat(path.c_str(), &info) != -1 && S_ISDIR(info.st_mode)){
+                for(std::string& filename : util::filesOf(path))
+                    importOne(path + SLASH + filename);
+            } else{
+                importOne(path);
+            }
+        }
+
+        store.save(dbpath);
+        std::cout << added << " ajoutée(s), " << duplicates << " doublon(s), " << invalid << " invalide(s). "
+                  << store.size() << " disposition(s) dans " << dbpath << std::endl;
+
+        return 0;
+    }
+
+    int generateSetups(const std::string& dbpath, int argc, char** argv){
+        SetupConstraints constraints {};
+        std::uint64_t seed {std::random_device{}()};
+        size_t count {std::stoul(argv[0])};
+        for(int i = 1; i < argc; i++){
+            std::string arg {argv[i]};
+            if(arg == "--flag-back")
+                constraints.flagInBackRow = true;
+            else if(arg == "--bombs-around-flag")
+                constraints.bombsAroundFlag = true;
+            else
+                seed = std::stoull(arg);
+        }
+
+        SetupStore store {openStore(dbpath)};
+        SetupGenerator generator {seed, constraints};
+        size_t added {};
+        for(size_t i = 0; i < count; i++)
+            added += store.add(generator.next());
+
+        store.save(dbpath);
+        std::cout << added << " nouvelle(s) disposition(s) générée(s) (graine " << seed << "). "
+                  << store.size() << " disposition(s) dans " << dbpath << std::endl;
+
+        return 0;
+    }
+
+    int exportSetups(const std::string& dbpath, const std::string& dirpath){
+        SetupStore store {SetupStore::load(dbpath)};
+        for(size_t i = 0; i < store.size(); i++)
+            store.exportFile(i, dirpath + SLASH + "setup_" + std::to_string(i));
+
+        std::cout << store.size() << " disposition(s) exportée(s) dans " << dirpath << std::endl;
+        return 0;
+    }
+}
+
+int main(int argc, char** argv){
+    if(argc < 3)
+        return usage();
+
+    std::string command {argv[1]};
+    try{
+        if(command == "import" && argc >= 4)
+            return importSetups(argv[2], argc - 3, argv + 3);
+        if(command == "generate" && argc >= 4)
+            return generateSetups(argv[2], argc - 3, argv + 3);
+        if(command == "export" && argc == 4)
+            return exportSetups(argv[2], argv[3]);
+        if(command == "info" && argc == 3){
+            std::cout << SetupStore::load(argv[2]).size() << " disposition(s)" << std::endl;
+            return 0;
+        }
+    } catch(std::exception& e){
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return usage();
+}
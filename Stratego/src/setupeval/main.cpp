@@ -0,0 +1,176 @@
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include <allocTracker.h>
+#include <arena.h>
+#include <setupGen.h>
+#include <setupStore.h>
+#include <util.h>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    /*
+     * Paramètres de l'évaluation.
+     */
+    struct Options{
+        std::string setup {};
+        std::string pool {};
+        std::string bot {"random"};
+        int games {1000};
+        int threads {static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))};
+        int maxTurns {Arena::DEFAULT_MAX_TURNS};
+        std::uint64_t seed {1};
+    };
+
+    int usage(){
+        std::cerr << "Utilisation: setupeval <fichier> [--games N] [--threads N] [--pool base] "
+                  << "[--bot nom] [--seed N] [--max-turns N]\n";
+
+        return 1;
+    }
+
+    /*
+     * Charge la disposition évaluée depuis un chemin ou un nom de fichier du dossier de configuration.
+     */
+    Layout loadSetup(const std::string& filename){
+        struct stat info {};
+        std::string path {stat(filename.c_str(), &info) == -1 ? Config::BOARD_CONFIG_PATH + filename : filename};
+        util::MappedFile file {path};
+        Layout layout {};
+        if(!ConfigFileParser::decode(file.content(), layout))
+            throw std::invalid_argument("Your file cannot be parsed");
+
+        return layout;
+    }
+
+    /*
+     * Écarte de la base de données les dispositions injouables (aucun pion ne peut se déplacer).
+     */
+    SetupStore playableSetups(const SetupStore& store){
+        SetupStore playable {};
+        for(size_t i = 0; i < store.size(); i++){
+            Layout layout {store.at(i)};
+            if(Arena::playable(layout))
+                playable.add(layout);
+        }
+
+        if(playable.size() < store.size())
+            std::cerr << "Dispositions injouables ignorées: " << store.size() - playable.size() << std::endl;
+
+        return playable;
+    }
+}
+
+int main(int argc, char** argv){
+    Config::setDynamicResources(argv[0]);
+    if(argc < 2)
+        return usage();
+
+    Options options {};
+    options.setup = argv[1];
+    try{
+        for(int i = 2; i < argc; i++){
+            std::string arg {argv[i]};
+            if(i + 1 == argc)
+                return usage();
+
+            std::string value {argv[++i]};
+            if(arg == "--games") options.games = std::stoi(value);
+            else if(arg == "--threads") options.threads = std::max(1, std::stoi(value));
+            else if(arg == "--pool") options.pool = value;
+            else if(arg == "--bot") options.bot = value;
+            else if(arg == "--seed") options.seed = std::stoull(value);
+            else if(arg == "--max-turns") options.maxTurns = std::stoi(value);
+            else return usage();
+        }
+
+        Layout setup {loadSetup(options.setup)};
+        if(!Arena::playable(setup))
+            throw std::invalid_argument("The evaluated setup cannot be played: no piece can move");
+
+        SetupStore pool {options.pool.empty() ? SetupStore{} : playableSetups(SetupStore::load(options.pool))};
+        if(!options.pool.empty() && pool.size() == 0)
+            throw std::invalid_argument("The pool contains no playable setup");
+        Bot::create(options.bot, 0); // vérifie le nom du bot avant de lancer les parties
+
+        std::atomic<int> next {0}, wins {0}, draws {0}, losses {0}, forfeits {0};
+        std::mutex failureMutex {};
+        std::string failure {};
+        std::exception_ptr error {};
+        auto worker {[&](){
+            Arena arena {options.maxTurns};
+            int game;
+            while((game = next.fetch_add(1)) < options.games){
+                // chaque partie ne dépend que de la graine et de son indice (et non du nombre de threads)
+                std::uint64_t seed {options.seed * 0x9E3779B97F4A7C15ULL + static_cast<std::uint64_t>(game)};
+                std::mt19937_64 gen {seed};
+                SetupGenerator generator {seed};
+                Layout opponent {pool.size() == 0 ? generator.next() : pool.draw(gen)};
+                bool red {game % 2 == 0};
+                std::unique_ptr<Bot> evaluated {}, other {};
+                try{
+                    evaluated = Bot::create(options.bot, gen());
+                    other = Bot::create(options.bot, gen());
+
+                    GameOutcome outcome {red ? arena.play(setup, opponent, *evaluated, *other)
+                                             : arena.play(opponent, setup, *other, *evaluated)};
+                    if(outcome == GameOutcome::DRAW)
+                        ++draws;
+                    else if((outcome == GameOutcome::RED_WIN) == red)
+                        ++wins;
+                    else
+                        ++losses;
+                } catch(const std::exception& e){
+                    std::lock_guard lock {failureMutex};
+                    if(!dynamic_cast<const BotFailure*>(&e) && other){ // erreur interne, non imputable aux bots
+                        if(!error)
+                            error = std::current_exception();
+                        next = options.games;
+                        continue;
+                    }
+
+                    // une partie interrompue par un bot ne dit rien de la disposition: elle est écartée du score
+                    ++forfeits;
+                    if(failure.empty())
+                        failure = e.what();
+                }
+            }
+        }};
+
+        auto begin {std::chrono::steady_clock::now()};
+        std::vector<std::thread> threads {};
+        for(int i = 0; i < options.threads; i++)
+            threads.emplace_back(worker);
+        for(std::thread& thread : threads)
+            thread.join();
+        if(error)
+            std::rethrow_exception(error);
+        double elapsed {std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count()};
+
+        int played {options.games - forfeits};
+        double score {wins + draws / 2.0};
+        Interval interval {wilsonInterval(score, played)};
+        std::cout << std::fixed << std::setprecision(3)
+                  << "Parties: " << options.games << " (" << options.threads << " thread(s), bot " << options.bot << ")\n"
+                  << "Victoires/Nulles/Défaites: " << wins << "/" << draws << "/" << losses << "\n"
+                  << (forfeits ? "Forfaits (exclus du score): " + std::to_string(forfeits) + " (" + failure + ")\n" : "")
+                  << "Score: " << (played ? score / played : 0)
+                  << " [IC 95%: " << interval.low << " - " << interval.high << "]\n"
+                  << "Durée: " << elapsed << "s (" << std::setprecision(1) << options.games / elapsed << " parties/s)"
+                  << std::endl;
+        STRATEGO_ALLOC_REPORT(std::cout);
+    } catch(std::exception& e){
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
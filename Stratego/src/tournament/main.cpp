@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+#include <tournament.h>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    /*
+     * Paramètres du tournoi.
+     */
+    struct Options{
+        std::vector<std::string> bots {};
+        TournamentSettings settings {};
+        std::string pool {};
+        std::string checkpoint {};
+        int threads {static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))};
+    };
+
+    int usage(){
+        std::cerr << "Utilisation: tournament <bot> <bot> [bot...] [--cycles N | --swiss N] [--threads N] "
+                  << "[--pool base] [--seed N] [--max-turns N] [--margin N] [--cadence minutes[+secondes]] "
+                  << "[--reveal] [--checkpoint fichier]\n";
+
+        return 1;
+    }
+
+    /*
+     * Affiche le classement des bots, du mieux classé au moins bien classé.
+     */
+    void printStandings(const Tournament& tournament){
+        std::vector<Rating> ratings {tournament.ratings()};
+        std::vector<int> order(ratings.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b){
+            return tournament.points(a) != tournament.points(b) ? tournament.points(a) > tournament.points(b)
+                                                                : ratings[a].elo > ratings[b].elo;
+        });
+
+        size_t width {4};
+        for(const std::string& bot : tournament.bots())
+            width = std::max(width, bot.size());
+
+        std::cout << "   " << std::left << std::setw(width) << "Bot" << std::right << std::setw(8) << "Parties"
+                  << std::setw(8) << "Points" << std::setw(8) << "V/N/D" << std::setw(14) << "Elo (IC 95%)\n";
+        for(size_t rank = 0; rank < order.size(); rank++){
+            int bot {order[rank]};
+            Score score {tournament.score(bot)};
+            std::ostringstream record {}, elo {};
+            record << score.wins << '/' << score.draws << '/' << score.losses;
+            elo << std::showpos << std::fixed << std::setprecision(0) << ratings[bot].elo
+                << std::noshowpos << " ± " << ratings[bot].margin;
+
+            std::cout << std::setw(2) << rank + 1 << ' ' << std::left << std::setw(width) << tournament.bots()[bot]
+                      << std::right << std::setw(8) << score.games() << std::setw(8) << std::fixed << std::setprecision(1)
+                      << tournament.points(bot) << std::setw(8) << record.str() << "  " << elo.str() << '\n';
+        }
+
+        std::cout << std::flush;
+    }
+}
+
+int main(int argc, char** argv){
+    Config::setDynamicResources(argv[0]);
+
+    Options options {};
+    try{
+        for(int i = 1; i < argc; i++){
+            std::string arg {argv[i]};
+            if(arg.rfind("--", 0) != 0){
+                options.bots.push_back(arg);
+                continue;
+            }
+            if(arg == "--reveal"){
+                options.settings.reveal = true;
+                continue;
+            }
+            if(i + 1 == argc)
+                return usage();
+
+            std::string value {argv[++i]};
+            if(arg == "--cycles") options.settings.rounds = std::stoi(value);
+            else if(arg == "--swiss"){
+                options.settings.pairing = Pairing::SWISS;
+                options.settings.rounds = std::stoi(value);
+            }
+            else if(arg == "--threads") options.threads = std::max(1, std::stoi(value));
+            else if(arg == "--pool") options.pool = value;
+            else if(arg == "--seed") options.settings.seed = std::stoull(value);
+            else if(arg == "--max-turns") options.settings.maxTurns = std::stoi(value);
+            else if(arg == "--margin") options.settings.materialMargin = std::stoi(value);
+            else if(arg == "--cadence") options.settings.timeControl = TimeControl::parse(value);
+            else if(arg == "--checkpoint") options.checkpoint = value;
+            else return usage();
+        }
+        if(options.bots.size() < 2)
+            return usage();
+
+        for(const std::string& bot : options.bots)
+            Bot::create(bot, 0); // vérifie le nom des bots avant de lancer les parties
+
+        Tournament tournament {options.bots, options.settings,
+                               options.pool.empty() ? SetupStore{} : SetupStore::load(options.pool)};
+        if(!options.checkpoint.empty()){
+            tournament.resume(options.checkpoint);
+            if(!tournament.games().empty()){
+                std::cout << "Reprise après " << tournament.games().size() << " partie(s)\n";
+                printStandings(tournament);
+            }
+        }
+
+        tournament.run(options.threads, [&](const GameRecord& game){
+            const auto& names {tournament.bots()};
+            std::string_view result {game.outcome == GameOutcome::RED_WIN ? "1-0" : game.outcome == GameOutcome::BLUE_WIN ? "0-1" : "½-½"};
+            std::cout << '[' << tournament.games().size() << '/' << tournament.gameCount() << "] ronde "
+                      << game.round + 1 << ": " << names[game.red] << " - " << names[game.blue] << ' ' << result
+                      << (game.forfeit ? " (forfait)" : "") << '\n';
+
+            // le classement est affiché à la fin de chaque ronde
+            const auto& encounters {tournament.rounds()[game.round]};
+            long expected {2 * std::count_if(encounters.begin(), encounters.end(), [](const Encounter& e){ return e.second != Encounter::BYE; })};
+            long played {std::count_if(tournament.games().begin(), tournament.games().end(),
+                                       [&](const GameRecord& g){ return g.round == game.round; })};
+            if(played == expected)
+                printStandings(tournament);
+        });
+    } catch(std::exception& e){
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,11 @@
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../config.pri)
+
+LIBS += -pthread
+
+SOURCES += \
+        main.cpp
@@ -1,39 +1,166 @@
 #include <config.h>
 #include <util.h>
+#include <gamestuff.h>
 
 #include "action.h"
 
 using namespace stratego::view;
 
-const std::array<std::string, 3> Action::infoNames_ {"desc", "syntax", "regex"};
-const std::array<std::string, 9> Action::valueNames {"move", "attack", "help", "rules", "piece", "stop", "stat", "history", "clear"};
-const std::map<std::string, Action::Value> Action::nameActionMap_ {
-    {"move", MOVE},
-    {"attack", ATTACK},
-    {"help", HELP},
-    {"rules", RULES},
-    {"piece", PIECE},
-    {"stop", STOP},
-    {"stat", STAT},
-    {"history", HISTORY},
-    {"clear", CLEAR}
-};
+/* ========================== ActionGrammar =========================== */
+namespace{
+
+    /*
+     * Découpe le prochain mot (séparé par des espaces) de la chaîne donnée à partir de l'index donné.
+     */
+    std::string_view nextWord(std::string_view str, size_t& i) noexcept{
+        while(i < str.size() && str[i] == ' ') i++;
+        size_t begin {i};
+        while(i < str.size() && str[i] != ' ') i++;
+        return str.substr(begin, i - begin);
+    }
+
+    /*
+     * Associe le nom d'un paramètre de syntaxe à son type.
+     */
+    const std::array<std::pair<std::string_view, ActionGrammar::Kind>, 4> paramKinds {{
+        {"pos", ActionGrammar::POSITION},
+        {"count", ActionGrammar::COUNT},
+        {"cmd", ActionGrammar::ACTION},
+        {"id", ActionGrammar::RANK}
+    }};
+}
+
+ActionGrammar::ActionGrammar() noexcept :
+    keyword_ {},
+    params_ {}
+{}
+
+ActionGrammar ActionGrammar::compile(std::string_view syntax){
+    ActionGrammar grammar {};
+    size_t i {};
+    std::string_view word {nextWord(syntax, i)};
+    if(word.empty())
+        throw std::invalid_argument("Empty action syntax");
+
+    grammar.keyword_ = word;
+    while(!(word = nextWord(syntax, i)).empty()){
+        bool optional {word.front() == '['};
+        char closing {optional ? ']' : '>'};
+        if((word.front() != '<' && !optional) || word.back() != closing || word.size() < 3)
+            throw std::invalid_argument("Invalid parameter in action syntax");
+        if(static_cast<int>(grammar.params_.size()) == MAX_PARAMS)
+            throw std::invalid_argument("Too many parameters in action syntax");
+
+        std::string_view name {word.substr(1, word.size() - 2)};
+        Param param {CHOICE, optional, {}};
+        if(name.find('|') != std::string_view::npos){
+            size_t j {};
+            while(j <= name.size()){
+                size_t sep {std::min(name.find('|', j), name.size())};
+                param.choices.emplace_back(name.substr(j, sep - j));
+                j = sep + 1;
+            }
+        } else{
+            auto it {std::find_if(paramKinds.begin(), paramKinds.end(), [&](const auto& entry){
+                return entry.first == name;
+            })};
+            if(it == paramKinds.end())
+                throw std::invalid_argument("Unknown parameter type in action syntax");
+
+            param.kind = it -> second;
+        }
+
+        grammar.params_.push_back(std::move(param));
+    }
+
+    return grammar;
+}
+
+bool ActionGrammar::match(std::string_view str, std::array<ActionToken, MAX_PARAMS>& args) const noexcept{
+    args.fill({{}, -1});
+    size_t i {};
+    if(keyword_.empty() || !util::striequals(nextWord(str, i), keyword_))
+        return false;
+
+    for(size_t p = 0; p < params_.size(); p++){
+        std::string_view word {nextWord(str, i)};
+        if(word.empty())
+            return params_[p].optional;
+        if(!matchParam(params_[p], word, args[p]))
+            return false;
+    }
+
+    return nextWord(str, i).empty();
+}
+
+bool ActionGrammar::matchParam(const Param& param, std::string_view word, ActionToken& token) const noexcept{
+    model::Position pos {};
+    token.text = word;
+    switch(param.kind){
+        case POSITION:
+            return model::Position::tryFrom(word, pos);
+        case COUNT:
+            token.value = word.size() == 1 && word[0] >= '1' && word[0] <= '9' ? word[0] - '0' : -1;
+            return token.value != -1;
+        case ACTION:
+            token.value = Action::indexOf(word);
+            return token.value != -1;
+        case RANK:
+            for(int rank = Config::PIECE_MIN_RANK; rank <= Config::PIECE_MAX_RANK; rank++){
+                if(util::striequals(word, model::Piece::pieceInfo[rank].symbol)){
+                    token.value = rank;
+                    return true;
+                }
+            }
+
+            return false;
+        case CHOICE:
+            for(size_t c = 0; c < param.choices.size(); c++){
+                if(util::striequals(word, param.choices[c])){
+                    token.value = static_cast<int>(c);
+                    return true;
+                }
+            }
+
+            return false;
+    }
+
+    return false;
+}
+
+
+/* ========================== Action =========================== */
+const std::array<std::string, 2> Action::infoNames_ {"desc", "syntax"};
+const std::array<std::string, Action::VALUE_COUNT> Action::valueNames {"move", "attack", "help", "rules", "piece", "stop", "stat", "history", "perf", "clear", "hint"};
 
 Action::Action(Value value) noexcept :
     action_ {value}
 {}
 
-Action::Action(const std::string& str) :
+Action::Action(std::string_view str) :
     action_ {static_cast<Value>(0)}
 {
     setAction(str);
 }
 
-std::string Action::fetchInfo(Value value, Info info) const{
+std::string Action::fetchInfo(Value value, Info info){
     std::string key {valueNames[value] + "." + infoNames_[info]};
     return Config::ACTION_DATA.propertyOf(key);
 }
 
+std::array<ActionGrammar, Action::VALUE_COUNT> Action::compileGrammars(){
+    std::array<ActionGrammar, VALUE_COUNT> grammars {};
+    for(size_t i = 0; i < grammars.size(); i++){
+        try{
+            grammars[i] = ActionGrammar::compile(fetchInfo(static_cast<Value>(i), SYNTAX));
+        } catch(std::invalid_argument&){
+            // syntaxe absente ou erronée: l'action ne sera reconnue par aucune chaîne
+        }
+    }
+
+    return grammars;
+}
+
 std::string Action::description() const noexcept{
     return fetchInfo(action_, DESC);
 }
@@ -42,23 +169,30 @@ std::string Action::syntax() const noexcept{
     return fetchInfo(action_, SYNTAX);
 }
 
-std::regex Action::regex() const noexcept{
-    return std::regex{fetchInfo(action_, REGEX), std::regex_constants::icase};
+const ActionGrammar& Action::grammar() const noexcept{
+    static const std::array<ActionGrammar, VALUE_COUNT> grammars {compileGrammars()};
+    return grammars[action_];
 }
 
 void Action::setAction(Value value) noexcept{
     action_ = value;
 }
 
-void Action::setAction(const std::string &str){
-    std::string tmp {str};
-    util::strtolower(tmp);
-    tmp = tmp.substr(0, str.find(' '));
-
-    if(nameActionMap_.find(tmp) == nameActionMap_.end())
+void Action::setAction(std::string_view str){
+    int index {indexOf(str.substr(0, str.find(' ')))};
+    if(index == -1)
         throw std::invalid_argument("No matching action");
 
-    action_ = nameActionMap_.at(tmp);
+    action_ = static_cast<Value>(index);
+}
+
+int Action::indexOf(std::string_view word) noexcept{
+    for(size_t i = 0; i < valueNames.size(); i++){
+        if(util::striequals(word, valueNames[i]))
+            return static_cast<int>(i);
+    }
+
+    return -1;
 }
 
 
@@ -69,21 +203,21 @@ ActionMatcher::ActionMatcher() noexcept:
 
 ActionMatcher::ActionMatcher(Action::Value action) noexcept:
     action_ {action},
-    matcher_ {}
+    args_ {}
 {}
 
-bool ActionMatcher::match(const std::string& str) noexcept{
-    return std::regex_match(str, matcher_, action_.regex());
+bool ActionMatcher::match(std::string_view str) noexcept{
+    return action_.grammar().match(str, args_);
 }
 
 Action::Value ActionMatcher::action() const noexcept{
     return action_;
 }
 
-void ActionMatcher::setAction(const std::string &str){
+void ActionMatcher::setAction(std::string_view str){
     action_.setAction(str);
 }
 
-std::smatch& ActionMatcher::matcher() noexcept{
-    return matcher_;
+const ActionToken& ActionMatcher::argument(int i) const{
+    return args_.at(i);
 }
@@ -1,12 +1,118 @@
 #ifndef ACTION_H
 #define ACTION_H
 
-#include <regex>
+#include <array>
+#include <string_view>
+#include <vector>
 
 #include "properties.h"
 
 namespace stratego::view{
 
+    /**
+     * Argument extrait d'une commande par le lexer d'actions. Le texte de l'argument
+     * référence directement la chaîne analysée (aucune copie n'est réalisée).
+     */
+    struct ActionToken{
+
+        /**
+         * Texte brut de l'argument ou une vue vide si l'argument optionnel est absent.
+         */
+        std::string_view text;
+
+        /**
+         * Valeur décodée de l'argument (nombre, rang, index d'action ou index de l'alternative
+         * choisie) ou -1 si l'argument est absent ou ne possède pas de valeur numérique.
+         */
+        int value;
+    };
+
+    /**
+     * Grammaire d'une action compilée depuis sa syntaxe (clé <action>.syntax du fichier
+     * action.properties). Une syntaxe se compose d'un mot clé suivi de paramètres obligatoires
+     * (<param>) ou optionnels ([param]). Un paramètre peut être un type connu (pos, count, cmd, id)
+     * ou une liste d'alternatives littérales séparées par '|' (<up|down|left|right>).
+     *
+     * L'analyse d'une chaîne par la grammaire ne réalise aucune allocation.
+     */
+    class ActionGrammar{
+
+        public:
+
+            /**
+             * Nombre maximum de paramètres que peut posséder une action.
+             */
+            static constexpr int MAX_PARAMS = 4;
+
+            /**
+             * Regroupe l'ensemble des types de paramètres reconnus par la grammaire.
+             */
+            enum Kind{
+
+                /**
+                 * Une position du plateau de jeu au format [1-10][a-j].
+                 */
+                POSITION,
+
+                /**
+                 * Un nombre de cases compris entre 1 et 9.
+                 */
+                COUNT,
+
+                /**
+                 * Le nom d'une action.
+                 */
+                ACTION,
+
+                /**
+                 * Le symbole d'un pion (10, 1-9, B ou D).
+                 */
+                RANK,
+
+                /**
+                 * Une alternative parmi une liste de mots littéraux.
+                 */
+                CHOICE
+            };
+
+            /**
+             * Construit une grammaire vide ne reconnaissant aucune chaîne.
+             */
+            ActionGrammar() noexcept;
+
+            /**
+             * Compile la syntaxe donnée en grammaire.
+             *
+             * @throw std::invalid_argument si la syntaxe donnée ne peut être compilée.
+             *
+             * @param syntax la syntaxe de l'action (MOVE <pos> <up|down|left|right> [count] par exemple)
+             * @return la grammaire correspondant à la syntaxe donnée.
+             */
+            static ActionGrammar compile(std::string_view syntax);
+
+            /**
+             * Analyse la chaîne donnée (insensible à la casse) et remplit les arguments reconnus.
+             *
+             * @param str la chaîne à analyser
+             * @param args les arguments à remplir, dans l'ordre de la syntaxe
+             * @return true si la chaîne donnée respecte la grammaire, false si non.
+             */
+            bool match(std::string_view str, std::array<ActionToken, MAX_PARAMS>& args) const noexcept;
+
+        private:
+
+            struct Param{
+                Kind kind;
+                bool optional;
+                std::vector<std::string> choices;
+            };
+
+            std::string keyword_;
+            std::vector<Param> params_;
+
+            bool matchParam(const Param& param, std::string_view word, ActionToken& token) const noexcept;
+    };
+
     /**
      * Action que les joueurs peuvent réaliser.
      */
@@ -63,16 +169,33 @@ namespace stratego::view{
                  */
                 HISTORY,
 
+                /**
+                 * Action de performance pour afficher les compteurs de performance
+                 * de l'application.
+                 */
+                PERF,
+
                 /**
                  * Action de clear pour nettoyer l'écran du terminal.
                  */
-                CLEAR
+                CLEAR,
+
+                /**
+                 * Action de suggestion pour obtenir le meilleur coup trouvé jusqu'ici
+                 * par la recherche en arrière-plan.
+                 */
+                HINT
             };
 
+            /**
+             * Nombre de valeurs d'action (la dernière valeur de l'énumération plus un).
+             */
+            static constexpr std::size_t VALUE_COUNT {HINT + 1};
+
             /**
              * Tableau de noms permettant de récupérer la valeur textuelle d'une action.
              */
-            static const std::array<std::string, 9> valueNames;
+            static const std::array<std::string, VALUE_COUNT> valueNames;
 
             /**
              * Construit une action de valeur donnée.
@@ -89,7 +212,7 @@ namespace stratego::view{
              *
              * @param str la chaîne à convertir en action
              */
-            Action(const std::string& str);
+            Action(std::string_view str);
 
             /**
              * Récupère la description de l'action.
@@ -106,11 +229,12 @@ namespace stratego::view{
             std::string syntax() const noexcept;
 
             /**
-             * Récupère la regex de l'action.
+             * Récupère la grammaire de l'action. Les grammaires de l'ensemble des actions sont
+             * compilées une seule fois depuis Config::ACTION_DATA, lors de leur première utilisation.
              *
-             * @return la regex de l'action.
+             * @return la grammaire de l'action.
              */
-            std::regex regex() const noexcept;
+            const ActionGrammar& grammar() const noexcept;
 
             /**
              * Change la valeur de l'action.
@@ -127,7 +251,15 @@ namespace stratego::view{
              *
              * @param str la chaîne à convertir
              */
-            void setAction(const std::string& str);
+            void setAction(std::string_view str);
+
+            /**
+             * Recherche l'action dont le nom correspond (sans tenir compte de la casse) au mot donné.
+             *
+             * @param word le mot à rechercher
+             * @return l'index de l'action correspondante ou -1 si aucune action ne correspond.
+             */
+            static int indexOf(std::string_view word) noexcept;
 
             /**
              * Surchage d'opérateur de action en sa valeur d'énumeration correspondante.
@@ -143,14 +275,13 @@ namespace stratego::view{
 
             enum Info{
                 DESC,
-                SYNTAX,
-                REGEX
+                SYNTAX
             };
 
-            std::string fetchInfo(Value value, Info info) const;
+            static std::string fetchInfo(Value value, Info info);
+            static std::array<ActionGrammar, VALUE_COUNT> compileGrammars();
 
-            static const std::array<std::string, 3> infoNames_;
-            static const std::map<std::string, Action::Value> nameActionMap_;
+            static const std::array<std::string, 2> infoNames_;
     };
 
     /**
@@ -159,7 +290,7 @@ namespace stratego::view{
     class ActionMatcher{
 
         Action action_;
-        std::smatch matcher_;
+        std::array<ActionToken, ActionGrammar::MAX_PARAMS> args_;
 
         public:
 
@@ -191,22 +322,27 @@ namespace stratego::view{
              *
              * @param str la chaîne à utiliser
              */
-            void setAction(const std::string& str);
+            void setAction(std::string_view str);
 
             /**
-             * Récupère une référence vers le string matcher utilisé (suite à l'appel d'un match(std::string)).
+             * Récupère l'argument d'index donné reconnu lors du dernier appel à match(std::string_view).
+             * Les arguments référencent la chaîne analysée, qui doit donc rester valide tant que
+             * ceux-ci sont utilisés.
+             *
+             * @throw std::out_of_range si l'index donné dépasse le nombre maximum de paramètres
              *
-             * @return le string matcher utilisé.
+             * @param i l'index de l'argument (dans l'ordre de la syntaxe de l'action)
+             * @return l'argument d'index donné.
              */
-            std::smatch& matcher() noexcept;
+            const ActionToken& argument(int i) const;
 
             /**
-             * Détermine si la chaîne donnée match avec la regex définis pour l'action courante du matcher.
+             * Détermine si la chaîne donnée respecte la grammaire définie pour l'action courante du matcher.
              *
              * @param str la chaîne à vérifier
              * @return true si la chaîne donnée match, false si non
              */
-            bool match(const std::string& str) noexcept;
+            bool match(std::string_view str) noexcept;
     };
 }
 
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <regex>
 #include <util.h>
 #include <gamestuff.h>
 
@@ -27,19 +28,38 @@ T Asker<T>::ask(const std::function<void(void)>& tabFunc) const noexcept{
 
 template<class T>
 T Asker<T>::ask(const std::string& msg, const std::function<void(void)>& tabFunc) const noexcept{
-    std::cout << msg << std::endl << "-> ";
-    std::string input {};
-    input = Console::readline(tabFunc);
+    prompt(msg);
+    std::optional<T> value {};
+    while(!(value = answer(Console::readline(tabFunc))));
+
+    return *value;
+}
+
+template<class T>
+void Asker<T>::prompt(const std::string& msg) const noexcept{
+    std::cout << msg << std::endl << "-> " << std::flush;
+}
+
+template<class T>
+void Asker<T>::prompt() const noexcept{
+    prompt(defaultMsg_);
+}
+
+template<class T>
+std::optional<T> Asker<T>::answer(std::string input) const noexcept{
     util::trim(input);
-    while(!predicate_(input)){
-        std::cout << "Mauvaise entrée. Recommencez !" << std::endl << "-> ";
-        input = Console::readline(tabFunc);
-        util::trim(input);
+    if(!predicate_(input)){
+        std::cout << "Mauvaise entrée. Recommencez !" << std::endl << "-> " << std::flush;
+        return std::nullopt;
     }
 
     return convertor_(input);
 }
 
+template class stratego::controller::Asker<bool>;
+template class stratego::controller::Asker<int>;
+template class stratego::controller::Asker<std::string>;
+
 
 /* ========================== BoolAsker =========================== */
 BoolAsker::BoolAsker(const std::string& defaultMsg) noexcept:
@@ -52,17 +72,13 @@ BoolAsker::BoolAsker(const std::string& defaultMsg) noexcept:
         }}
 {}
 
-bool BoolAsker::ask(const std::string& msg, const std::function<void(void)>& tabFunc) const noexcept{
-    std::cout << msg << std::endl << "-> ";
-    std::string input {};
-    input = Console::readline(tabFunc);
+std::optional<bool> BoolAsker::answer(std::string input) const noexcept{
     util::trim(input);
-    while(!predicate_(input)){
+    if(!predicate_(input)){
         std::cout << "Mauvaise entrée. Recommencez !" << std::endl;
         std::cout << "Tapez soit (y,o,yes,oui) pour confirmer ou (n,no,non) pour décliner."
-                  << std::endl << "-> ";
-        input = Console::readline(tabFunc);
-        util::trim(input);
+                  << std::endl << "-> " << std::flush;
+        return std::nullopt;
     }
 
     return convertor_(input);
@@ -92,17 +108,13 @@ PseudoAsker::PseudoAsker(const std::string& defaultMsg) noexcept:
     }
 {}
 
-std::string PseudoAsker::ask(const std::string& msg, const std::function<void(void)>& tabFunc) const noexcept{
-    std::cout << msg << std::endl << "-> ";
-    std::string input {};
-    input = Console::readline(tabFunc);
+std::optional<std::string> PseudoAsker::answer(std::string input) const noexcept{
     util::trim(input);
-    while(!predicate_(input)){
+    if(!predicate_(input)){
         std::cout << "Mauvaise entrée. Recommencez !" << std::endl;
         std::cout << "Le pseudo ne peut contenir que des lettres (majuscules ou miniscules) et doit être "
-                  << "de longueur 3 minimum." << std::endl << "-> ";
-        input = Console::readline(tabFunc);
-        util::trim(input);
+                  << "de longueur 3 minimum." << std::endl << "-> " << std::flush;
+        return std::nullopt;
     }
 
     return convertor_(input);
@@ -120,37 +132,28 @@ FilenameAsker::FilenameAsker(const std::string& defaultMsg) noexcept:
             if(input.empty())
                 return true;
 
-            std::ifstream fstream {std::string{Config::BOARD_CONFIG_PATH} + input};
-            bool state {fstream.good() && ConfigFileParser::canParse(fstream)};
-            fstream.close();
-            return state;
+            return ConfigFileParser::canParseFile(Config::BOARD_CONFIG_PATH + input);
         }
     }
 {}
 
-std::string FilenameAsker::ask(const std::string& msg, const std::function<void(void)>& tabFunc) const noexcept{
-    std::cout << msg << std::endl << "-> ";
-    std::string input {};
-    input = Console::readline(tabFunc);
+std::optional<std::string> FilenameAsker::answer(std::string input) const noexcept{
     util::trim(input);
-    while(!predicate_(input)){
+    if(!predicate_(input)){
         std::cout << "Fichier invalide ou inexistant. Recommencez !" << std::endl;
 #ifdef _WIN32
-        std::ifstream ifs {};
         std::cout << std::endl<< "Fichiers disponibles (sous "
                   << AnsiColor::colorText(Config::BOARD_CONFIG_PATH, AnsiColor::BOLD)
                   << "):" << std::endl;
         for(std::string& filename : util::filesOf(Config::BOARD_CONFIG_PATH)){
-            ifs.open(Config::BOARD_CONFIG_PATH + filename);
-            std::cout << "\t" << filename << " " << (ConfigFileParser::canParse(ifs) ? "*" : "") << std::endl;
-            ifs.close();
+            bool valid {ConfigFileParser::canParseFile(Config::BOARD_CONFIG_PATH + filename)};
+            std::cout << "\t" << filename << " " << (valid ? "*" : "") << std::endl;
         }
         std::cout << "Les fichiers valides sont annotés d'une étoile (*)." << std::endl;
         std::cout << "-> ";
 #endif
-        std::cout << "-> ";
-        input = Console::readline(tabFunc);
-        util::trim(input);
+        std::cout << "-> " << std::flush;
+        return std::nullopt;
     }
 
     return input.empty() ? "default" : input;
@@ -162,27 +165,19 @@ ActionAsker::ActionAsker(const std::string& defaultMsg) noexcept:
     Asker{defaultMsg, {},{}}
 {}
 
-std::string ActionAsker::ask(const std::string& msg, const std::function<void(void)>& tabFunc) const noexcept{
-    bool sflag {}; // success flag
+std::optional<std::string> ActionAsker::answer(std::string input) const noexcept{
     ActionMatcher matcher {};
-    std::cout << msg << std::endl;
-    std::string input {};
-    while(!sflag){
-        try{
-            std::cout << "-> ";
-            input = Console::readline(tabFunc);
-            util::trim(input);
-            matcher.setAction(input);
-            if(!matcher.match(input)){
-                std::cout << "Erreur de syntaxe. Tapez HELP <cmd> pour obtenir de l'aide." << std::endl;
-            } else sflag = true;
-        } catch(std::invalid_argument& exc){
-            std::cout << "Action invalide. Tapez HELP pour voir les actions disponibles." << std::endl;
-        }
+    util::trim(input);
+    try{
+        matcher.setAction(input);
+        if(matcher.match(input))
+            return input;
+
+        std::cout << "Erreur de syntaxe. Tapez HELP <cmd> pour obtenir de l'aide." << std::endl;
+    } catch(std::invalid_argument& exc){
+        std::cout << "Action invalide. Tapez HELP pour voir les actions disponibles." << std::endl;
     }
 
-    return input;
+    std::cout << "-> " << std::flush;
+    return std::nullopt;
 }
-
-
-
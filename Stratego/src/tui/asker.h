@@ -1,6 +1,8 @@
 #ifndef ASKER_H
 #define ASKER_H
 
+#include <optional>
+
 #include "action.h"
 
 namespace stratego::controller{
@@ -52,6 +54,28 @@ namespace stratego::controller{
              */
             virtual T ask(const std::string& msg, const std::function<void(void)>& tabFunc = [](){}) const noexcept;
 
+            /**
+             * Affiche le message donné invitant l'utilisateur à entrer une valeur. Avec answer(), permet
+             * de poser la question sans bloquer: la réponse est transmise dès qu'une ligne a été lue.
+             *
+             * @param msg le message à utiliser
+             */
+            virtual void prompt(const std::string& msg) const noexcept;
+
+            /**
+             * Affiche le message par défaut invitant l'utilisateur à entrer une valeur.
+             */
+            void prompt() const noexcept;
+
+            /**
+             * Valide et convertit la ligne donnée, entrée par l'utilisateur. Si la ligne est invalide,
+             * un message d'erreur est affiché et l'utilisateur est invité à recommencer.
+             *
+             * @param input la ligne entrée par l'utilisateur
+             * @return la conversion en type T de la ligne, std::nullopt si la ligne est invalide.
+             */
+            virtual std::optional<T> answer(std::string input) const noexcept;
+
             /**
              * Destructeur virtuel de Asker.
              */
@@ -74,7 +98,7 @@ namespace stratego::controller{
 
 
             // --- Déjà Documenté ---
-            bool ask(const std::string& msg, const std::function<void(void)>& tabFunc = [](){}) const noexcept override;
+            std::optional<bool> answer(std::string input) const noexcept override;
     };
 
     /**
@@ -108,7 +132,7 @@ namespace stratego::controller{
 
 
             // --- Déjà Documenté ---
-            std::string ask(const std::string& msg, const std::function<void(void)>& tabFunc = [](){}) const noexcept override;
+            std::optional<std::string> answer(std::string input) const noexcept override;
     };
 
     /**
@@ -127,7 +151,7 @@ namespace stratego::controller{
 
 
             // --- Déjà Documenté ---
-            std::string ask(const std::string& msg, const std::function<void(void)>& tabFunc = [](){}) const noexcept override;
+            std::optional<std::string> answer(std::string input) const noexcept override;
 
     };
 
@@ -147,7 +171,7 @@ namespace stratego::controller{
 
 
             // --- Déjà Documenté ---
-            std::string ask(const std::string& msg, const std::function<void(void)>& tabFunc = [](){}) const noexcept override;
+            std::optional<std::string> answer(std::string input) const noexcept override;
     };
 };
 
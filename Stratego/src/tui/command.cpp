@@ -1,3 +1,5 @@
+#include <iomanip>
+#include <perf.h>
 #include <util.h>
 
 #include "ansiColor.h"
@@ -6,6 +8,7 @@
 
 using namespace stratego::view;
 using namespace stratego::model;
+using namespace stratego;
 
 MoveCommand::MoveCommand(Controller& controller, const Position& startPos, const Position& endPos) :
     controller_ {controller},
@@ -49,7 +52,7 @@ void HelpCommand::exec() noexcept{
                   << action_ -> syntax()
                   << std::endl;
     } else{
-        for(int i = 0; i <= Action::CLEAR; i++){
+        for(size_t i = 0; i < Action::VALUE_COUNT; i++){
             Action action {static_cast<Action::Value>(i)};
             std::string actionName {Action::valueNames[i]};
             util::strtoupper(actionName);
@@ -171,6 +174,39 @@ void HistoryCommand::exec() noexcept{
 
 void HistoryCommand::undo() noexcept{}
 
+
+PerfCommand::PerfCommand(perf::Counters& counters, bool reset) :
+    counters_ {counters},
+    reset_ {reset}
+{}
+
+void PerfCommand::exec() noexcept{
+    if(reset_){
+        counters_.reset();
+        std::cout << "\tCompteurs remis à zéro" << std::endl;
+        return;
+    }
+
+    perf::Snapshot snapshot {counters_.snapshot()};
+    for(int i = 0; i < perf::COUNTER_COUNT; i++){
+        perf::Counter counter {static_cast<perf::Counter>(i)};
+        std::cout << "\t" << std::left << std::setw(20) << perf::counterNames[i] << std::right
+                  << AnsiColor::colorText(std::to_string(snapshot.values[i]), AnsiColor::BOLD);
+        if(counter != perf::RENDER_NANOS)
+            std::cout << " (" << std::fixed << std::setprecision(1) << snapshot.rate(counter) << "/s)";
+        std::cout << std::endl;
+    }
+
+    if(snapshot.values[perf::RENDERS])
+        std::cout << std::endl << "\tRendu moyen: "
+                  << std::fixed << std::setprecision(1)
+                  << snapshot.values[perf::RENDER_NANOS] / 1000.0 / snapshot.values[perf::RENDERS] << " µs" << std::endl;
+
+    std::cout << "\tDepuis: " << std::fixed << std::setprecision(1) << snapshot.elapsed << " s" << std::endl;
+}
+
+void PerfCommand::undo() noexcept{}
+
 ClearCommand::ClearCommand(View& view, Color color, const std::string& pseudo) :
     view_ {view},
     color_ {color},
@@ -194,3 +230,32 @@ void ClearCommand::exec() noexcept{
 }
 
 void ClearCommand::undo() noexcept{}
+
+HintCommand::HintCommand(Controller& controller) :
+    controller_ {controller}
+{}
+
+void HintCommand::exec() noexcept{
+    const HintService* hints;
+    try{
+        hints = &controller_.hint();
+    } catch(const std::exception& e){
+        std::cout << "\t" << AnsiColor::colorText("La recherche de suggestion n'a pu être lancée", AnsiColor::BOLD)
+                  << ": " << e.what() << std::endl;
+        return;
+    }
+
+    std::optional<Hint> hint {hints -> best()};
+    if(hint){
+        std::cout << "\t" << AnsiColor::colorText("Suggestion", AnsiColor::BOLD) << ": "
+                  << std::string{hint -> start} << " -> " << std::string{hint -> end}
+                  << " (profondeur " << hint -> depth << ", évaluation " << hint -> score << ")" << std::endl;
+    } else{
+        std::cout << "\tAucune suggestion pour le moment." << std::endl;
+    }
+
+    if(hints -> searching())
+        std::cout << "\tRecherche en cours, tapez HINT à nouveau pour une suggestion plus approfondie." << std::endl;
+}
+
+void HintCommand::undo() noexcept{}
@@ -194,6 +194,31 @@ namespace stratego::view{
             void undo() noexcept;
     };
 
+    /**
+     * Commande de performance.
+     */
+    class PerfCommand : public Command{
+
+        perf::Counters& counters_;
+        bool reset_;
+
+        public:
+
+            /**
+             * Construit une commande de performance affichant les compteurs de performance donnés
+             * ou les remettant à zéro si reset vaut true.
+             *
+             * @param counters les compteurs du modèle
+             * @param reset flag pour remettre à zéro les compteurs
+             */
+            PerfCommand(perf::Counters& counters, bool reset = false);
+
+
+            // --- Déjà Documenté ---
+            void exec() noexcept;
+            void undo() noexcept;
+    };
+
     /**
      * Commande de nettoyage.
      */
@@ -215,6 +240,29 @@ namespace stratego::view{
             ClearCommand(View& view, model::Color color, const std::string& pseudo);
 
 
+            // --- Déjà Documenté ---
+            void exec() noexcept;
+            void undo() noexcept;
+    };
+
+    /**
+     * Commande de suggestion.
+     */
+    class HintCommand : public Command{
+
+        Controller& controller_;
+
+        public:
+
+            /**
+             * Construit une commande de suggestion lançant la recherche en arrière-plan si
+             * nécessaire et affichant la meilleure suggestion trouvée jusqu'ici.
+             *
+             * @param controller le contrôleur détenant le service de suggestion
+             */
+            HintCommand(Controller& controller);
+
+
             // --- Déjà Documenté ---
             void exec() noexcept;
             void undo() noexcept;
@@ -4,7 +4,6 @@
 #endif
 
 #include <util.h>
-#include <regex>
 #include <iostream>
 
 #include "console.h"
@@ -47,109 +46,11 @@ bool Console::isArrowKey(int ch) noexcept{
 
 std::string Console::readline(const std::function<void(void)>& specialTabFunc) noexcept{
 #if defined __unix__ || defined __APPLE__
-    std::string input {};
-    std::vector<int> linebuff {};
-    int tmp_hist_p = hist_p_;
-    int input_p {-1};
-    int input_l {(int) input.length()};
-    unsigned char tabf {0x00};
-
-    int ch;
-    while((ch = getch()) != '\n'){
-        linebuff.push_back(ch);
-        if(std::regex_match(std::string{static_cast<char>(ch)}, std::regex{"[[:alnum:] ]{1}"})){
-
-            // arrow keys are considered valid
-            if(isArrowKey(ch) && linebuff.size() > 2 && !(linebuff[linebuff.size() - 2] ^ KeyCode::VK_LSQUARE_BRACKET) && !(linebuff[linebuff.size() - 3] ^ KeyCode::VK_ESC)){ // valid key
-                switch(ch){
-                    case KeyCode::VK_ARROW_UP:
-                        if(hist_p_ > 0){
-                            replace(input, history_[--hist_p_], input_p);
-                            input_p = input.length() - 1;
-                            input_l = (int) input.length();
-                        }
-
-                        break;
-                    case KeyCode::VK_ARROW_DOWN:
-                        if(hist_p_ < tmp_hist_p){
-                            replace(input, history_[++hist_p_], input_p);
-                            input_p = input.length() - 1;
-                            input_l = (int) input.length();
-                        }
-
-                        break;
-                    case KeyCode::VK_ARROW_LEFT:
-                        if(input_p > -1){
-                            std::cout << '\b';
-                            input_p--;
-                        }
-
-                        break;
-                    case KeyCode::VK_ARROW_RIGHT:
-                        if(input_p < input_l - 1){
-                            std::cout << input[++input_p];
-                        }
-
-                        break;
-                }
-            }else{
-                input_p++;
-                input.insert(input_p, std::string{static_cast<char>(ch)});
-
-                if(input_p < input_l){
-                    for(int i = 0; i <= input_l - input_p; i++){
-                        std::cout << input[input_p + i];
-                    }
-                    std::cout << util::strrepeat("\b", input_l - input_p);
-                } else{
-                    std::cout << input[input_p];
-                }
-
-                input_l = (int) input.length();
-            }
-        } else if(!(ch ^ KeyCode::VK_DEL) && ~input_p){
-            input.erase(input_p, 1);
-            std::cout << '\b'; // go back
-            input_p--;
-            input_l--;
-            for(int i = 0; i < input_l - input_p - 1; i++){
-                std::cout << input[input_p + i + 1];
-            }
-            std::cout << " "; // erase
-            std::cout << util::strrepeat("\b", input_l - input_p); // replace the pointer
-        } else if(ch == KeyCode::VK_HTAB){
-            tabf |= 0x01;
-            if(!(tabf ^ 0x03)){
-                specialTabFunc();
-                int i {};
-                while(i < input_l){
-                    std::cout << input[i];
-                    i++;
-                }
-                std::cout << util::strrepeat("\b", input_l - input_p - 1);
-                tabf ^= 0x03;
-            }
-            tabf <<= 1;
-        } else if(ch == KeyCode::VK_DOLLAR){
-            while(input_p < input_l - 1){
-                std::cout << input[++input_p];
-            }
-        } else if(ch == KeyCode::VK_CIRCUMFLEX){
-            while(input_p > -1){
-                std::cout << '\b';
-                input_p--;
-            }
-        }
-
-    }
+    LineEditor editor {specialTabFunc};
+    std::optional<std::string> line {};
+    while(!(line = editor.feed(getch())));
 
-    std::cout << std::endl;
-    hist_p_ = tmp_hist_p;
-    if(!util::isblankstr(input)){
-        history_[hist_p_] = input;
-        hist_p_ = (hist_p_ + 1) % history_.size();
-    }
-    return input;
+    return *line;
 #else
     std::string input {};
     std::getline(std::cin, input);
@@ -180,3 +81,141 @@ void Console::replace(std::string& input, const std::string& replacement, int in
 }
 
 
+/* ========================== LineEditor =========================== */
+LineEditor::LineEditor(const std::function<void(void)>& specialTabFunc) noexcept :
+    specialTabFunc_ {specialTabFunc},
+    input_ {},
+    linebuff_ {},
+    histStart_ {Console::hist_p_},
+    input_p_ {-1},
+    input_l_ {},
+    tabf_ {0x00}
+{}
+
+std::optional<std::string> LineEditor::feed(int ch) noexcept{
+    if(ch == '\n'){
+        std::cout << std::endl;
+        Console::hist_p_ = histStart_;
+        if(!util::isblankstr(input_)){
+            Console::history_[Console::hist_p_] = input_;
+            Console::hist_p_ = (Console::hist_p_ + 1) % Console::history_.size();
+        }
+
+        std::string line {std::move(input_)};
+        *this = LineEditor{specialTabFunc_};
+        return line;
+    }
+
+    linebuff_.push_back(ch);
+    if(std::isalnum(ch) || ch == ' '){
+
+        // arrow keys are considered valid
+        if(Console::isArrowKey(ch) && linebuff_.size() > 2 && !(linebuff_[linebuff_.size() - 2] ^ KeyCode::VK_LSQUARE_BRACKET) && !(linebuff_[linebuff_.size() - 3] ^ KeyCode::VK_ESC)){ // valid key
+            switch(ch){
+                case KeyCode::VK_ARROW_UP:
+                    if(Console::hist_p_ > 0){
+                        Console::replace(input_, Console::history_[--Console::hist_p_], input_p_);
+                        input_p_ = input_.length() - 1;
+                        input_l_ = (int) input_.length();
+                    }
+
+                    break;
+                case KeyCode::VK_ARROW_DOWN:
+                    if(Console::hist_p_ < histStart_){
+                        Console::replace(input_, Console::history_[++Console::hist_p_], input_p_);
+                        input_p_ = input_.length() - 1;
+                        input_l_ = (int) input_.length();
+                    }
+
+                    break;
+                case KeyCode::VK_ARROW_LEFT:
+                    if(input_p_ > -1){
+                        std::cout << '\b';
+                        input_p_--;
+                    }
+
+                    break;
+                case KeyCode::VK_ARROW_RIGHT:
+                    if(input_p_ < input_l_ - 1){
+                        std::cout << input_[++input_p_];
+                    }
+
+                    break;
+            }
+        }else{
+            input_p_++;
+            input_.insert(input_p_, std::string{static_cast<char>(ch)});
+
+            if(input_p_ < input_l_){
+                for(int i = 0; i <= input_l_ - input_p_; i++){
+                    std::cout << input_[input_p_ + i];
+                }
+                std::cout << util::strrepeat("\b", input_l_ - input_p_);
+            } else{
+                std::cout << input_[input_p_];
+            }
+
+            input_l_ = (int) input_.length();
+        }
+    } else if(!(ch ^ KeyCode::VK_DEL) && ~input_p_){
+        input_.erase(input_p_, 1);
+        std::cout << '\b'; // go back
+        input_p_--;
+        input_l_--;
+        for(int i = 0; i < input_l_ - input_p_ - 1; i++){
+            std::cout << input_[input_p_ + i + 1];
+        }
+        std::cout << " "; // erase
+        std::cout << util::strrepeat("\b", input_l_ - input_p_); // replace the pointer
+    } else if(ch == KeyCode::VK_HTAB){
+        tabf_ |= 0x01;
+        if(!(tabf_ ^ 0x03)){
+            specialTabFunc_();
+            int i {};
+            while(i < input_l_){
+                std::cout << input_[i];
+                i++;
+            }
+            std::cout << util::strrepeat("\b", input_l_ - input_p_ - 1);
+            tabf_ ^= 0x03;
+        }
+        tabf_ <<= 1;
+    } else if(ch == KeyCode::VK_DOLLAR){
+        while(input_p_ < input_l_ - 1){
+            std::cout << input_[++input_p_];
+        }
+    } else if(ch == KeyCode::VK_CIRCUMFLEX){
+        while(input_p_ > -1){
+            std::cout << '\b';
+            input_p_--;
+        }
+    }
+
+    std::cout << std::flush;
+    return std::nullopt;
+}
+
+const std::string& LineEditor::input() const noexcept{
+    return input_;
+}
+
+
+/* ========================== RawTerminal =========================== */
+RawTerminal::RawTerminal() noexcept :
+    active_ {}
+{
+#if defined __unix__ || defined __APPLE__
+    if(isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &saved_) == 0){
+        termios raw {saved_};
+        raw.c_lflag &= ~(ICANON | ECHO); // ICANON unset for non-canonical mode
+        active_ = tcsetattr(STDIN_FILENO, TCSANOW, &raw) == 0;
+    }
+#endif
+}
+
+RawTerminal::~RawTerminal(){
+#if defined __unix__ || defined __APPLE__
+    if(active_)
+        tcsetattr(STDIN_FILENO, TCSANOW, &saved_);
+#endif
+}
@@ -1,8 +1,14 @@
 #ifndef CONSOLE_H
 #define CONSOLE_H
 
+#if defined __unix__ || defined __APPLE__
+    #include <termios.h>
+#endif
+
 #include <string>
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace stratego::view{
 
@@ -18,6 +24,8 @@ namespace stratego::view{
      */
     class Console{
 
+        friend class LineEditor;
+
         static std::array<std::string, 5092> history_;
         static int hist_p_;
 
@@ -57,6 +65,77 @@ namespace stratego::view{
             static bool isArrowKey(int ch) noexcept;
     };
 
+    /**
+     * Éditeur de ligne incrémental: reçoit les caractères un à un, au fur et à mesure de leur
+     * arrivée, et produit la ligne saisie à la rencontre du caractère '\n'. Offre les mêmes raccourcis
+     * que Console::readline() (historique, flèches, double tabulation, '$' et '^') sans jamais lire
+     * le clavier lui-même: il peut donc être alimenté par une boucle d'évènements.
+     */
+    class LineEditor{
+
+        std::function<void(void)> specialTabFunc_;
+        std::string input_;
+        std::vector<int> linebuff_;
+        int histStart_;
+        int input_p_;
+        int input_l_;
+        unsigned char tabf_;
+
+        public:
+
+            /**
+             * Construit un éditeur de ligne vide.
+             *
+             * @param specialTabFunc fonction spécial exécuté lorsque l'utilisateur
+             * clique 2 fois sur tab.
+             */
+            explicit LineEditor(const std::function<void(void)>& specialTabFunc = [](){}) noexcept;
+
+            /**
+             * Traite le caractère donné.
+             *
+             * @param ch le code du caractère lu
+             * @return la ligne saisie si le caractère termine la ligne, std::nullopt si non.
+             */
+            std::optional<std::string> feed(int ch) noexcept;
+
+            /**
+             * Récupère la ligne en cours de saisie.
+             *
+             * @return la ligne en cours de saisie.
+             */
+            const std::string& input() const noexcept;
+    };
+
+    /**
+     * Passe le terminal en mode non canonique et sans écho le temps de sa durée de vie, de sorte que
+     * chaque touche soit lisible dès sa frappe. Ne fait rien si l'entrée standard n'est pas un
+     * terminal.
+     */
+    class RawTerminal{
+
+        bool active_;
+#if defined __unix__ || defined __APPLE__
+        termios saved_;
+#endif
+
+        public:
+
+            /**
+             * Passe le terminal en mode non canonique.
+             */
+            RawTerminal() noexcept;
+
+            RawTerminal(const RawTerminal&) = delete;
+
+            RawTerminal& operator=(const RawTerminal&) = delete;
+
+            /**
+             * Restaure le mode initial du terminal.
+             */
+            ~RawTerminal();
+    };
+
     /**
      * Regroupe le code ascii pour les touches du clavier.
      */
@@ -1,4 +1,9 @@
+#if defined __unix__ || defined __APPLE__
+    #include <unistd.h>
+#endif
+
 #include <util.h>
+#include <trace.h>
 
 #include "vcstuff.h"
 #include "ansiColor.h"
@@ -10,97 +15,173 @@ using namespace stratego::model;
 using namespace stratego::controller;
 using namespace stratego;
 
-Controller::Controller(Model* model) noexcept:
+Controller::Controller(Model* model):
     model_ {model},
-    view_ {model,*this}
-
+    view_ {model,*this},
+#if defined __unix__ || defined __APPLE__
+    loop_ {},
+    editor_ {},
+    onLine_ {},
+    onKey_ {},
+    flagTimer_ {},
+#endif
+    hints_ {},
+    bots_ {},
+    layouts_ {static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count())}
 {
     model_->addObserver(&view_);
 }
 
+void Controller::setBot(Color color, std::unique_ptr<Bot> bot) noexcept{
+    bots_[color == Color::RED ? 0 : 1] = std::move(bot);
+}
+
 void Controller::start() noexcept{
+#if defined __unix__ || defined __APPLE__
+    RawTerminal terminal {};
+    loop_.watch(STDIN_FILENO,[this](){ readInput(); });
+    view_.update({model_});
+    loop_.run();
+    loop_.unwatch(STDIN_FILENO);
+#else
     while(model_->currentState()!=StateGraph::EOG){
         view_.update({model_});
     }
+#endif
 }
 
 void Controller::init() noexcept{
-#if defined __unix__ || defined __APPLE__
-    Console::getch();
-    std::cout << std::endl;
-#else
-    std::cin.ignore();
-#endif
-    model_->init();
+    waitKey([this](){
+        std::cout << std::endl;
+        model_->init();
+    });
 }
 
 void Controller::load() noexcept{
-    PseudoAsker pseudoAskerRed("["+AnsiColor::colorText("Joueur rouge",AnsiColor::RED)
-                               +"] Pseudo pour joueur rouge:");
-    PseudoAsker pseudoAskerBlue("["+AnsiColor::colorText("Joueur bleu",AnsiColor::BLUE)
-                                +"] Pseudo pour joueur bleu:");
-    Asker<std::string>& askerRed{pseudoAskerRed};
-    Asker<std::string>& askerBlue{pseudoAskerBlue};
-    std::string pseudoRed{askerRed.ask()};
-    std::string pseudoBlue{askerBlue.ask()};
+    auto askerRed {std::make_shared<const PseudoAsker>("["+AnsiColor::colorText("Joueur rouge",AnsiColor::RED)
+                                                       +"] Pseudo pour joueur rouge:")};
+    auto askerBlue {std::make_shared<const PseudoAsker>("["+AnsiColor::colorText("Joueur bleu",AnsiColor::BLUE)
+                                                        +"] Pseudo pour joueur bleu:")};
 
-    model_->setup(pseudoRed,pseudoBlue);
+    // le pseudo d'un joueur confié à un bot est le nom du bot
+    auto askPseudo {[this](std::shared_ptr<const PseudoAsker> asker, Color color, std::function<void(std::string)> onPseudo){
+        if(Bot* bot {botOf(color)})
+            onPseudo(bot->name());
+        else
+            ask<std::string>(asker, onPseudo);
+    }};
+
+    askPseudo(askerRed, Color::RED, [this, askerBlue, askPseudo](std::string pseudoRed){
+        askPseudo(askerBlue, Color::BLUE, [this, pseudoRed](std::string pseudoBlue){
+            model_->setup(pseudoRed,pseudoBlue);
+        });
+    });
 }
 
 void Controller::load(Color color) noexcept{
+    if(Bot* bot {botOf(color)}){
+        Layout layout {layouts_.next()};
+        bot->start(layout, color);
+        model_->load(layout, color);
+        return;
+    }
+
     std::function<void(void)> tabFunc {[](){
-        std::ifstream ifs {};
         std::cout << std::endl<< "Fichiers disponibles (sous "
                   << AnsiColor::colorText(Config::BOARD_CONFIG_PATH, AnsiColor::BOLD)
                   << "):" << std::endl;
         for(std::string& filename : util::filesOf(Config::BOARD_CONFIG_PATH)){
-            ifs.open(Config::BOARD_CONFIG_PATH + filename);
-            std::cout << "\t" << filename << " " << (ConfigFileParser::canParse(ifs) ? "*" : "") << std::endl;
-            ifs.close();
+            bool valid {ConfigFileParser::canParseFile(Config::BOARD_CONFIG_PATH + filename)};
+            std::cout << "\t" << filename << " " << (valid ? "*" : "") << std::endl;
         }
         std::cout << "Les fichiers valides sont annotés d'une étoile (*)." << std::endl;
         std::cout << "-> ";
     }};
     std::string player_color {color == Color::RED ? "rouge" : "bleu"};
     AnsiColor prompt_color {color == Color::RED ? AnsiColor::RED : AnsiColor::BLUE};
-    FilenameAsker filenameAsker {"["+prompt_color.colorize("Joueur " + player_color)
-                +"] Entrez un nom de fichier de configuration de plateau de jeu (tapez <enter> pour choisir celui par défaut):"};
-    Asker<std::string>& asker{filenameAsker};
-    model_->load(asker.ask(tabFunc), color);
+    auto asker {std::make_shared<const FilenameAsker>("["+prompt_color.colorize("Joueur " + player_color)
+                +"] Entrez un nom de fichier de configuration de plateau de jeu (tapez <enter> pour choisir celui par défaut):")};
+    ask<std::string>(asker,[this, color](std::string filename){
+        model_->load(filename, color);
+    }, tabFunc);
 }
 
 void Controller::processAction() noexcept{
-    ActionAsker actionAsker {"Entrez une commande:"};
-    Asker<std::string>& ask{actionAsker};
-    std::function<void(void)> tabFunc {[&](){
+    STRATEGO_TRACE_SCOPE("Controller::processAction");
+    if(botOf(model_->currentPlayer().color())){
+#if defined __unix__ || defined __APPLE__
+        loop_.post([this](){ playBot(); }); // la vue termine son rafraîchissement avant le coup du bot
+#else
+        playBot();
+#endif
+        return;
+    }
+
+    std::function<void(void)> tabFunc {[this](){
         std::cout << std::endl;
         view_.processAction("help");
         std::cout << "-> ";
     }};
 
-    view_.processAction(ask.ask(tabFunc));
+    ask<std::string>(std::make_shared<const ActionAsker>("Entrez une commande:"),[this](std::string action){
+        view_.processAction(action);
+    }, tabFunc);
+
+#if defined __unix__ || defined __APPLE__
+    // sans action avant la chute de la pendule, la défaite est constatée par la boucle
+    loop_.cancel(flagTimer_);
+    GameClock::Duration remaining {model_->currentPlayer().clock().remaining()};
+    if(remaining != GameClock::Duration::max())
+        flagTimer_ = loop_.schedule(std::max(remaining, GameClock::Duration::zero()) + std::chrono::milliseconds{1},
+                                    [this](){ flagFell(); });
+#endif
 }
 
 void Controller::move(const model::Position& startPos, const model::Position& endPos) noexcept{
+    hints_.cancel();
     model_->move(startPos,endPos);
 }
 
 void Controller::attack(const model::Position& startPos, const model::Position& endPos) noexcept{
+    hints_.cancel();
     model_->attack(startPos,endPos);
 }
 
+const HintService& Controller::hint(){
+    if(model_->currentState()==StateGraph::PLAYER_TURN){
+#if defined __unix__ || defined __APPLE__
+        hints_.start(*model_,[this](){ loop_.post([this](){ hintFinished(); }); });
+#else
+        hints_.start(*model_);
+#endif
+    }
+
+    return hints_;
+}
+
 void Controller::nextPlayer() noexcept{
+    // le plateau n'a pas à être caché lorsqu'un bot participe à la partie
+    if(bots_[0] || bots_[1]){
 #if defined __unix__ || defined __APPLE__
-    Console::getch();
-    std::cout << std::endl;
+        loop_.post([this](){
+            if(model_->currentState()==StateGraph::PLAYER_SWAP) // la vue a pu être rafraîchie entre-temps
+                model_->nextPlayer();
+        });
 #else
-    std::cin.ignore();
+        model_->nextPlayer();
 #endif
-    Console ::clear();
-    model_->nextPlayer();
+        return;
+    }
+
+    waitKey([this](){
+        std::cout << std::endl;
+        Console ::clear();
+        model_->nextPlayer();
+    });
 }
 
 void Controller::stop() noexcept{
+    hints_.cancel();
     model_->stop();
 }
 
@@ -113,7 +194,144 @@ void Controller::nextTurn() noexcept{
 }
 
 void Controller::replay() noexcept{
-    BoolAsker boolAsker{"Voulez-vous rejouer y(oui) et n(non): "};
-    Asker<bool>& boolState{boolAsker};
-    model_->replay(boolState.ask());
+    GameOutcome outcome {GameOutcome::DRAW};
+    if(model_->hasWon(Color::RED) != model_->hasWon(Color::BLUE))
+        outcome = model_->hasWon(Color::RED) ? GameOutcome::RED_WIN : GameOutcome::BLUE_WIN;
+    for(auto& bot : bots_){
+        if(bot)
+            bot->finish(outcome);
+    }
+
+    ask<bool>(std::make_shared<const BoolAsker>("Voulez-vous rejouer y(oui) et n(non): "),[this](bool state){
+        model_->replay(state);
+    });
 }
+
+#if defined __unix__ || defined __APPLE__
+EventLoop& Controller::loop() noexcept{
+    return loop_;
+}
+#endif
+
+
+/* ======================== Entrées ======================== */
+template<class T>
+void Controller::ask(std::shared_ptr<const Asker<T>> asker, std::function<void(T)> onAnswer,
+                     const std::function<void(void)>& tabFunc){
+#if defined __unix__ || defined __APPLE__
+    asker->prompt();
+    editor_ = LineEditor{tabFunc};
+    onLine_ = [asker, onAnswer](const std::string& line){
+        std::optional<T> value {asker->answer(line)};
+        if(value)
+            onAnswer(*value);
+
+        return value.has_value();
+    };
+#else
+    onAnswer(asker->ask(tabFunc));
+#endif
+}
+
+void Controller::waitKey(std::function<void()> onKey){
+#if defined __unix__ || defined __APPLE__
+    onKey_ = std::move(onKey);
+#else
+    std::cin.ignore();
+    onKey();
+#endif
+}
+
+Bot* Controller::botOf(Color color) const noexcept{
+    return bots_[color == Color::RED ? 0 : 1].get();
+}
+
+void Controller::playBot(){
+    if(model_->currentState()!=StateGraph::PLAYER_TURN)
+        return;
+
+    Color color {model_->currentPlayer().color()};
+    Bot* bot {botOf(color)};
+    if(!bot)
+        return;
+
+    try{
+        BotMove move {bot->play(*model_)};
+        std::vector<BotMove> moves {Bot::legalMoves(*model_)};
+        if(std::none_of(moves.begin(), moves.end(), [&move](const BotMove& legal){
+            return legal.start == move.start && legal.end == move.end;
+        }))
+            throw std::logic_error("The bot played an invalid move");
+
+        std::cout << "[" << AnsiColor::colorText("BOT", AnsiColor::YELLOW) << "] " << bot->name() << ": "
+                  << std::string{move.start} << " -> " << std::string{move.end} << std::endl;
+        hints_.cancel();
+        model_->moveAttack(move.start, move.end);
+    } catch(const std::exception& e){
+        std::cout << "[" << AnsiColor::colorText("FAILURE", AnsiColor::RED) << "] " << bot->name() << ": "
+                  << e.what() << ". Le joueur reprend la main." << std::endl;
+        bots_[color == Color::RED ? 0 : 1].reset();
+        processAction();
+    }
+}
+
+#if defined __unix__ || defined __APPLE__
+void Controller::readInput(){
+    char buffer[64];
+    ssize_t count {read(STDIN_FILENO, buffer, sizeof buffer)};
+    if(count <= 0){ // fin de l'entrée standard
+        loop_.quit();
+        return;
+    }
+
+    for(ssize_t i = 0; i < count; i++){
+        if(onKey_){
+            std::function<void()> onKey {std::move(onKey_)};
+            onKey_ = nullptr;
+            onKey();
+        } else if(onLine_){
+            std::optional<std::string> line {editor_.feed(static_cast<unsigned char>(buffer[i]))};
+            if(!line)
+                continue;
+
+            // la réponse peut déjà poser la question suivante: la question courante est retirée avant
+            LineHandler onLine {std::move(onLine_)};
+            onLine_ = nullptr;
+            if(!onLine(*line) && !onLine_ && !onKey_)
+                onLine_ = std::move(onLine);
+        }
+
+        resume();
+    }
+}
+
+void Controller::resume(){
+    if(model_->currentState()==StateGraph::EOG){
+        loop_.quit();
+    } else if(!onLine_ && !onKey_){
+        view_.update({model_});
+    }
+}
+
+void Controller::hintFinished(){
+    std::optional<Hint> hint {hints_.best()};
+    if(!hint || model_->currentState()!=StateGraph::PLAYER_TURN || !onLine_)
+        return;
+
+    std::cout << std::endl << "[" << AnsiColor::colorText("HINT", AnsiColor::YELLOW) << "] Suggestion: "
+              << std::string{hint->start} << " -> " << std::string{hint->end}
+              << " (profondeur " << hint->depth << ", évaluation " << hint->score << ")" << std::endl
+              << "-> " << editor_.input() << std::flush;
+}
+
+void Controller::flagFell(){
+    flagTimer_ = 0;
+    if(model_->currentState()!=StateGraph::PLAYER_TURN || !model_->currentPlayer().clock().flagged())
+        return;
+
+    hints_.cancel();
+    onLine_ = nullptr;
+    std::cout << std::endl;
+    model_->timeout();
+}
+#endif
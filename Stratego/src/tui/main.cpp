@@ -1,6 +1,10 @@
 #include <iostream>
+#include <random>
+#include <regex>
 
 #include "vcstuff.h"
+#include <allocTracker.h>
+#include <trace.h>
 #include <util.h>
 
 using namespace stratego;
@@ -9,35 +13,69 @@ int main(int argc, char** argv){
     Config::setDynamicResources(argv[0]);
     Model* gameModel{};
 
-    if(argc == 1){ // default mode
-        gameModel = new Stratego{};
-        Controller gameController{gameModel};
-        gameController.start();
-    } else{ // personalized mode
-        std::regex normalPattern{"(normal|stratego|classique)", std::regex_constants::icase};
-        std::regex revealPattern{"(reveal)", std::regex_constants::icase};
-        bool res1 {std::regex_match(argv[1], normalPattern)};
-        bool res2 {std::regex_match(argv[1], revealPattern)};
-
-        if(res1 || res2){
-            if(res1){ // normal mode
-                gameModel = new Stratego{};
-            } else{ // reveal mode
-                gameModel = new StrategoReveal{};
-            }
-
+    try{
+        if(argc == 1){ // default mode
+            gameModel = new Stratego{};
             Controller gameController{gameModel};
             gameController.start();
-        } else{
-            std::cerr << "Ancun mode de jeu correspondant n'a été trouvé.\n"
-                      << "Mode de jeu disponible:\n"
-                      << "\tnormal\n"
-                      << "\treveal\n";
+        } else{ // personalized mode
+            std::regex normalPattern{"(normal|stratego|classique)", std::regex_constants::icase};
+            std::regex revealPattern{"(reveal)", std::regex_constants::icase};
+            bool res1 {std::regex_match(argv[1], normalPattern)};
+            bool res2 {std::regex_match(argv[1], revealPattern)};
+
+            if(res1 || res2){
+                if(res1){ // normal mode
+                    gameModel = new Stratego{};
+                } else{ // reveal mode
+                    gameModel = new StrategoReveal{};
+                }
+
+                Controller gameController{gameModel};
+                for(int i = 2; i < argc; i++){
+                    std::string arg {argv[i]};
+                    if((arg == "--red" || arg == "--blue") && i + 1 < argc){ // joueur confié à un bot
+                        try{
+                            gameController.setBot(arg == "--red" ? model::Color::RED : model::Color::BLUE,
+                                                  Bot::create(argv[++i], std::random_device{}()));
+                        } catch(const std::exception& e){
+                            std::cerr << "Le bot '" << argv[i] << "' n'est pas disponible: " << e.what() << "\n"
+                                      << "Bots disponibles: random, search, engine:<commande>, plugin:<bibliothèque>\n";
 
-            return 1;
+                            delete gameModel;
+                            return 1;
+                        }
+                    } else{ // partie chronométrée
+                        try{
+                            gameModel->setTimeControl(model::TimeControl::parse(arg));
+                        } catch(const std::invalid_argument&){
+                            std::cerr << "La cadence '" << arg << "' n'est pas valide.\n"
+                                      << "Cadence attendue: minutes[+secondes d'incrément] (ex: 5+3, 10)\n";
+
+                            delete gameModel;
+                            return 1;
+                        }
+                    }
+                }
+
+                gameController.start();
+            } else{
+                std::cerr << "Ancun mode de jeu correspondant n'a été trouvé.\n"
+                          << "Mode de jeu disponible:\n"
+                          << "\tnormal\n"
+                          << "\treveal\n";
+
+                return 1;
+            }
         }
+    } catch(const std::exception& e){ // boucle d'évènements du contrôleur impossible à créer
+        std::cerr << e.what() << std::endl;
+        delete gameModel;
+        return 1;
     }
 
     delete gameModel;
+    STRATEGO_TRACE_EXPORT("stratego-trace.json");
+    STRATEGO_ALLOC_REPORT(std::cerr);
     return 0;
 }
@@ -2,7 +2,13 @@
 #define VCSTUFF_H
 
 #include "model.h"
+#include "bot.h"
+#include "eventLoop.h"
+#include "hintService.h"
+#include "setupGen.h"
 #include "action.h"
+#include "asker.h"
+#include "console.h"
 
 namespace stratego{
 
@@ -47,6 +53,11 @@ namespace stratego{
              */
             void displayEatenPieces() const noexcept;
 
+            /**
+             * Affiche le temps restant de chaque joueur, si la partie est chronométrée.
+             */
+            void displayClocks() const noexcept;
+
             /**
              * Traite la chaîne de caractère donné pour exécuter une action.
              *
@@ -70,11 +81,35 @@ namespace stratego{
     /**
      * Contrôleur de jeu intéragissant avec les utilisateurs et servant d'intermédiaire
      * à la transmission d'infos entre la vue et le modèle.
+     *
+     * Sous linux et apple, le contrôleur est piloté par une boucle d'évènements (cf. EventLoop): les
+     * questions posées aux joueurs n'attendent pas leur réponse mais enregistrent la suite à donner,
+     * exécutée lorsque le clavier a produit une touche ou une ligne. La boucle peut ainsi traiter,
+     * entre deux frappes, des minuteries et les résultats d'une recherche en arrière-plan.
+     *
+     * Chaque joueur peut être confié à un bot (cf. setBot()): sa disposition est alors générée
+     * aléatoirement et ses coups sont joués sans intervention au clavier.
      */
     class Controller{
 
+        /*
+         * Suite donnée à une ligne lue: retourne false si la ligne a été refusée et que la question
+         * reste posée.
+         */
+        using LineHandler = std::function<bool(const std::string&)>;
+
         Model* model_;
         View view_;
+#if defined __unix__ || defined __APPLE__
+        EventLoop loop_;
+        view::LineEditor editor_;
+        LineHandler onLine_;
+        std::function<void()> onKey_;
+        std::uint64_t flagTimer_;
+#endif
+        HintService hints_;
+        std::array<std::unique_ptr<Bot>, Config::PLAYER_COUNT> bots_;
+        model::SetupGenerator layouts_;
 
         public:
 
@@ -82,9 +117,19 @@ namespace stratego{
              * Construit un contrôleur en utilisant le modèle donné. Une vue par défaut
              * lui sera également donné.
              *
+             * @throw std::runtime_error si la boucle d'évènements du contrôleur ne peut être créée
+             *
              * @param model le modèle de jeu à utiliser
              */
-            Controller(Model* model) noexcept;
+            Controller(Model* model);
+
+            /**
+             * Confie le joueur de couleur donnée à un bot. Doit être appelée avant start().
+             *
+             * @param color la couleur du joueur
+             * @param bot le bot jouant pour ce joueur
+             */
+            void setBot(model::Color color, std::unique_ptr<Bot> bot) noexcept;
 
             /**
              * Commence une nouvelle partie de jeu. Uniquement cette méthode devrait être invoquée
@@ -137,6 +182,17 @@ namespace stratego{
              */
             void attack(const model::Position& startPos, const model::Position& endPos) noexcept;
 
+            /**
+             * Lance en arrière-plan la recherche d'une suggestion de coup pour le joueur courant, si
+             * elle ne porte pas déjà sur la position courante. Le contrôleur n'attend jamais son résultat;
+             * la recherche est annulée dès que le joueur joue.
+             *
+             * @throw std::system_error si le thread de recherche ne peut être démarré
+             *
+             * @return le service de suggestion, pour consulter la meilleure suggestion trouvée jusqu'ici.
+             */
+            const HintService& hint();
+
             /**
              * Signale le modèle qu'un passage au joueur suivant est souhaité.
              */
@@ -162,6 +218,62 @@ namespace stratego{
              * Demande aux joueurs s'ils veulent rejouer une partie et transmet leurs décision au modèle.
              */
             void replay() noexcept;
+
+#if defined __unix__ || defined __APPLE__
+            /**
+             * Récupère la boucle d'évènements du contrôleur, pour y programmer des minuteries ou y
+             * poster des tâches.
+             *
+             * @return la boucle d'évènements.
+             */
+            EventLoop& loop() noexcept;
+#endif
+
+        private:
+
+            /*
+             * Pose la question de l'asker donné et transmet la réponse valide à la fonction donnée.
+             */
+            template<class T>
+            void ask(std::shared_ptr<const controller::Asker<T>> asker, std::function<void(T)> onAnswer,
+                     const std::function<void(void)>& tabFunc = [](){});
+
+            /*
+             * Attend une touche quelconque avant d'exécuter la fonction donnée.
+             */
+            void waitKey(std::function<void()> onKey);
+
+            /*
+             * Récupère le bot jouant pour le joueur de couleur donnée, nullptr si le joueur est humain.
+             */
+            Bot* botOf(model::Color color) const noexcept;
+
+            /*
+             * Joue le coup du bot du joueur courant. Un bot en échec est retiré: le joueur reprend la main.
+             */
+            void playBot();
+
+#if defined __unix__ || defined __APPLE__
+            /*
+             * Traite les caractères disponibles sur l'entrée standard.
+             */
+            void readInput();
+
+            /*
+             * Relance la vue si plus aucune question n'est posée.
+             */
+            void resume();
+
+            /*
+             * Affiche la suggestion finale d'une recherche terminée.
+             */
+            void hintFinished();
+
+            /*
+             * Constate l'écoulement du temps du joueur courant, s'il n'a pas agi à temps.
+             */
+            void flagFell();
+#endif
     };
 };
 
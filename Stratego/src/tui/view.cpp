@@ -1,5 +1,8 @@
 #include <iomanip>
+#include <allocTracker.h>
+#include <perf.h>
 #include <util.h>
+#include <trace.h>
 
 #include "vcstuff.h"
 #include "ansiColor.h"
@@ -16,6 +19,7 @@ View::View(Model* model, Controller& controller) :
 {}
 
 void View::update(std::initializer_list<Observable*> args){
+    STRATEGO_TRACE_SCOPE("View::update");
     StateGraph::State currentState {model_ -> currentState()};
     std::string color {};
     AnsiColor red {AnsiColor::RED};
@@ -58,6 +62,7 @@ void View::update(std::initializer_list<Observable*> args){
                           << " Au tour de "
                           << model_ -> currentPlayer().pseudo()
                           << std::endl;
+                displayClocks();
                 displayEatenPieces();
                 hasDisplayBoard = true;
             }
@@ -97,6 +102,7 @@ void View::update(std::initializer_list<Observable*> args){
 }
 
 void View::processAction(const std::string& input) noexcept{
+    STRATEGO_ALLOC_SUBSYSTEM(COMMANDS);
     Command* cmd {};
     ActionMatcher actionMatcher{Action{input}};
     std::pair<Position, Position> positions {};
@@ -114,8 +120,8 @@ void View::processAction(const std::string& input) noexcept{
             cmd = new AttackCommand{controller_, positions.first, positions.second};
             break;
         case Action::HELP:
-            if(!actionMatcher.matcher()[1].str().empty()){
-                action = Action{actionMatcher.matcher()[1]};
+            if(actionMatcher.argument(0).value != -1){
+                action = Action{static_cast<Action::Value>(actionMatcher.argument(0).value)};
                 cmd = new HelpCommand{&action};
             } else{
                 cmd = new HelpCommand{};
@@ -138,8 +144,14 @@ void View::processAction(const std::string& input) noexcept{
         case Action::HISTORY:
             cmd = new HistoryCommand{model_ -> history()};
             break;
+        case Action::PERF:
+            cmd = new PerfCommand{model_ -> counters(), actionMatcher.argument(0).value == 1};
+            break;
         case Action::CLEAR:
             cmd = new ClearCommand{*this, model_ -> currentPlayer().color(), model_ -> currentPlayer().pseudo()};
+            break;
+        case Action::HINT:
+            cmd = new HintCommand{controller_};
     }
 
     cmd -> exec();
@@ -147,15 +159,11 @@ void View::processAction(const std::string& input) noexcept{
 }
 
 std::pair<Position, Position> View::processMoveAttackCommand(ActionMatcher& actionMatcher){
-    std::smatch matcher {actionMatcher.matcher()};
-    std::string posId {matcher[1]};
-    std::string way {matcher[2]};
-    Direction direction {Direction::from(way)};
-
-    Position startPos {Position::from(posId)};
+    Direction direction {Direction::from(actionMatcher.argument(1).text)};
+    Position startPos {Position::from(actionMatcher.argument(0).text)};
     Position endPos {startPos + direction};
-    if(!matcher[3].str().empty()){
-        int count {std::stoi(matcher[3])};
+    if(actionMatcher.argument(2).value != -1){
+        int count {actionMatcher.argument(2).value};
         switch(direction){
             case Direction::UP:
                 endPos = startPos + Position{0, -count};
@@ -176,13 +184,7 @@ std::pair<Position, Position> View::processMoveAttackCommand(ActionMatcher& acti
 }
 
 int View::processPieceStatCommand(view::ActionMatcher &actionMatcher){
-    std::smatch matcher {actionMatcher.matcher()};
-    int result = -1;
-    if(!matcher[1].str().empty()){
-        result = Piece::toRank(matcher[1].str());
-    }
-
-    return result;
+    return actionMatcher.argument(0).value;
 }
 
 void View::displayEatenPieces() const noexcept{
@@ -198,6 +200,20 @@ void View::displayEatenPieces() const noexcept{
     std::cout << std::endl << "Total: " << model_ -> currentPlayer().eatenPieces() << std::endl;
 }
 
+void View::displayClocks() const noexcept{
+    if(model_ -> timeControl().unlimited())
+        return;
+
+    std::cout << "Temps restant: ";
+    for(const Player* player : model_ -> players()){
+        AnsiColor color {player -> color() == Color::RED ? AnsiColor::RED : AnsiColor::BLUE};
+        std::cout << color << player -> pseudo() << AnsiColor{AnsiColor::RESET} << " "
+                  << AnsiColor::colorText(GameClock::format(player -> clock().remaining()), AnsiColor::BOLD) << " ";
+    }
+
+    std::cout << std::endl;
+}
+
 void View::displayIntro() const noexcept{
     AnsiColor red {AnsiColor::RED};
     AnsiColor blue {AnsiColor::BLUE};
@@ -220,6 +236,9 @@ void View::displayIntro() const noexcept{
 }
 
 void View::displayBoard() const noexcept{
+    perf::RenderTimer timer {model_ -> counters()};
+    STRATEGO_ALLOC_PHASE(RENDER);
+    STRATEGO_ALLOC_SUBSYSTEM(VIEW);
     const Board& board {model_ -> board()};
     int cellSize {util::cdigit(stratego::Config::PIECE_MAX_RANK) + util::cdigit(stratego::Config::BOARD_SIZE - 2) + 2};
     int rowIndexSize {util::cdigit(stratego::Config::BOARD_SIZE - 2)};
@@ -294,7 +313,8 @@ void View::displayNormalCell(const stratego::model::Cell &cell, int width) const
     if(cell.piece){
         std::cout << (cell.piece -> color() == Color::RED ? red : blue)
                   << std::setw(width)
-                  << (cell.piece -> revealed() ? std::string{*cell.piece} : stratego::Config::SYMBOL_HIDDEN_PIECE)
+                  << (model_ -> isVisible(*cell.piece, model_ -> currentPlayer().color()) ? std::string{*cell.piece}
+                                                                                          : stratego::Config::SYMBOL_HIDDEN_PIECE)
                   << stop;
     } else{
         std::cout << std::setw(width) << stratego::Config::SYMBOL_EMPTY;
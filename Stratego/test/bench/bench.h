@@ -0,0 +1,36 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/* ====================================================
+ * Points d'entrée des différents bancs d'essai de
+ * l'exécutable bench.
+ * ====================================================
+ */
+
+namespace stratego::bench{
+
+    /**
+     * Compte les positions atteignables depuis des dispositions fixes via le chemin de référence
+     * (Piece::canMove() et Piece::canAttack() sur un modèle de jeu) et via MoveGen, vérifie que
+     * les comptes concordent et affiche le nombre de positions par seconde.
+     *
+     * @param argc le nombre d'arguments propres au banc d'essai
+     * @param argv les arguments propres au banc d'essai
+     * @return 0 si les comptes concordent, 1 si non.
+     */
+    int perft(int argc, char** argv);
+
+    /**
+     * Mesure la latence (percentiles) et le nombre d'allocations par appel des opérations du modèle
+     * de jeu. Les résultats peuvent être sauvegardés au format JSON (--save fichier) et comparés à une
+     * exécution précédente (--compare fichier): une opération plus lente que le seuil donné
+     * (--threshold pourcentage, 10 par défaut) ou allouant davantage est signalée comme régression.
+     *
+     * @param argc le nombre d'arguments propres au banc d'essai
+     * @param argv les arguments propres au banc d'essai
+     * @return 0 si aucune régression n'a été détectée, 1 si non.
+     */
+    int micro(int argc, char** argv);
+}
+
+#endif // BENCH_H
@@ -0,0 +1,14 @@
+TEMPLATE = app
+CONFIG -= qt
+CONFIG -= app_bundle
+CONFIG += console
+
+include(../../config.pri)
+
+HEADERS += \
+    bench.h
+
+SOURCES += \
+    main.cpp \
+    micro.cpp \
+    perft.cpp
@@ -0,0 +1,24 @@
+#include <iostream>
+#include <string>
+
+#include <config.h>
+
+#include "bench.h"
+
+using namespace stratego;
+
+int main(int argc, char** argv){
+    Config::setDynamicResources(argv[0]);
+    std::string command {argc > 1 ? argv[1] : ""};
+
+    if(command == "perft")
+        return bench::perft(argc - 2, argv + 2);
+    if(command == "micro")
+        return bench::micro(argc - 2, argv + 2);
+
+    std::cerr << "Utilisation:\n"
+              << "\tbench perft [profondeur]\n"
+              << "\tbench micro [--filter nom] [--save fichier.json] [--compare fichier.json] [--threshold pourcentage]\n";
+
+    return 1;
+}
@@ -0,0 +1,451 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+#include <allocTracker.h>
+#include <beliefTracker.h>
+#include <bot.h>
+#include <moveGen.h>
+#include <piece.h>
+#include <pieceFactory.h>
+#include <setupGen.h>
+#include <setupStore.h>
+
+#include "bench.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+/* ========================== Allocations =========================== */
+#ifdef STRATEGO_ALLOC_TRACK
+namespace{
+
+    // les opérateurs globaux sont déjà remplacés par le suivi des allocations (cf. allocTracker.h)
+    long allocationCount() noexcept{
+        long count {};
+        alloc::Snapshot snapshot {alloc::snapshot()};
+        for(int s = 0; s < alloc::SUBSYSTEM_COUNT; s++)
+            count += snapshot.total(static_cast<alloc::Subsystem>(s)).count;
+
+        return count;
+    }
+}
+#else
+namespace{
+
+    std::atomic<long> allocations {0};
+
+    long allocationCount() noexcept{
+        return allocations.load();
+    }
+}
+
+void* operator new(std::size_t size){
+    ++allocations;
+    if(void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept{
+    std::free(ptr);
+}
+#endif
+
+
+/* ========================== Sampler =========================== */
+namespace{
+
+    /*
+     * Résultat d'un micro-benchmark.
+     */
+    struct Result{
+        std::string name;
+        double p50;
+        double p90;
+        double p99;
+        double mean;
+        double allocs;
+    };
+
+    /*
+     * Collecte les durées (en nanosecondes par appel) et le nombre d'allocations des appels mesurés.
+     */
+    class Sampler{
+
+        std::vector<double> samples_;
+        long allocs_;
+        long calls_;
+
+        public:
+
+            Sampler() noexcept : samples_ {}, allocs_ {}, calls_ {}{}
+
+            template<class F>
+            void time(F&& function, int batch = 1){
+                long allocs {allocationCount()};
+                auto begin {std::chrono::steady_clock::now()};
+                for(int i = 0; i < batch; i++)
+                    function();
+                auto end {std::chrono::steady_clock::now()};
+                allocs_ += allocationCount() - allocs;
+                calls_ += batch;
+                samples_.push_back(std::chrono::duration<double, std::nano>(end - begin).count() / batch);
+            }
+
+            Result result(const std::string& name){
+                std::sort(samples_.begin(), samples_.end());
+                auto percentile {[&](double p){
+                    return samples_.empty() ? 0 : samples_[std::min(samples_.size() - 1, static_cast<size_t>(p * samples_.size()))];
+                }};
+
+                double sum {};
+                for(double sample : samples_)
+                    sum += sample;
+
+                return {name, percentile(0.5), percentile(0.9), percentile(0.99),
+                        samples_.empty() ? 0 : sum / samples_.size(),
+                        calls_ ? static_cast<double>(allocs_) / calls_ : 0};
+            }
+    };
+
+    constexpr int SAMPLES = 2000;
+
+    Layout defaultLayout(){
+        util::MappedFile file {Config::BOARD_CONFIG_PATH + "default"};
+        Layout layout {};
+        ConfigFileParser::decode(file.content(), layout);
+        return layout;
+    }
+
+    /*
+     * Démarre une partie entre deux dispositions générées: le modèle est laissé dans l'état PLAYER_SWAP.
+     */
+    void startGame(Stratego& model, SetupGenerator& generator){
+        if(model.currentState() != StateGraph::NOT_STARTED)
+            model.replay(true);
+
+        model.init();
+        model.load(generator.next(), Color::RED);
+        model.load(generator.next(), Color::BLUE);
+        model.setup("red", "blue");
+    }
+
+    /*
+     * Crée deux pions adjacents sur le plateau de jeu donné: un maréchal rouge en (5, 5) et un
+     * capitaine bleu en (5, 6).
+     */
+    std::pair<Piece*, Piece*> duel(Board& board, StateGraph& graph, History& hist){
+        PieceFactory factory {};
+        Piece* red {factory.createPiece(Config::PIECE_MARSHAL_INFO.rank, {5, 5}, Color::RED, board, graph, hist)};
+        Piece* blue {factory.createPiece(Config::PIECE_CAPTAIN_INFO.rank, {5, 6}, Color::BLUE, board, graph, hist)};
+        board.getCell(5, 5).piece = red;
+        board.getCell(5, 6).piece = blue;
+        return {red, blue};
+    }
+
+    std::vector<Result> runAll(const std::string& filter){
+        std::vector<Result> results {};
+        auto run {[&](const std::string& name, auto&& body){
+            if(!filter.empty() && name.find(filter) == std::string::npos)
+                return;
+
+            Sampler sampler {};
+            body(sampler);
+            results.push_back(sampler.result(name));
+        }};
+
+        Layout layout {defaultLayout()};
+
+        run("ConfigFileParser::decode", [&](Sampler& s){
+            std::string content {SetupStore::toText(layout)};
+            Layout decoded {};
+            for(int i = 0; i < SAMPLES; i++)
+                s.time([&](){ ConfigFileParser::decode(content, decoded); }, 16);
+        });
+
+        run("ConfigFileParser::parse", [&](Sampler& s){
+            Board board {};
+            StateGraph graph {};
+            History hist {16};
+            ParseInfo info {board, graph, hist, Color::RED};
+            for(int i = 0; i < SAMPLES; i++){
+                ConfigFileParser parser {info, Config::BOARD_CONFIG_PATH + "default"};
+                parser.canParse();
+                s.time([&](){ parser.parse(); });
+                for(Piece* piece : parser.result())
+                    delete piece;
+            }
+        });
+
+        run("ConfigFileParser::canParseFile", [&](Sampler& s){
+            for(int i = 0; i < SAMPLES; i++)
+                s.time([&](){ ConfigFileParser::canParseFile(Config::BOARD_CONFIG_PATH + "default"); });
+        });
+
+        run("History::addSuccess", [&](Sampler& s){
+            History hist {1024};
+            for(int i = 0; i < SAMPLES; i++){
+                if(i % 1000 == 0)
+                    hist.clear();
+                s.time([&](){ hist.addSuccess("Déplacement du pion Maréchal en 5E par le joueur rouge"); });
+            }
+        });
+
+        run("Properties::propertyOf", [&](Sampler& s){
+            for(int i = 0; i < SAMPLES; i++)
+                s.time([&](){ Config::ACTION_DATA.propertyOf("move.syntax"); }, 16);
+        });
+
+        run("Position::from", [&](Sampler& s){
+            for(int i = 0; i < SAMPLES; i++)
+                s.time([&](){ Position::from("10J"); }, 16);
+        });
+
+        run("Piece::canMove", [&](Sampler& s){
+            Board board {};
+            StateGraph graph {};
+            History hist {16};
+            Piece* red {duel(board, graph, hist).first};
+            for(int i = 0; i < SAMPLES; i++)
+                s.time([&](){ red -> canMove({4, 5}); red -> canMove({5, 4}); }, 16);
+        });
+
+        run("Piece::canAttack", [&](Sampler& s){
+            Board board {};
+            StateGraph graph {};
+            History hist {16};
+            Piece* red {duel(board, graph, hist).first};
+            for(int i = 0; i < SAMPLES; i++)
+                s.time([&](){ red -> canAttack({5, 6}); }, 16);
+        });
+
+        run("Piece::move", [&](Sampler& s){
+            Board board {};
+            StateGraph graph {};
+            History hist {4 * SAMPLES};
+            Piece* red {duel(board, graph, hist).first};
+            for(int i = 0; i < SAMPLES; i++)
+                s.time([&](){ red -> move(i % 2 == 0 ? Position{4, 5} : Position{5, 5}); });
+        });
+
+        run("Piece::attack", [&](Sampler& s){
+            StateGraph graph {};
+            History hist {4 * SAMPLES};
+            for(int i = 0; i < SAMPLES; i++){
+                Board board {};
+                auto [red, blue] {duel(board, graph, hist)};
+                s.time([&](){ red -> attack({5, 6}); });
+                delete blue;
+            }
+        });
+
+        run("ModelAdapter::nextPlayer", [&](Sampler& s){
+            Stratego model {};
+            SetupGenerator generator {1};
+            RandomBot bot {1};
+            startGame(model, generator);
+            for(int i = 0; i < SAMPLES; i++){
+                s.time([&](){ model.nextPlayer(); });
+                BotMove move {bot.play(model)};
+                model.moveAttack(move.start, move.end);
+                model.nextTurn();
+                model.history().clear();
+                if(model.currentState() == StateGraph::GAME_OVER)
+                    startGame(model, generator);
+            }
+        });
+
+        run("ModelAdapter::nextTurn", [&](Sampler& s){
+            Stratego model {};
+            SetupGenerator generator {1};
+            RandomBot bot {1};
+            startGame(model, generator);
+            for(int i = 0; i < SAMPLES; i++){
+                model.nextPlayer();
+                BotMove move {bot.play(model)};
+                model.moveAttack(move.start, move.end);
+                s.time([&](){ model.nextTurn(); });
+                model.history().clear();
+                if(model.currentState() == StateGraph::GAME_OVER)
+                    startGame(model, generator);
+            }
+        });
+
+        run("Bot::legalMoves", [&](Sampler& s){
+            Stratego model {};
+            SetupGenerator generator {2};
+            RandomBot bot {2};
+            startGame(model, generator);
+            for(int i = 0; i < SAMPLES; i++){
+                model.nextPlayer();
+                s.time([&](){ Bot::legalMoves(model); });
+                BotMove move {bot.play(model)};
+                model.moveAttack(move.start, move.end);
+                model.nextTurn();
+                model.history().clear();
+                if(model.currentState() == StateGraph::GAME_OVER)
+                    startGame(model, generator);
+            }
+        });
+
+        run("BeliefTracker::update", [&](Sampler& s){
+            Stratego model {};
+            SetupGenerator generator {6};
+            RandomBot bot {6};
+            BeliefTracker tracker {Color::RED};
+            startGame(model, generator);
+            tracker.reset(model.observation(Color::RED));
+            for(int i = 0; i < SAMPLES; i++){
+                model.nextPlayer();
+                BotMove move {bot.play(model)};
+                model.moveAttack(move.start, move.end);
+                model.nextTurn();
+                model.history().clear();
+                s.time([&](){ tracker.update(model.observation(Color::RED)); });
+                if(model.currentState() == StateGraph::GAME_OVER){
+                    startGame(model, generator);
+                    tracker.reset(model.observation(Color::RED));
+                }
+            }
+        });
+
+        run("MoveGen::generate", [&](Sampler& s){
+            SetupGenerator generator {3};
+            MoveGen gen {generator.next(), generator.next()};
+            MoveGen::MoveList moves;
+            std::mt19937_64 rand {3};
+            for(int i = 0; i < SAMPLES; i++){
+                int count {};
+                s.time([&](){ count = gen.generate(moves); });
+                gen.make(moves[std::uniform_int_distribution<int>{0, count - 1}(rand)]);
+                if(gen.gameOver())
+                    gen = MoveGen{generator.next(), generator.next()};
+            }
+        });
+
+        run("SetupGenerator::next", [&](Sampler& s){
+            SetupGenerator generator {4};
+            for(int i = 0; i < SAMPLES; i++)
+                s.time([&](){ generator.next(); }, 16);
+        });
+
+        run("SetupStore::add", [&](Sampler& s){
+            SetupGenerator generator {5};
+            SetupStore store {};
+            for(int i = 0; i < SAMPLES; i++){
+                Layout next {generator.next()};
+                s.time([&](){ store.add(next); });
+            }
+        });
+
+        run("PackedSetup::canonical", [&](Sampler& s){
+            PackedSetup setup {layout};
+            for(int i = 0; i < SAMPLES; i++)
+                s.time([&](){ setup = setup.mirror().canonical(); }, 16);
+        });
+
+        return results;
+    }
+
+    /*
+     * Écrit les résultats donnés au format JSON.
+     */
+    void save(const std::vector<Result>& results, const std::string& filepath){
+        std::ofstream ofs {filepath, std::ios::trunc};
+        if(ofs.fail())
+            throw std::invalid_argument("Cannot open the given file");
+
+        ofs << std::fixed << std::setprecision(1) << "{\n  \"benchmarks\": [\n";
+        for(size_t i = 0; i < results.size(); i++){
+            const Result& r {results[i]};
+            ofs << "    {\"name\": \"" << r.name << "\", \"p50_ns\": " << r.p50 << ", \"p90_ns\": " << r.p90
+                << ", \"p99_ns\": " << r.p99 << ", \"mean_ns\": " << r.mean
+                << ", \"allocs_per_call\": " << std::setprecision(2) << r.allocs << std::setprecision(1) << "}"
+                << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+
+        ofs << "  ]\n}\n";
+    }
+
+    /*
+     * Extrait la valeur numérique associée à la clé donnée d'un objet JSON écrit par save().
+     */
+    double field(std::string_view object, std::string_view key){
+        size_t pos {object.find("\"" + std::string{key} + "\":")};
+        if(pos == std::string_view::npos)
+            throw std::invalid_argument("Missing field in baseline");
+
+        return std::strtod(object.data() + pos + key.size() + 3, nullptr);
+    }
+
+    /*
+     * Charge les résultats d'une exécution précédente écrits par save().
+     */
+    std::vector<Result> load(const std::string& filepath){
+        util::MappedFile file {filepath};
+        std::string_view content {file.content()};
+        std::vector<Result> results {};
+        size_t pos {};
+        while((pos = content.find("{\"name\": \"", pos)) != std::string_view::npos){
+            size_t end {content.find('}', pos)};
+            std::string_view object {content.substr(pos, end - pos)};
+            size_t nameEnd {object.find('"', 10)};
+            results.push_back({std::string{object.substr(10, nameEnd - 10)}, field(object, "p50_ns"), field(object, "p90_ns"),
+                               field(object, "p99_ns"), field(object, "mean_ns"), field(object, "allocs_per_call")});
+            pos = end;
+        }
+
+        return results;
+    }
+}
+
+int bench::micro(int argc, char** argv){
+    std::string filter {}, savePath {}, comparePath {};
+    double threshold {0.10};
+    for(int i = 0; i + 1 < argc; i += 2){
+        std::string arg {argv[i]};
+        if(arg == "--filter") filter = argv[i + 1];
+        else if(arg == "--save") savePath = argv[i + 1];
+        else if(arg == "--compare") comparePath = argv[i + 1];
+        else if(arg == "--threshold") threshold = std::stod(argv[i + 1]) / 100;
+    }
+
+    std::vector<Result> baseline {comparePath.empty() ? std::vector<Result>{} : load(comparePath)};
+    std::vector<Result> results {runAll(filter)};
+    bool regression {};
+
+    std::cout << std::left << std::setw(34) << "benchmark" << std::right << std::setw(12) << "p50 (ns)"
+              << std::setw(12) << "p90 (ns)" << std::setw(12) << "p99 (ns)" << std::setw(12) << "mean (ns)"
+              << std::setw(12) << "allocs" << (baseline.empty() ? "" : "   vs baseline") << std::endl;
+    for(const Result& r : results){
+        std::cout << std::left << std::setw(34) << r.name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << r.p50 << std::setw(12) << r.p90 << std::setw(12) << r.p99
+                  << std::setw(12) << r.mean << std::setw(12) << std::setprecision(2) << r.allocs;
+
+        auto base {std::find_if(baseline.begin(), baseline.end(), [&](const Result& b){ return b.name == r.name; })};
+        if(base != baseline.end()){
+            double delta {base -> p50 > 0 ? (r.p50 - base -> p50) / base -> p50 : 0};
+            bool slower {delta > threshold}, allocating {r.allocs > base -> allocs + 0.01};
+            regression |= slower || allocating;
+            std::cout << "   " << std::showpos << std::setprecision(1) << delta * 100 << "%" << std::noshowpos
+                      << (slower ? " REGRESSION" : "") << (allocating ? " ALLOCS" : "");
+        }
+
+        std::cout << std::endl;
+    }
+
+    if(!savePath.empty())
+        save(results, savePath);
+
+    return regression ? 1 : 0;
+}
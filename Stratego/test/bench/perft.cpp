@@ -0,0 +1,132 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include <bot.h>
+#include <moveGen.h>
+#include <setupGen.h>
+
+#include "bench.h"
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    /*
+     * Perft de référence: chaque noeud rejoue la séquence de coups depuis une nouvelle partie
+     * et énumère les coups via Piece::canMove() et Piece::canAttack().
+     */
+    std::uint64_t referencePerft(const Layout& red, const Layout& blue, std::vector<BotMove>& path, int depth){
+        if(depth == 0)
+            return 1;
+
+        std::vector<BotMove> moves {};
+        {
+            Stratego model {};
+            model.init();
+            model.load(red, Color::RED);
+            model.load(blue, Color::BLUE);
+            model.setup("red", "blue");
+            for(const BotMove& move : path){
+                model.nextPlayer();
+                model.moveAttack(move.start, move.end);
+                model.nextTurn();
+                model.history().clear();
+            }
+
+            if(model.currentState() == StateGraph::GAME_OVER)
+                return 0;
+
+            model.nextPlayer();
+            moves = Bot::legalMoves(model);
+        }
+
+        if(depth == 1)
+            return moves.size();
+
+        std::uint64_t nodes {};
+        for(const BotMove& move : moves){
+            path.push_back(move);
+            nodes += referencePerft(red, blue, path, depth - 1);
+            path.pop_back();
+        }
+
+        return nodes;
+    }
+
+    /*
+     * Mesure la durée d'exécution de la fonction donnée.
+     */
+    template<class F>
+    double timed(F&& function, std::uint64_t& result){
+        auto begin {std::chrono::steady_clock::now()};
+        result = function();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    Layout loadSetup(const std::string& filename){
+        util::MappedFile file {Config::BOARD_CONFIG_PATH + filename};
+        Layout layout {};
+        if(!ConfigFileParser::decode(file.content(), layout))
+            throw std::invalid_argument("Your file cannot be parsed");
+
+        return layout;
+    }
+
+    /*
+     * Perft du générateur compact seul (aucune référence n'existe hors variante classique) sur des
+     * dispositions aléatoires de la variante donnée.
+     */
+    template<class Variant>
+    void variantPerft(int maxDepth){
+        using Gen = BasicMoveGen<Variant>;
+        std::mt19937 rng {2021};
+        Gen gen {Gen::Topology::randomLayout(rng), Gen::Topology::randomLayout(rng)};
+        for(int depth = 1; depth <= maxDepth; depth++){
+            std::uint64_t nodes;
+            double time {timed([&](){ return gen.perft(depth); }, nodes)};
+            std::cout << std::setw(16) << Variant::NAME << std::setw(7) << depth
+                      << std::setw(14) << "-" << std::setw(14) << nodes
+                      << std::setw(16) << "-" << std::setw(16) << std::fixed << std::setprecision(0) << nodes / time << std::endl;
+        }
+    }
+}
+
+int bench::perft(int argc, char** argv){
+    int maxDepth {argc > 0 ? std::stoi(argv[0]) : 3};
+    SetupGenerator generator {2021};
+    std::vector<std::pair<std::string, std::array<Layout, 2>>> positions {
+        {"default/test", {loadSetup("default"), loadSetup("test")}},
+        {"test/default", {loadSetup("test"), loadSetup("default")}},
+        {"random/random", {generator.next(), generator.next()}}
+    };
+
+    bool ok {true};
+    std::cout << std::left << std::setw(16) << "position" << std::setw(7) << "depth"
+              << std::setw(14) << "reference" << std::setw(14) << "movegen"
+              << std::setw(16) << "ref nodes/s" << std::setw(16) << "gen nodes/s" << std::endl;
+    for(auto& [name, layouts] : positions){
+        for(int depth = 1; depth <= maxDepth; depth++){
+            std::vector<BotMove> path {};
+            std::uint64_t refNodes, genNodes;
+            double refTime {timed([&](){ return referencePerft(layouts[0], layouts[1], path, depth); }, refNodes)};
+            MoveGen gen {layouts[0], layouts[1]};
+            double genTime {timed([&](){ return gen.perft(depth); }, genNodes)};
+
+            ok &= refNodes == genNodes;
+            std::cout << std::setw(16) << name << std::setw(7) << depth
+                      << std::setw(14) << refNodes << std::setw(14) << genNodes
+                      << std::setw(16) << std::fixed << std::setprecision(0) << refNodes / refTime
+                      << std::setw(16) << genNodes / genTime
+                      << (refNodes == genNodes ? "" : "MISMATCH") << std::endl;
+        }
+    }
+
+    variantPerft<BarrageVariant>(maxDepth);
+    variantPerft<DuelVariant>(maxDepth);
+
+    std::cout << (ok ? "OK: les comptes concordent" : "ERREUR: les comptes divergent") << std::endl;
+    return ok ? 0 : 1;
+}
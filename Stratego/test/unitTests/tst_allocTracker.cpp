@@ -0,0 +1,51 @@
+#include <catch2/catch.hpp>
+#include <thread>
+#include <allocTracker.h>
+
+using namespace stratego;
+
+TEST_CASE("Allocation tracker", "[allocTracker]"){
+    alloc::reset();
+
+    SECTION("record() uses the current subsystem and phase"){
+        alloc::record(16);
+        {
+            alloc::PhaseScope phase {alloc::TURN};
+            alloc::SubsystemScope subsystem {alloc::PIECES};
+            alloc::record(32);
+            {
+                alloc::SubsystemScope nested {alloc::HISTORY};
+                alloc::record(8);
+            }
+            alloc::record(64);
+        }
+
+        alloc::Snapshot snapshot {alloc::snapshot()};
+        REQUIRE(snapshot.usage[alloc::OTHER][alloc::IDLE].count >= 1);
+        REQUIRE(snapshot.usage[alloc::PIECES][alloc::TURN].count == 2);
+        REQUIRE(snapshot.usage[alloc::PIECES][alloc::TURN].bytes == 96);
+        REQUIRE(snapshot.usage[alloc::HISTORY][alloc::TURN].count == 1);
+        REQUIRE(snapshot.total(alloc::PIECES).bytes == 96);
+        REQUIRE(snapshot.total(alloc::TURN).count == 3);
+    }
+
+    SECTION("Counters of every thread and turns are aggregated"){
+        std::thread worker {[](){
+            alloc::PhaseScope phase {alloc::SETUP};
+            alloc::record(10);
+            alloc::endTurn();
+        }};
+        worker.join();
+        alloc::endTurn();
+
+        alloc::Snapshot snapshot {alloc::snapshot()};
+        REQUIRE(snapshot.usage[alloc::OTHER][alloc::SETUP].bytes == 10);
+        REQUIRE(snapshot.turns == 2);
+
+        alloc::reset();
+        REQUIRE(alloc::snapshot().turns == 0);
+        REQUIRE(alloc::snapshot().total(alloc::SETUP).count == 0);
+    }
+
+    alloc::reset();
+}
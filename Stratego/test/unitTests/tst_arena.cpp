@@ -0,0 +1,172 @@
+#include <catch2/catch.hpp>
+#include <arena.h>
+#include <setupGen.h>
+
+using namespace stratego::model;
+using namespace stratego;
+
+namespace{
+
+    /*
+     * Bot jouant un coup invalide (immobile ou hors du plateau) ou levant une exception.
+     */
+    struct FaultyBot : Bot{
+        enum Fault{STILL, OFF_BOARD, CRASH};
+
+        Fault fault;
+
+        explicit FaultyBot(Fault what) noexcept : fault {what}{}
+
+        BotMove play(const Model& model) override{
+            if(fault == CRASH)
+                throw std::runtime_error("The bot has crashed");
+
+            BotMove move {Bot::legalMoves(model).front()};
+            return {move.start, fault == STILL ? move.start : Position{100, 100}};
+        }
+
+        std::string name() const override{
+            return "faulty";
+        }
+    };
+}
+
+TEST_CASE("Model layout loading", "[arena][load]"){
+
+    Stratego model {};
+    model.init();
+    SetupGenerator generator {3};
+
+    SECTION("load(Layout, Color) valid"){
+        model.load(generator.next(), Color::RED);
+        REQUIRE(model.currentState() == StateGraph::SET_UP);
+        model.load(generator.next(), Color::BLUE);
+        REQUIRE(model.currentState() == StateGraph::SET_UP);
+        REQUIRE_FALSE(model.hasWon(Color::RED));
+        REQUIRE_FALSE(model.hasWon(Color::BLUE));
+
+        model.setup("red", "blue");
+        model.nextPlayer();
+        std::vector<BotMove> moves {Bot::legalMoves(model)};
+        REQUIRE_FALSE(moves.empty());
+        for(const BotMove& move : moves)
+            REQUIRE(model.board().getPiece(move.start) -> color() == Color::RED);
+    }
+
+    SECTION("load(Layout, Color) invalid"){
+        Layout layout {generator.next()};
+        layout[0] = layout[1] = Config::PIECE_FLAG_INFO.rank;
+        model.load(layout, Color::RED);
+        REQUIRE(model.currentState() == StateGraph::ERROR_SETUP);
+    }
+}
+
+TEST_CASE("Arena games", "[arena][play]"){
+
+    SetupGenerator generator {11};
+    Arena arena {};
+
+    SECTION("play() random bots"){
+        for(int i = 0; i < 5; i++){
+            RandomBot red {static_cast<std::uint64_t>(i)}, blue {static_cast<std::uint64_t>(i + 100)};
+            GameOutcome outcome {arena.play(generator.next(), generator.next(), red, blue)};
+            REQUIRE((outcome == GameOutcome::RED_WIN || outcome == GameOutcome::BLUE_WIN || outcome == GameOutcome::DRAW));
+        }
+    }
+
+    SECTION("play() reproducible"){
+        Layout red {generator.next()}, blue {generator.next()};
+        RandomBot bot1 {5}, bot2 {6}, bot3 {5}, bot4 {6};
+        REQUIRE(arena.play(red, blue, bot1, bot2) == arena.play(red, blue, bot3, bot4));
+    }
+
+    SECTION("play() turn limit"){
+        RandomBot red {1}, blue {2};
+        REQUIRE(Arena{0}.play(generator.next(), generator.next(), red, blue) == GameOutcome::DRAW);
+    }
+
+    SECTION("play() material adjudication"){
+        int adjudicated {};
+        for(int i = 0; i < 5; i++){
+            Layout red {generator.next()}, blue {generator.next()};
+            RandomBot bot1 {static_cast<std::uint64_t>(i)}, bot2 {static_cast<std::uint64_t>(i + 100)};
+            RandomBot bot3 {static_cast<std::uint64_t>(i)}, bot4 {static_cast<std::uint64_t>(i + 100)};
+            GameOutcome limited {Arena{300}.play(red, blue, bot1, bot2)};
+            GameOutcome outcome {Arena{300, {}, false, 1}.play(red, blue, bot3, bot4)};
+            if(limited != GameOutcome::DRAW)
+                REQUIRE(outcome == limited);
+            else if(outcome != GameOutcome::DRAW)
+                adjudicated++;
+        }
+
+        REQUIRE(adjudicated > 0);
+    }
+
+    SECTION("play() reveal variant"){
+        Layout red {generator.next()}, blue {generator.next()};
+        RandomBot bot1 {5}, bot2 {6}, bot3 {5}, bot4 {6};
+        Arena reveal {Arena::DEFAULT_MAX_TURNS, {}, true};
+        REQUIRE(reveal.play(red, blue, bot1, bot2) == reveal.play(red, blue, bot3, bot4));
+    }
+
+    SECTION("play() bot failures"){
+        Layout red {generator.next()}, blue {generator.next()};
+        RandomBot random {1};
+        FaultyBot invalid {FaultyBot::STILL}, offBoard {FaultyBot::OFF_BOARD}, crashing {FaultyBot::CRASH};
+        try{
+            arena.play(red, blue, random, invalid);
+            FAIL("An invalid move must be refused");
+        } catch(const BotFailure& failure){
+            REQUIRE(failure.color() == Color::BLUE);
+        }
+        try{
+            arena.play(red, blue, offBoard, random);
+            FAIL("A move off the board must be refused");
+        } catch(const BotFailure& failure){
+            REQUIRE(failure.color() == Color::RED);
+        }
+        try{
+            arena.play(red, blue, crashing, random);
+            FAIL("A crashing bot must forfeit");
+        } catch(const BotFailure& failure){
+            REQUIRE(failure.color() == Color::RED);
+            REQUIRE(std::string{failure.what()} == "The bot has crashed");
+        }
+    }
+
+    SECTION("playable()"){
+        REQUIRE(Arena::playable(generator.next()));
+
+        // les pions de la première ligne face au lac sont bloqués, les autres sont des bombes
+        Layout stuck {};
+        REQUIRE(ConfigFileParser::decode("2 9 D 6 6 7 7 7 8 8\n5 5 4 4 6 6 4 4 5 5\n"
+                                         "2 2 2 3 3 3 3 2 2 2\nB B 3 1 B B 10 2 B B\n", stuck));
+        REQUIRE_FALSE(Arena::playable(stuck));
+        REQUIRE_THROWS_AS(arena.play(stuck, generator.next(), *Bot::create("random", 0), *Bot::create("random", 1)),
+                          std::invalid_argument);
+
+        Layout incomplete {generator.next()};
+        incomplete[0] = incomplete[1] = Config::PIECE_FLAG_INFO.rank;
+        REQUIRE_FALSE(Arena::playable(incomplete));
+    }
+
+    SECTION("Bot::create()"){
+        REQUIRE(Bot::create("random", 0) -> name() == "random");
+        REQUIRE_THROWS_AS(Bot::create("unknown", 0), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Wilson interval", "[arena][wilson]"){
+
+    Interval interval {wilsonInterval(50, 100)};
+    REQUIRE(interval.low == Approx(0.404).epsilon(0.01));
+    REQUIRE(interval.high == Approx(0.596).epsilon(0.01));
+
+    interval = wilsonInterval(0, 10);
+    REQUIRE(interval.low == 0);
+    REQUIRE(interval.high > 0);
+
+    interval = wilsonInterval(0, 0);
+    REQUIRE(interval.low == 0);
+    REQUIRE(interval.high == 1);
+}
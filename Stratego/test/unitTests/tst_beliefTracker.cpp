@@ -0,0 +1,113 @@
+#include <catch2/catch.hpp>
+#include <beliefTracker.h>
+#include <bot.h>
+#include <model.h>
+
+#include <random>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    void startBeliefGame(Model& model){
+        model.init();
+        model.load("default", Color::RED);
+        model.load("test", Color::BLUE);
+        model.setup("max", "alex");
+        model.nextPlayer();
+    }
+
+    void playBelief(Model& model, BeliefTracker& tracker, const Position& start, const Position& end){
+        model.moveAttack(start, end);
+        model.nextTurn();
+        model.history().clear();
+        if(model.currentState() != StateGraph::GAME_OVER)
+            model.nextPlayer();
+
+        tracker.update(model.observation(Color::RED));
+    }
+
+    float total(const BeliefTracker::Distribution& dist){
+        float sum {};
+        for(float p : dist)
+            sum += p;
+
+        return sum;
+    }
+}
+
+TEST_CASE("belief tracker", "[belief]"){
+
+    Stratego model {};
+    BeliefTracker tracker {Color::RED};
+
+    SECTION("uniform prior matches the army"){
+        startBeliefGame(model);
+        tracker.reset(model.observation(Color::RED));
+
+        float bombs {};
+        for(int x = 1; x <= 10; x++){
+            for(int y = 1; y <= 4; y++){
+                REQUIRE(total(tracker.distribution({x, y})) == Approx(1));
+                bombs += tracker.probability({x, y}, Config::PIECE_BOMB_INFO.rank);
+            }
+        }
+
+        REQUIRE(bombs == Approx(Config::PIECE_BOMB_INFO.count));
+        REQUIRE(tracker.probability({1, 4}, Config::PIECE_FLAG_INFO.rank) == Approx(1. / Config::ARMY_SIZE));
+        REQUIRE(tracker.probability({5, 7}, Config::PIECE_MARSHAL_INFO.rank) == 0);
+        REQUIRE(tracker.mostLikely({5, 5}) == Observation::EMPTY);
+        REQUIRE_THROWS_AS(tracker.reset(model.observation(Color::BLUE)), std::invalid_argument);
+        model.board().clear();
+    }
+
+    SECTION("moves, scout runs and combats"){
+        startBeliefGame(model);
+        tracker.reset(model.observation(Color::RED));
+
+        playBelief(model, tracker, {5, 7}, {5, 6});
+        playBelief(model, tracker, {6, 4}, {6, 6}); // seul un éclaireur parcourt plusieurs cases
+        REQUIRE(tracker.probability({6, 6}, Config::PIECE_SCOUT_INFO.rank) == 1);
+        REQUIRE(tracker.probability({6, 4}, Config::PIECE_SCOUT_INFO.rank) == 0);
+        REQUIRE(tracker.remaining()[Config::PIECE_SCOUT_INFO.rank] == Config::PIECE_SCOUT_INFO.count - 1);
+
+        playBelief(model, tracker, {5, 6}, {5, 5});
+        playBelief(model, tracker, {6, 3}, {6, 4}); // un pion qui bouge n'est ni une bombe ni le drapeau
+        REQUIRE(tracker.probability({6, 4}, Config::PIECE_BOMB_INFO.rank) == 0);
+        REQUIRE(tracker.probability({6, 4}, Config::PIECE_FLAG_INFO.rank) == 0);
+        REQUIRE(total(tracker.distribution({6, 4})) == Approx(1));
+        REQUIRE(tracker.probability({6, 3}, Config::PIECE_MINER_INFO.rank) == 0);
+
+        playBelief(model, tracker, {6, 7}, {6, 6}); // les deux éclaireurs s'éliminent
+        REQUIRE(tracker.mostLikely({6, 6}) == Observation::EMPTY);
+        REQUIRE(tracker.remaining()[Config::PIECE_SCOUT_INFO.rank] == Config::PIECE_SCOUT_INFO.count - 1);
+
+        BeliefTracker rebuilt {Color::RED};
+        rebuilt.reset(model.observation(Color::RED), model.currentPlayer().stats());
+        REQUIRE(rebuilt.remaining() == tracker.remaining());
+        model.board().clear();
+    }
+
+    SECTION("the true rank is never ruled out"){
+        std::mt19937 rng {41};
+        startBeliefGame(model);
+        tracker.reset(model.observation(Color::RED));
+        for(int ply = 0; ply < 200 && model.currentState() != StateGraph::GAME_OVER; ply++){
+            std::vector<BotMove> moves {Bot::legalMoves(model)};
+            if(moves.empty())
+                break;
+
+            const BotMove& move {moves[rng() % moves.size()]};
+            playBelief(model, tracker, move.start, move.end);
+            for(const Piece* piece : model.board().pieces(Color::BLUE)){
+                REQUIRE(total(tracker.distribution(piece -> position())) == Approx(1));
+                REQUIRE(tracker.probability(piece -> position(), piece -> rank()) > 0);
+                if(piece -> knownBy(Color::RED))
+                    REQUIRE(tracker.probability(piece -> position(), piece -> rank()) == Approx(1));
+            }
+        }
+
+        model.board().clear();
+    }
+}
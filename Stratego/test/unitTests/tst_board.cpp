@@ -1,5 +1,8 @@
 #include <catch2/catch.hpp>
 #include <gamestuff.h>
+#include <pieceFactory.h>
+
+#include <algorithm>
 
 using namespace stratego::model;
 
@@ -120,3 +123,63 @@ TEST_CASE("board predicate", "[board][predicate]"){
         REQUIRE_FALSE(board.isInside({-1, 0}));
     }
 }
+
+TEST_CASE("board piece lists", "[board][pieces]"){
+
+    Board board {};
+    StateGraph graph {};
+    History hist {50};
+    PieceFactory factory {};
+    auto contains {[&](Color color, const Piece* piece){
+        Board::PieceList list {board.pieces(color)};
+        return std::find(list.begin(), list.end(), piece) != list.end();
+    }};
+
+    Piece* red1 {factory.createPiece(2, {1, 9}, Color::RED, board, graph, hist)};
+    Piece* red2 {factory.createPiece(5, {2, 9}, Color::RED, board, graph, hist)};
+    Piece* blue {factory.createPiece(4, {1, 2}, Color::BLUE, board, graph, hist)};
+    board.place({1, 9}, red1);
+    board.place({2, 9}, red2);
+    board.place({1, 2}, blue);
+
+    SECTION("place"){
+        REQUIRE(board.pieces(Color::RED).size() == 2);
+        REQUIRE(board.pieces(Color::BLUE).size() == 1);
+        REQUIRE(contains(Color::RED, red1));
+        REQUIRE(contains(Color::RED, red2));
+        REQUIRE(contains(Color::BLUE, blue));
+    }
+
+    SECTION("move and capture"){
+        board.move({1, 9}, {1, 3});
+        REQUIRE(board.getPiece(1, 3) == red1);
+        REQUIRE(board.getPiece(1, 9) == nullptr);
+
+        board.move({1, 3}, {1, 2});
+        REQUIRE(board.pieces(Color::BLUE).size() == 0);
+        REQUIRE(board.pieces(Color::RED).size() == 2);
+        delete blue;
+
+        // la position suivie après déplacement permet de retirer le pion
+        REQUIRE(board.remove({1, 2}) == red1);
+        REQUIRE(board.pieces(Color::RED).size() == 1);
+        REQUIRE(contains(Color::RED, red2));
+        delete red1;
+    }
+
+    SECTION("remove with swap"){
+        REQUIRE(board.remove({1, 9}) == red1);
+        REQUIRE(board.remove({1, 9}) == nullptr);
+        board.move({2, 9}, {3, 9});
+        REQUIRE(board.remove({3, 9}) == red2);
+        REQUIRE(board.pieces(Color::RED).size() == 0);
+        delete red1;
+        delete red2;
+    }
+
+    SECTION("clear empties the lists"){
+        board.clear();
+        REQUIRE(board.pieces(Color::RED).size() == 0);
+        REQUIRE(board.pieces(Color::BLUE).size() == 0);
+    }
+}
@@ -0,0 +1,132 @@
+#include <catch2/catch.hpp>
+#include <bot.h>
+#include <model.h>
+#include <piece.h>
+
+#include <atomic>
+#include <random>
+#include <set>
+#include <thread>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    void startSnapshotGame(Model& model){
+        model.init();
+        model.load("default", Color::RED);
+        model.load("test", Color::BLUE);
+        model.setup("max", "alex");
+        model.nextPlayer();
+    }
+
+    void playSnapshot(Model& model, const Position& start, const Position& end){
+        model.moveAttack(start, end);
+        model.nextTurn();
+        model.history().clear();
+        if(model.currentState() != StateGraph::GAME_OVER)
+            model.nextPlayer();
+    }
+
+    int pieceTotal(const BoardSnapshot& snapshot, Color color){
+        int total {snapshot.count(color)};
+        for(std::uint8_t captured : snapshot.captured[color == Color::RED ? 0 : 1])
+            total += captured;
+
+        return total;
+    }
+}
+
+TEST_CASE("board snapshots", "[snapshot]"){
+
+    Stratego model {};
+
+    SECTION("each applied move publishes a new version"){
+        startSnapshotGame(model);
+        std::shared_ptr<const BoardSnapshot> setup {model.snapshot()};
+        for(const Piece* piece : model.board().pieces(Color::BLUE)){
+            REQUIRE(setup -> at(piece -> position()).rank == piece -> rank());
+            REQUIRE(setup -> at(piece -> position()).color == Color::BLUE);
+        }
+
+        playSnapshot(model, {5, 7}, {5, 6});
+        std::shared_ptr<const BoardSnapshot> moved {model.snapshot()};
+        REQUIRE(moved -> version == setup -> version + 1); // nextTurn() et nextPlayer() ne publient rien
+        REQUIRE(moved -> plies == 1);
+        REQUIRE(moved -> at({5, 6}).rank == Config::PIECE_MARSHAL_INFO.rank);
+        REQUIRE(moved -> at({5, 6}).flags & Observation::MOVED);
+        REQUIRE(moved -> at({5, 7}).rank == Observation::EMPTY);
+
+        // un instantané détenu n'est jamais réécrit
+        REQUIRE(setup -> at({5, 7}).rank == Config::PIECE_MARSHAL_INFO.rank);
+        REQUIRE(setup -> plies == 0);
+        model.board().clear();
+    }
+
+    SECTION("combats update the captured pieces"){
+        startSnapshotGame(model);
+        playSnapshot(model, {5, 7}, {5, 6});
+        playSnapshot(model, {6, 4}, {6, 6});
+        playSnapshot(model, {6, 7}, {6, 6}); // les deux éclaireurs s'éliminent
+        std::shared_ptr<const BoardSnapshot> snapshot {model.snapshot()};
+        REQUIRE(snapshot -> at({6, 6}).rank == Observation::EMPTY);
+        REQUIRE(snapshot -> captured[0][Config::PIECE_SCOUT_INFO.rank] == 1);
+        REQUIRE(snapshot -> captured[1][Config::PIECE_SCOUT_INFO.rank] == 1);
+        REQUIRE(snapshot -> count(Color::RED) == static_cast<int>(model.board().pieces(Color::RED).size()));
+        model.board().clear();
+    }
+
+    SECTION("released buffers are recycled"){
+        startSnapshotGame(model);
+        std::set<const BoardSnapshot*> buffers {};
+        std::mt19937 rng {44};
+        for(int ply = 0; ply < 20 && model.currentState() != StateGraph::GAME_OVER; ply++){
+            std::vector<BotMove> moves {Bot::legalMoves(model)};
+            const BotMove& move {moves[rng() % moves.size()]};
+            playSnapshot(model, move.start, move.end);
+            buffers.insert(model.snapshot().get());
+        }
+
+        REQUIRE(buffers.size() <= 2);
+        model.board().clear();
+    }
+
+    SECTION("concurrent readers always see a consistent position"){
+        startSnapshotGame(model);
+        int redTotal {pieceTotal(*model.snapshot(), Color::RED)};
+        int blueTotal {pieceTotal(*model.snapshot(), Color::BLUE)};
+        std::atomic<bool> done {false};
+        std::atomic<int> inconsistent {0};
+        std::vector<std::thread> readers {};
+        for(int i = 0; i < 3; i++){
+            readers.emplace_back([&]{
+                std::uint64_t last {};
+                while(!done){
+                    std::shared_ptr<const BoardSnapshot> snapshot {model.snapshot()};
+                    if(snapshot -> version < last || pieceTotal(*snapshot, Color::RED) != redTotal ||
+                       pieceTotal(*snapshot, Color::BLUE) != blueTotal)
+                        inconsistent++;
+                    last = snapshot -> version;
+                }
+            });
+        }
+
+        std::mt19937 rng {440};
+        for(int ply = 0; ply < 300 && model.currentState() != StateGraph::GAME_OVER; ply++){
+            std::vector<BotMove> moves {Bot::legalMoves(model)};
+            if(moves.empty())
+                break;
+
+            const BotMove& move {moves[rng() % moves.size()]};
+            playSnapshot(model, move.start, move.end);
+        }
+
+        done = true;
+        for(std::thread& reader : readers)
+            reader.join();
+
+        REQUIRE(inconsistent == 0);
+        model.board().clear();
+    }
+}
@@ -0,0 +1,141 @@
+#include <catch2/catch.hpp>
+#include <bot.h>
+#include <gameClock.h>
+#include <model.h>
+
+#include <thread>
+
+using namespace stratego;
+using namespace stratego::model;
+using namespace std::chrono_literals;
+
+namespace{
+
+    void startClockGame(Model& model, const TimeControl& control){
+        model.setTimeControl(control);
+        model.init();
+        model.load("default", Color::RED);
+        model.load("test", Color::BLUE);
+        model.setup("max", "alex");
+        model.nextPlayer();
+    }
+}
+
+TEST_CASE("game clock", "[clock]"){
+
+    GameClock::Clock::time_point t0 {};
+
+    SECTION("Fischer increment after each action"){
+        GameClock clock {{10s, 2s}};
+        REQUIRE_FALSE(clock.running());
+        REQUIRE(clock.remaining(t0 + 1h) == 10s);
+
+        clock.start(t0);
+        REQUIRE(clock.running());
+        REQUIRE(clock.remaining(t0 + 3s) == 7s);
+        clock.stop(t0 + 3s);
+        REQUIRE(clock.remaining(t0 + 1h) == 9s);
+
+        clock.start(t0 + 10s);
+        clock.start(t0 + 11s); // déjà démarrée
+        clock.stop(t0 + 12s);
+        REQUIRE(clock.remaining() == 9s);
+        REQUIRE_FALSE(clock.flagged());
+    }
+
+    SECTION("sudden death flag fall"){
+        GameClock clock {{5s, {}}};
+        clock.start(t0);
+        REQUIRE_FALSE(clock.flagged(t0 + 4s));
+        REQUIRE(clock.flagged(t0 + 5s));
+        clock.stop(t0 + 6s);
+        REQUIRE(clock.flagged());
+        REQUIRE(clock.remaining() == -1s);
+        REQUIRE(GameClock::format(clock.remaining()) == "0:00.0");
+    }
+
+    SECTION("unlimited clock never flags"){
+        GameClock clock {};
+        clock.start(t0);
+        clock.stop(t0 + 24h);
+        REQUIRE(clock.remaining() == GameClock::Duration::max());
+        REQUIRE_FALSE(clock.flagged());
+        REQUIRE(GameClock::format(clock.remaining()) == "-");
+    }
+
+    SECTION("time control notation"){
+        TimeControl fischer {TimeControl::parse("5+3")};
+        REQUIRE(fischer.initial == 5min);
+        REQUIRE(fischer.increment == 3s);
+        TimeControl suddenDeath {TimeControl::parse(" 10 ")};
+        REQUIRE(suddenDeath.initial == 10min);
+        REQUIRE(suddenDeath.increment == GameClock::Duration::zero());
+        REQUIRE(GameClock::format(fischer.initial + 1500ms) == "5:01.5");
+        REQUIRE_THROWS_AS(TimeControl::parse("0"), std::invalid_argument);
+        REQUIRE_THROWS_AS(TimeControl::parse("5+"), std::invalid_argument);
+        REQUIRE_THROWS_AS(TimeControl::parse("blitz"), std::invalid_argument);
+    }
+}
+
+TEST_CASE("model clocks", "[clock][model]"){
+
+    Stratego model {};
+
+    SECTION("only the current player's clock runs"){
+        startClockGame(model, {1min, 1s});
+        REQUIRE(model.players()[0] -> clock().running());
+        REQUIRE_FALSE(model.players()[1] -> clock().running());
+
+        model.moveAttack({5, 7}, {5, 6});
+        REQUIRE_FALSE(model.players()[0] -> clock().running());
+        REQUIRE(model.players()[0] -> clock().remaining() > 1min); // incrément ajouté
+        model.nextTurn();
+        REQUIRE(model.currentState() == StateGraph::PLAYER_SWAP);
+        model.nextPlayer();
+        REQUIRE(model.players()[1] -> clock().running());
+        model.board().clear();
+    }
+
+    SECTION("a move played after the flag fall loses"){
+        startClockGame(model, {1ms, {}});
+        std::this_thread::sleep_for(5ms);
+        model.moveAttack({5, 7}, {5, 6});
+        REQUIRE(model.currentState() == StateGraph::GAME_TURN);
+        model.nextTurn();
+        REQUIRE(model.currentState() == StateGraph::GAME_OVER);
+        REQUIRE(model.hasWon(Color::BLUE));
+        REQUIRE_FALSE(model.hasWon(Color::RED));
+        model.board().clear();
+    }
+
+    SECTION("timeout of an idle player"){
+        startClockGame(model, {20ms, {}});
+        REQUIRE_THROWS_AS(model.timeout(), std::logic_error);
+        std::this_thread::sleep_for(30ms);
+        model.timeout();
+        REQUIRE(model.currentState() == StateGraph::GAME_TURN);
+        REQUIRE(model.board().getPiece({5, 7}) != nullptr);
+        model.nextTurn();
+        REQUIRE(model.hasWon(Color::BLUE));
+        REQUIRE_FALSE(model.hasWon(Color::RED));
+        model.board().clear();
+    }
+
+    SECTION("bots get their thinking budget"){
+        startClockGame(model, {});
+        REQUIRE(Bot::budget(model) == GameClock::Duration::max());
+        model.board().clear();
+
+        Stratego timed {};
+        startClockGame(timed, {40s, 2s});
+        GameClock::Duration budget {Bot::budget(timed)};
+        REQUIRE(budget > 1s);
+        REQUIRE(budget <= 1s + 1500ms);
+
+        SearchBot bot {};
+        BotMove move {bot.play(timed)};
+        timed.moveAttack(move.start, move.end);
+        REQUIRE(timed.currentState() == StateGraph::GAME_TURN);
+        timed.board().clear();
+    }
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch.hpp>
+#include <engineBot.h>
+
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+using namespace stratego;
+using namespace stratego::model;
+using namespace std::chrono_literals;
+
+namespace{
+
+    /*
+     * Moteur scripté: enregistre les commandes reçues et joue toujours le coup donné.
+     */
+    std::string scriptedEngine(const std::string& log, const std::string& move){
+        return "while read -r cmd rest; do echo \"$cmd $rest\" >> " + log + "; case $cmd in "
+               "sep) echo 'id name scripted'; echo sepok;; "
+               "go) echo 'info depth 1'; echo 'bestmove " + move + "';; "
+               "quit) exit 0;; esac; done";
+    }
+
+    void startEngineGame(Model& model){
+        model.init();
+        model.load("default", Color::RED);
+        model.load("test", Color::BLUE);
+        model.setup("max", "alex");
+        model.nextPlayer();
+    }
+}
+
+TEST_CASE("engine protocol", "[engine]"){
+
+    SECTION("moves are written as both positions"){
+        BotMove move {{5, 10}, {5, 6}};
+        REQUIRE(EngineBot::formatMove(move) == "10E6E");
+
+        BotMove read {};
+        REQUIRE(EngineBot::parseMove("10E6E", read));
+        REQUIRE(read.start == move.start);
+        REQUIRE(read.end == move.end);
+        REQUIRE_FALSE(EngineBot::parseMove("10E", read));
+        REQUIRE_FALSE(EngineBot::parseMove("E6E", read));
+    }
+
+    SECTION("positions describe the observation of the engine"){
+        Stratego model {};
+        startEngineGame(model);
+        model.moveAttack({5, 7}, {5, 6});
+        model.nextTurn();
+        model.nextPlayer();
+
+        const Observation& obs {model.observation(Color::BLUE)};
+        std::string line {EngineBot::formatPosition(obs, {{{5, 7}, {5, 6}}})};
+        REQUIRE(line.rfind("position ", 0) == 0);
+        REQUIRE(line.find(" captured 000000000000 000000000000 moves 7E6E") != std::string::npos);
+
+        Observation read {};
+        std::vector<BotMove> moves {};
+        REQUIRE(EngineBot::parsePosition(line, Color::BLUE, read, moves));
+        REQUIRE(read.encode() == obs.encode());
+        REQUIRE(read.ranks == obs.ranks);
+        REQUIRE(read.has({5, 6}, Observation::MOVED));
+        REQUIRE(read.plies == 1);
+        REQUIRE(read.lastTo == Observation::toSquare({5, 6}));
+        REQUIRE(moves.size() == 1);
+        REQUIRE_FALSE(EngineBot::parsePosition("position ...", Color::BLUE, read, moves));
+        model.board().clear();
+    }
+}
+
+TEST_CASE("external engines", "[engine]"){
+
+    std::string log {"/tmp/stratego-engine-" + std::to_string(getpid()) + ".log"};
+    std::remove(log.c_str());
+
+    SECTION("the engine plays the moves it answers"){
+        Stratego model {};
+        startEngineGame(model);
+        {
+            std::unique_ptr<Bot> bot {Bot::create("engine:" + scriptedEngine(log, "7E6E"), 0)};
+            REQUIRE(bot -> name() == "scripted");
+
+            Layout layout {};
+            layout.fill(Config::PIECE_SCOUT_INFO.rank);
+            bot -> start(layout, Color::RED);
+            BotMove move {bot -> play(model)};
+            REQUIRE(move.start == Position{5, 7});
+            REQUIRE(move.end == Position{5, 6});
+            model.moveAttack(move.start, move.end);
+            REQUIRE(model.currentState() == StateGraph::GAME_TURN);
+        }
+
+        std::ifstream file {log};
+        std::stringstream transcript {};
+        transcript << file.rdbuf();
+        REQUIRE(transcript.str().find("newgame red\nsetup CCCCCCCCCC") != std::string::npos);
+        REQUIRE(transcript.str().find("\nposition ") != std::string::npos);
+        REQUIRE(transcript.str().find("\ngo searchmoves ") != std::string::npos);
+        REQUIRE(transcript.str().find(" 7E6E") != std::string::npos);
+        REQUIRE(transcript.str().find("quit") != std::string::npos);
+        model.board().clear();
+    }
+
+    SECTION("unresponsive, terminated or confused engines are reported"){
+        REQUIRE_THROWS_AS(EngineBot("exec cat > /dev/null", 50ms), std::runtime_error);
+        REQUIRE_THROWS_AS(EngineBot("exit 0"), std::runtime_error);
+
+        Stratego model {};
+        startEngineGame(model);
+        EngineBot bot {scriptedEngine(log, "nowhere")};
+        REQUIRE_THROWS_AS(bot.play(model), std::runtime_error);
+        model.board().clear();
+    }
+
+    std::remove(log.c_str());
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch.hpp>
+#include <eventLoop.h>
+
+#include <thread>
+#include <unistd.h>
+
+using namespace stratego;
+using namespace std::chrono_literals;
+
+TEST_CASE("event loop", "[eventloop]"){
+
+    EventLoop loop {};
+
+    SECTION("timers fire in deadline order and can be cancelled"){
+        std::vector<int> fired {};
+        loop.schedule(20ms, [&]{ fired.push_back(2); });
+        loop.schedule(5ms, [&]{ fired.push_back(1); });
+        std::uint64_t cancelled {loop.schedule(10ms, [&]{ fired.push_back(3); })};
+        loop.cancel(cancelled);
+
+        auto deadline {EventLoop::Clock::now() + 1s};
+        while(fired.size() < 2 && EventLoop::Clock::now() < deadline)
+            loop.runOnce();
+
+        REQUIRE(fired == std::vector<int>{1, 2});
+    }
+
+    SECTION("a due timer cancelled by another one does not fire"){
+        std::vector<int> fired {};
+        std::uint64_t second {};
+        loop.schedule(1ms, [&]{
+            fired.push_back(1);
+            loop.cancel(second);
+        });
+        second = loop.schedule(2ms, [&]{ fired.push_back(2); });
+        loop.schedule(3ms, [&]{ fired.push_back(3); });
+
+        std::this_thread::sleep_for(5ms);
+        REQUIRE(loop.runOnce(0ms) == 2);
+        REQUIRE(fired == std::vector<int>{1, 3});
+        REQUIRE(loop.runOnce(5ms) == 0);
+    }
+
+    SECTION("periodic timers repeat until cancelled"){
+        int ticks {};
+        std::uint64_t timer {};
+        timer = loop.schedule(1ms, [&]{
+            if(++ticks == 3)
+                loop.cancel(timer);
+        }, 1ms);
+
+        auto deadline {EventLoop::Clock::now() + 1s};
+        while(ticks < 3 && EventLoop::Clock::now() < deadline)
+            loop.runOnce();
+
+        REQUIRE(ticks == 3);
+        REQUIRE(loop.runOnce(5ms) == 0);
+    }
+
+    SECTION("readable descriptors wake the loop"){
+        int fds[2];
+        REQUIRE(pipe(fds) == 0);
+        std::string received {};
+        loop.watch(fds[0], [&]{
+            char buffer[16];
+            ssize_t count {read(fds[0], buffer, sizeof buffer)};
+            received.append(buffer, count);
+        });
+
+        REQUIRE(loop.runOnce(0ms) == 0);
+        REQUIRE(write(fds[1], "e2e4", 4) == 4);
+        REQUIRE(loop.runOnce(1s) == 1);
+        REQUIRE(received == "e2e4");
+
+        loop.unwatch(fds[0]);
+        REQUIRE(write(fds[1], "x", 1) == 1);
+        REQUIRE(loop.runOnce(5ms) == 0);
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    SECTION("tasks posted from another thread run on the loop thread"){
+        std::thread::id runner {};
+        std::thread poster {[&]{
+            std::this_thread::sleep_for(10ms);
+            loop.post([&]{ runner = std::this_thread::get_id(); });
+            loop.quit();
+        }};
+
+        loop.run(); // ne retourne qu'une fois quit() exécutée
+        poster.join();
+        REQUIRE(runner == std::this_thread::get_id());
+    }
+}
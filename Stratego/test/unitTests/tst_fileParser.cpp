@@ -1,6 +1,11 @@
 #include <catch2/catch.hpp>
 #include <gamestuff.h>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <thread>
 
 using namespace stratego::model;
 using namespace stratego;
@@ -71,3 +76,68 @@ TEST_CASE("ConfigFileParser parsing", "[parser][parsing]"){
         }
     }
 }
+
+TEST_CASE("ConfigFileParser decoding", "[parser][decode]"){
+
+    ConfigFileParser::Layout layout {};
+    std::string valid {"2 9 D 6 6 7 7 7 8 8\n5 5 4 4 6 6 4 4 5 5\n2 2 2 3 3 3 3 2 2 2\nB B B 3 10 2 1 B B B\n"};
+
+    SECTION("decode() valid content"){
+        REQUIRE(ConfigFileParser::decode(valid, layout));
+        REQUIRE(layout[0] == 2);
+        REQUIRE(layout[2] == Config::PIECE_FLAG_INFO.rank);
+        REQUIRE(layout[34] == 10);
+        REQUIRE(layout[39] == Config::PIECE_BOMB_INFO.rank);
+    }
+
+    SECTION("decode() tolerant separators"){
+        std::string content {"2\t9 d  6 6 7 7 7 8 8\r\n5 5 4 4 6 6 4 4 5 5\r\n2 2 2 3 3 3 3 2 2 2\r\nb B B 3 10 2 1 B B B\r\n\n"};
+        REQUIRE(ConfigFileParser::decode(content, layout));
+    }
+
+    SECTION("decode() invalid content"){
+        REQUIRE_FALSE(ConfigFileParser::decode("", layout));
+        REQUIRE_FALSE(ConfigFileParser::decode(valid.substr(0, valid.size() - 3), layout));
+        REQUIRE_FALSE(ConfigFileParser::decode("\n" + valid, layout));
+        REQUIRE_FALSE(ConfigFileParser::decode(valid + "B\n", layout));
+
+        std::string badToken {valid};
+        badToken[0] = 'X';
+        REQUIRE_FALSE(ConfigFileParser::decode(badToken, layout));
+
+        std::string badCount {valid};
+        badCount[0] = '3';
+        REQUIRE_FALSE(ConfigFileParser::decode(badCount, layout));
+    }
+
+    SECTION("canParseFile()"){
+        REQUIRE(ConfigFileParser::canParseFile(Config::BOARD_CONFIG_PATH + "default"));
+        REQUIRE(ConfigFileParser::canParseFile(Config::BOARD_CONFIG_PATH + "default"));
+        REQUIRE_FALSE(ConfigFileParser::canParseFile(Config::BOARD_CONFIG_PATH + "wrong"));
+        REQUIRE_FALSE(ConfigFileParser::canParseFile(Config::BOARD_CONFIG_PATH + "doesNotExist"));
+    }
+
+    SECTION("canParseFile() rewritten file"){
+        std::string path {(std::filesystem::temp_directory_path() / "stratego-tst_fileParser").string()};
+        std::string content {"2 9 D 6 6 7 7 7 8 8\n5 5 4 4 6 6 4 4 5 5\n2 2 2 3 3 3 3 2 2 2\nB B B 3 10 2 1 B B B\n"};
+        auto write {[](const std::string& filepath, const std::string& text){
+            std::ofstream {filepath, std::ios::trunc} << text;
+        }};
+
+        write(path, content);
+        REQUIRE(ConfigFileParser::canParseFile(path));
+
+        // même taille et même seconde: seule la date à la nanoseconde distingue les deux versions
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        std::string invalid {content};
+        invalid[4] = 'X';
+        write(path, invalid);
+        REQUIRE_FALSE(ConfigFileParser::canParseFile(path));
+
+        // un fichier remplacé par renommage change d'inode
+        write(path + ".new", content);
+        std::rename((path + ".new").c_str(), path.c_str());
+        REQUIRE(ConfigFileParser::canParseFile(path));
+        std::remove(path.c_str());
+    }
+}
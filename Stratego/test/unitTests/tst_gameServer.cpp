@@ -0,0 +1,216 @@
+#include <catch2/catch.hpp>
+#include <gameServer.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace stratego;
+using namespace std::chrono_literals;
+
+namespace{
+
+    /*
+     * Connexion de test au serveur, pilotant la boucle d'évènements en attendant ses réponses.
+     */
+    class TestClient{
+
+        EventLoop& loop_;
+        int fd_;
+        std::string input_;
+
+        public:
+
+            TestClient(EventLoop& loop, const std::string& path) : loop_ {loop}, fd_ {socket(AF_UNIX, SOCK_STREAM, 0)}, input_ {}{
+                sockaddr_un address {};
+                address.sun_family = AF_UNIX;
+                path.copy(address.sun_path, path.size());
+                REQUIRE(connect(fd_, reinterpret_cast<sockaddr*>(&address), sizeof address) == 0);
+                fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) | O_NONBLOCK);
+                loop_.runOnce(0ms); // acceptation
+            }
+
+            void send(const std::string& line){
+                std::string data {line + "\n"};
+                REQUIRE(write(fd_, data.data(), data.size()) == static_cast<ssize_t>(data.size()));
+            }
+
+            std::string receive(){
+                auto deadline {EventLoop::Clock::now() + 1s};
+                size_t end {};
+                while((end = input_.find('\n')) == std::string::npos && EventLoop::Clock::now() < deadline){
+                    loop_.runOnce(1ms);
+                    char buffer[4096];
+                    ssize_t count {read(fd_, buffer, sizeof buffer)};
+                    if(count > 0)
+                        input_.append(buffer, count);
+                    else if(count == 0)
+                        return "EOF";
+                }
+                if(end == std::string::npos)
+                    return "";
+
+                std::string line {input_.substr(0, end)};
+                input_.erase(0, end + 1);
+                return line;
+            }
+
+            std::string request(const std::string& line){
+                send(line);
+                return receive();
+            }
+
+            ~TestClient(){
+                close(fd_);
+            }
+    };
+}
+
+TEST_CASE("game server", "[server]"){
+
+    std::string path {"/tmp/stratego-test-" + std::to_string(getpid()) + ".sock"};
+    EventLoop loop {};
+    GameServer server {loop, path, ServerLimits{2, 8, 64, 64 * 1024, 1}};
+
+    SECTION("two clients play a game until one of them leaves"){
+        TestClient red {loop, path}, blue {loop, path};
+        REQUIRE(server.clients() == 2);
+        REQUIRE(red.request("PING") == "PONG");
+        REQUIRE(red.request("NEW classic 5+3") == "CREATED 1");
+        REQUIRE(red.request("JOIN 1 red max default") == "JOINED 1 red");
+        REQUIRE(blue.request("JOIN 1 red alex test") == "ERR seat already taken");
+        REQUIRE(blue.request("CLOCK 1") == "ERR unknown game");
+        REQUIRE(blue.request("JOIN 1 blue alex test") == "JOINED 1 blue");
+        for(TestClient* client : {&red, &blue}){
+            REQUIRE(client -> receive() == "START 1");
+            REQUIRE(client -> receive() == "TURN 1 red");
+        }
+
+        REQUIRE(blue.request("MOVE 1 4D 5D") == "ERR not your turn");
+        REQUIRE(red.request("MOVE 1 7E 5E").rfind("ERR ", 0) == 0);
+        red.send("MOVE 1 7E 6E");
+        for(TestClient* client : {&red, &blue}){
+            REQUIRE(client -> receive() == "MOVED 1 7E 6E");
+            REQUIRE(client -> receive() == "TURN 1 blue");
+        }
+
+        std::string board {red.request("BOARD 1")};
+        REQUIRE(board.size() == std::string{"BOARD 1 red "}.size() + 100);
+        REQUIRE(board.rfind("BOARD 1 red ", 0) == 0);
+        REQUIRE(board[12 + 5 * 10 + 4] == 'K'); // maréchal (rang 10) en 6E
+        REQUIRE(board[12 + 6 * 10 + 4] == '.');
+        REQUIRE(board.find('?', 12) != std::string::npos);
+        REQUIRE(board.find_first_of("abcdefghijkl", 12) == std::string::npos);
+        REQUIRE(red.request("CLOCK 1").rfind("CLOCK 1 ", 0) == 0);
+
+        blue.send("LEAVE 1");
+        REQUIRE(red.receive() == "OVER 1 red forfeit");
+        REQUIRE(blue.receive() == "OVER 1 red forfeit");
+        REQUIRE(server.games() == 0);
+        REQUIRE(server.idleModels() == 0); // une partie abandonnée en cours de jeu n'est pas recyclée
+    }
+
+    SECTION("a closed connection forfeits its games"){
+        TestClient red {loop, path};
+        REQUIRE(red.request("NEW") == "CREATED 1");
+        REQUIRE(red.request("JOIN 1 red max default") == "JOINED 1 red");
+        {
+            TestClient blue {loop, path};
+            REQUIRE(blue.request("JOIN 1 blue alex random") == "JOINED 1 blue");
+            REQUIRE(red.receive() == "START 1");
+            REQUIRE(red.receive() == "TURN 1 red");
+        }
+
+        REQUIRE(red.receive() == "OVER 1 red forfeit");
+        REQUIRE(server.clients() == 1);
+        REQUIRE(server.games() == 0);
+    }
+
+    SECTION("a creator without a seat cannot end a started game"){
+        TestClient red {loop, path}, blue {loop, path};
+        {
+            TestClient host {loop, path};
+            REQUIRE(host.request("NEW") == "CREATED 1");
+            REQUIRE(red.request("JOIN 1 red max default") == "JOINED 1 red");
+            REQUIRE(blue.request("JOIN 1 blue alex default") == "JOINED 1 blue");
+            REQUIRE(host.request("LEAVE 1") == "ERR unknown game");
+        }
+
+        for(TestClient* client : {&red, &blue}){
+            REQUIRE(client -> receive() == "START 1");
+            REQUIRE(client -> receive() == "TURN 1 red");
+        }
+        red.send("MOVE 1 7E 6E");
+        REQUIRE(blue.receive() == "MOVED 1 7E 6E");
+        REQUIRE(server.clients() == 2);
+        REQUIRE(server.games() == 1);
+    }
+
+    SECTION("a creator without a seat cancels its unstarted game"){
+        TestClient red {loop, path};
+        {
+            TestClient host {loop, path};
+            REQUIRE(host.request("NEW") == "CREATED 1");
+            REQUIRE(red.request("JOIN 1 red max default") == "JOINED 1 red");
+        }
+
+        REQUIRE(red.receive() == "OVER 1 draw cancelled");
+        REQUIRE(server.games() == 0);
+    }
+
+    SECTION("a finished game's model is recycled for the next game"){
+        TestClient bot {loop, path};
+        REQUIRE(bot.request("NEW") == "CREATED 1");
+        REQUIRE(bot.request("JOIN 1 red max test") == "JOINED 1 red");
+        REQUIRE(bot.request("JOIN 1 blue alex test") == "JOINED 1 blue");
+        REQUIRE(bot.receive() == "START 1");
+        REQUIRE(bot.receive() == "TURN 1 red");
+        for(const std::string& move : {"7F 6F", "4F 5F", "6F 6E", "5F 6F"}){
+            REQUIRE(bot.request("MOVE 1 " + move) == "MOVED 1 " + move);
+            REQUIRE(bot.receive().rfind("TURN 1 ", 0) == 0);
+        }
+
+        REQUIRE(bot.request("MOVE 1 6E 4E") == "MOVED 1 6E 4E");
+        REQUIRE(bot.receive() == "OVER 1 red end");
+        REQUIRE(server.games() == 0);
+        REQUIRE(server.idleModels() == 1);
+
+        REQUIRE(bot.request("NEW") == "CREATED 2");
+        REQUIRE(server.idleModels() == 0);
+        REQUIRE(bot.request("LEAVE 2") == "OVER 2 draw cancelled");
+        REQUIRE(server.games() == 0);
+        REQUIRE(bot.request("PING") == "PONG");
+    }
+
+    SECTION("one connection can hold both seats of many games"){
+        TestClient bot {loop, path};
+        REQUIRE(bot.request("NEW reveal") == "CREATED 1");
+        REQUIRE(bot.request("NEW") == "CREATED 2");
+        REQUIRE(bot.request("NEW") == "ERR too many games");
+        REQUIRE(bot.request("JOIN 2 red max default") == "JOINED 2 red");
+        REQUIRE(bot.request("JOIN 2 blue max default") == "JOINED 2 blue");
+        REQUIRE(bot.receive() == "START 2");
+        REQUIRE(bot.receive() == "TURN 2 red");
+        REQUIRE(bot.request("LEAVE 2") == "OVER 2 draw forfeit");
+        REQUIRE(bot.request("LEAVE 1") == "OVER 1 draw cancelled");
+        REQUIRE(server.games() == 0);
+    }
+
+    SECTION("invalid requests are rejected"){
+        TestClient client {loop, path};
+        REQUIRE(client.request("HELLO") == "ERR unknown request");
+        REQUIRE(client.request("NEW chess") == "ERR unknown variant");
+        REQUIRE(client.request("NEW classic 0").rfind("ERR ", 0) == 0);
+        REQUIRE(client.request("NEW") == "CREATED 1");
+        REQUIRE(client.request("JOIN 1 green max") == "ERR unknown color");
+        REQUIRE(client.request("JOIN 1 red max ../default") == "ERR invalid layout name");
+        REQUIRE(client.request("JOIN 1 red max missing").rfind("ERR ", 0) == 0);
+        REQUIRE(client.request("JOIN 1 red max default") == "JOINED 1 red");
+        REQUIRE(client.request("MOVE 1 7E 6E") == "ERR not your turn");
+        REQUIRE(client.request(std::string(100, 'x')) == "ERR request too long");
+        REQUIRE(client.receive() == "EOF");
+        REQUIRE(server.clients() == 0);
+        REQUIRE(server.games() == 0);
+    }
+}
@@ -0,0 +1,51 @@
+#include <catch2/catch.hpp>
+#include <gamestuff.h>
+#include <util.h>
+
+using namespace stratego::model;
+using namespace stratego;
+
+TEST_CASE("Position conversion", "[struct][position]"){
+
+    Position pos {};
+
+    SECTION("tryFrom() valid"){
+        REQUIRE(Position::tryFrom("7E", pos));
+        REQUIRE(pos == Position{5, 7});
+        REQUIRE(Position::tryFrom("10j", pos));
+        REQUIRE(pos == Position{10, 10});
+        REQUIRE(Position::tryFrom("1a", pos));
+        REQUIRE(pos == Position{1, 1});
+        REQUIRE(std::string{Position::from("6e")} == "6E");
+    }
+
+    SECTION("tryFrom() invalid"){
+        pos = {3, 3};
+        for(std::string_view str : {"", "7", "E", "E7", "0A", "05A", "010A", "11A", "7K", "7EE", "100A", " 7E", "7E "})
+            REQUIRE_FALSE(Position::tryFrom(str, pos));
+
+        REQUIRE(pos == Position{3, 3});
+        REQUIRE_THROWS_AS(Position::from("05A"), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Direction conversion", "[struct][direction]"){
+
+    REQUIRE(Direction::from("up") == Direction::UP);
+    REQUIRE(Direction::from("DOWN") == Direction::DOWN);
+    REQUIRE(Direction::from("Left") == Direction::LEFT);
+    REQUIRE(Direction::from("rIGHT") == Direction::RIGHT);
+
+    for(std::string_view str : {"", "u", "upp", " up", "north"})
+        REQUIRE_THROWS_AS(Direction::from(str), std::invalid_argument);
+}
+
+TEST_CASE("Case-insensitive comparison", "[struct][util]"){
+
+    REQUIRE(util::striequals("", ""));
+    REQUIRE(util::striequals("Reveal", "rEVEAL"));
+    REQUIRE(util::striequals("engine:7E", "ENGINE:7e"));
+    REQUIRE_FALSE(util::striequals("reveal", "reveals"));
+    REQUIRE_FALSE(util::striequals("up", "down"));
+    REQUIRE_FALSE(util::striequals("a", ""));
+}
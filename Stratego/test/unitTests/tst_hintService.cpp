@@ -0,0 +1,78 @@
+#include <catch2/catch.hpp>
+#include <bot.h>
+#include <hintService.h>
+
+#include <chrono>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    void startHintGame(Model& model){
+        model.init();
+        model.load("default", Color::RED);
+        model.load("test", Color::BLUE);
+        model.setup("max", "alex");
+        model.nextPlayer();
+    }
+
+    /*
+     * Attend la fin de la recherche, sans jamais attendre plus de quelques secondes.
+     */
+    bool waitFor(const HintService& hints){
+        auto deadline {std::chrono::steady_clock::now() + std::chrono::seconds{10}};
+        while(hints.searching() && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+
+        return !hints.searching();
+    }
+}
+
+TEST_CASE("hint service", "[hint]"){
+
+    Stratego model {};
+
+    SECTION("the suggestion is a legal move"){
+        startHintGame(model);
+        HintService hints {2};
+        REQUIRE_FALSE(hints.best());
+        hints.start(model);
+        REQUIRE(waitFor(hints));
+
+        std::optional<Hint> hint {hints.best()};
+        REQUIRE(hint);
+        REQUIRE(hint -> depth == 2);
+        std::vector<BotMove> moves {Bot::legalMoves(model)};
+        REQUIRE(std::any_of(moves.begin(), moves.end(), [&](const BotMove& move){
+            return move.start == hint -> start && move.end == hint -> end;
+        }));
+        model.board().clear();
+    }
+
+    SECTION("suggestions deepen and survive a restart on the same position"){
+        startHintGame(model);
+        HintService hints {3};
+        hints.start(model);
+        REQUIRE(waitFor(hints));
+        REQUIRE(hints.best() -> depth == 3);
+
+        hints.start(model);
+        REQUIRE_FALSE(hints.searching());
+        REQUIRE(hints.best() -> depth == 3);
+        model.board().clear();
+    }
+
+    SECTION("cancel stops the search and forgets the suggestion"){
+        startHintGame(model);
+        HintService hints {HintService::MAX_DEPTH};
+        hints.start(model);
+        hints.cancel();
+        REQUIRE_FALSE(hints.searching());
+        REQUIRE_FALSE(hints.best());
+
+        model.moveAttack({5, 7}, {5, 6});
+        REQUIRE_THROWS_AS(hints.start(model), std::logic_error);
+        model.board().clear();
+    }
+}
@@ -7,7 +7,7 @@ using namespace stratego;
 using namespace stratego::model;
 
 void clearModel(Model& model){
-    model.board().~Board();
+    model.board().clear();
 }
 
 void playMove(Model& model, const Position& startPos, const Position& endPos){
@@ -34,7 +34,7 @@ TEST_CASE("model state mutation", "[model][state]"){
         model.init();
         model.load("default", Color::RED);
         REQUIRE(model.currentState() == StateGraph::SET_UP);
-        model.board().~Board();
+        model.board().clear();
     }
 
     SECTION("after invalid load(string, Color)"){
@@ -59,7 +59,7 @@ TEST_CASE("model state mutation", "[model][state]"){
         model.setup("max", "alex");
         model.nextPlayer();
         REQUIRE(model.currentState() == StateGraph::PLAYER_TURN);
-        model.board().~Board();
+        model.board().clear();
         clearModel(model);
     }
 
@@ -71,7 +71,7 @@ TEST_CASE("model state mutation", "[model][state]"){
         model.nextPlayer();
         model.stop();
         REQUIRE(model.currentState() == StateGraph::EOG);
-        model.board().~Board();
+        model.board().clear();
         clearModel(model);
     }
 
@@ -237,7 +237,7 @@ TEST_CASE("model state mutation", "[model][state]"){
         model.nextTurn();
         model.replay(true);
         REQUIRE(model.currentState() == StateGraph::NOT_STARTED);
-        board.~Board();
+        board.clear();
     }
 
     SECTION("after replay(bool) false"){
@@ -257,3 +257,74 @@ TEST_CASE("model state mutation", "[model][state]"){
         clearModel(model);
     }
 }
+
+TEST_CASE("model rule variants", "[model][rules]"){
+
+    SECTION("moves follow the model's rules"){
+        StrategoReveal model {};
+        model.init();
+        model.load("test", Color::RED);
+        const Piece& piece {*model.board().getPiece(6, 7)};
+        REQUIRE(model.canMove(piece, {6, 1}));
+        for(int y = 1; y <= 6; y++)
+            REQUIRE(model.canMove(piece, {6, y}) == piece.canMove<RevealRules>({6, y}));
+        clearModel(model);
+    }
+
+    SECTION("combatants stay revealed only in the reveal variant"){
+        Stratego classic {};
+        StrategoReveal reveal {};
+        for(Model* model : std::initializer_list<Model*>{&classic, &reveal}){
+            model -> init();
+            model -> load("default", Color::RED);
+            model -> load("test", Color::BLUE);
+            model -> setup("max", "alex");
+            model -> nextPlayer();
+            playMove(*model, {5, 7}, {5, 6});
+            playMove(*model, {6, 4}, {6, 6});
+            model -> attack({5, 6}, {6, 6}); // le maréchal rouge bat l'éclaireur bleu
+            model -> nextTurn();
+            model -> nextPlayer();
+
+            bool revealed {};
+            for(int y = 1; y < model -> board().size() - 1; y++){
+                for(int x = 1; x < model -> board().size() - 1; x++){
+                    const Piece* piece {model -> board().getPiece(x, y)};
+                    if(piece && piece -> color() != model -> currentPlayer().color() && piece -> hasBeenInCombat())
+                        revealed |= model -> isVisible(*piece, model -> currentPlayer().color());
+                }
+            }
+
+            REQUIRE(model -> board().getPiece(6, 6) -> rank() == Config::PIECE_MARSHAL_INFO.rank);
+            REQUIRE(revealed == (model == &reveal));
+            clearModel(*model);
+        }
+    }
+
+    SECTION("visibility depends on the perspective only"){
+        Stratego model {};
+        model.init();
+        model.load("default", Color::RED);
+        model.load("test", Color::BLUE);
+        model.setup("max", "alex");
+        model.nextPlayer();
+        playMove(model, {5, 7}, {5, 6});
+        playMove(model, {6, 4}, {6, 6});
+
+        const Piece& marshal {*model.board().getPiece(5, 6)};
+        REQUIRE(model.isVisible(marshal, Color::RED));
+        REQUIRE_FALSE(model.isVisible(marshal, Color::BLUE));
+        REQUIRE_FALSE(model.isVisible(marshal, std::nullopt));
+
+        model.attack({5, 6}, {6, 6});
+        REQUIRE(marshal.knownBy(Color::BLUE));
+        REQUIRE(model.isVisible(marshal, Color::BLUE)); // combat du tour courant
+        REQUIRE(model.isVisible(marshal, std::nullopt));
+
+        model.nextTurn();
+        model.nextPlayer();
+        REQUIRE(model.isVisible(marshal, Color::RED));
+        REQUIRE_FALSE(model.isVisible(marshal, Color::BLUE));
+        clearModel(model);
+    }
+}
@@ -0,0 +1,144 @@
+#include <catch2/catch.hpp>
+#include <bot.h>
+#include <moveGen.h>
+#include <setupGen.h>
+
+#include <algorithm>
+
+using namespace stratego::model;
+using namespace stratego;
+
+namespace{
+
+    std::vector<std::pair<int, int>> sorted(std::vector<std::pair<int, int>> moves){
+        std::sort(moves.begin(), moves.end());
+        return moves;
+    }
+
+    std::vector<std::pair<int, int>> movesOf(const MoveGen& gen){
+        MoveGen::MoveList list;
+        int count {gen.generate(list)};
+        std::vector<std::pair<int, int>> moves {};
+        for(int i = 0; i < count; i++)
+            moves.push_back({list[i].from, list[i].to});
+
+        return sorted(moves);
+    }
+
+    std::vector<std::pair<int, int>> movesOf(const Model& model){
+        std::vector<std::pair<int, int>> moves {};
+        for(const BotMove& move : Bot::legalMoves(model))
+            moves.push_back({MoveGen::toSquare(move.start), MoveGen::toSquare(move.end)});
+
+        return sorted(moves);
+    }
+}
+
+TEST_CASE("MoveGen against the model", "[moveGen][reference]"){
+
+    SetupGenerator generator {99};
+
+    SECTION("generate(), make() and gameOver() follow random games"){
+        for(std::uint64_t seed = 0; seed < 10; seed++){
+            Layout red {generator.next()}, blue {generator.next()};
+            Stratego model {};
+            model.init();
+            model.load(red, Color::RED);
+            model.load(blue, Color::BLUE);
+            model.setup("red", "blue");
+            MoveGen gen {red, blue};
+            std::mt19937_64 rand {seed};
+
+            for(int ply = 0; ply < 1000 && model.currentState() != StateGraph::GAME_OVER; ply++){
+                model.nextPlayer();
+                REQUIRE((gen.turn() == model.currentPlayer().color()));
+
+                std::vector<std::pair<int, int>> moves {movesOf(model)};
+                REQUIRE(moves == movesOf(gen));
+
+                std::pair<int, int> move {moves[std::uniform_int_distribution<size_t>{0, moves.size() - 1}(rand)]};
+                model.moveAttack(MoveGen::toPosition(move.first), MoveGen::toPosition(move.second));
+                gen.make({static_cast<std::uint8_t>(move.first), static_cast<std::uint8_t>(move.second)});
+                model.nextTurn();
+                model.history().clear();
+                REQUIRE(gen.gameOver() == (model.currentState() == StateGraph::GAME_OVER));
+            }
+        }
+    }
+}
+
+TEST_CASE("MoveGen make and unmake", "[moveGen][unmake]"){
+
+    SetupGenerator generator {5};
+    MoveGen gen {generator.next(), generator.next()};
+    std::mt19937_64 rand {5};
+    std::vector<std::vector<std::pair<int, int>>> positions {};
+    int plies {};
+
+    while(plies < 300 && !gen.gameOver()){
+        positions.push_back(movesOf(gen));
+        MoveGen::MoveList list;
+        int count {gen.generate(list)};
+        gen.make(list[std::uniform_int_distribution<int>{0, count - 1}(rand)]);
+        plies++;
+    }
+
+    while(plies-- > 0){
+        gen.unmake();
+        REQUIRE(movesOf(gen) == positions[plies]);
+    }
+
+    REQUIRE(gen.turn() == Color::RED);
+    REQUIRE_THROWS_AS(gen.unmake(), std::logic_error);
+}
+
+TEST_CASE("MoveGen perft", "[moveGen][perft]"){
+
+    SetupGenerator generator {2021};
+    Layout red {generator.next()}, blue {generator.next()};
+    MoveGen gen {red, blue};
+
+    REQUIRE(gen.perft(0) == 1);
+    REQUIRE(gen.perft(1) == 8);
+    REQUIRE(gen.perft(3) == 573);
+    REQUIRE(gen.perft(4) == 5711);
+
+    Layout wrong {red};
+    wrong[0] = wrong[1];
+    REQUIRE_THROWS_AS((MoveGen{wrong, blue}), std::invalid_argument);
+}
+
+TEST_CASE("MoveGen from a snapshot", "[moveGen][snapshot]"){
+
+    SetupGenerator generator {2021};
+    MoveGen gen {generator.next(), generator.next()};
+    MoveGen::Snapshot snapshot {};
+    for(int square = 0; square < MoveGen::SQUARES; square++){
+        int rank {gen.rankAt(square)};
+        snapshot[square] = {static_cast<std::int8_t>(rank), rank == MoveGen::Topology::EMPTY_SLOT ? Color::RED : gen.colorAt(square)};
+    }
+
+    MoveGen copy {snapshot, Color::RED};
+    REQUIRE(movesOf(copy) == movesOf(gen));
+    REQUIRE(copy.perft(4) == 5711);
+    REQUIRE_FALSE(copy.hasWon(Color::RED));
+
+    MoveGen blue {snapshot, Color::BLUE};
+    REQUIRE(blue.turn() == Color::BLUE);
+
+    snapshot[MoveGen::toSquare({3, 5})] = {Config::PIECE_SCOUT_INFO.rank, Color::RED};
+    REQUIRE_THROWS_AS((MoveGen{snapshot, Color::RED}), std::invalid_argument);
+
+    MoveGen::Snapshot duel {};
+    for(auto& occupant : duel)
+        occupant = {MoveGen::Topology::EMPTY_SLOT, Color::RED};
+    duel[MoveGen::toSquare({1, 10})] = {Config::PIECE_MARSHAL_INFO.rank, Color::RED};
+    duel[MoveGen::toSquare({2, 10})] = {Config::PIECE_FLAG_INFO.rank, Color::RED};
+    duel[MoveGen::toSquare({1, 9})] = {Config::PIECE_FLAG_INFO.rank, Color::BLUE};
+    duel[MoveGen::toSquare({10, 1})] = {Config::PIECE_SCOUT_INFO.rank, Color::BLUE};
+    MoveGen endgame {duel, Color::RED};
+    endgame.make({static_cast<std::uint8_t>(MoveGen::toSquare({1, 10})), static_cast<std::uint8_t>(MoveGen::toSquare({1, 9}))});
+    REQUIRE(endgame.gameOver());
+    REQUIRE(endgame.hasWon(Color::RED));
+    REQUIRE_FALSE(endgame.hasWon(Color::BLUE));
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+#include <bot.h>
+#include <model.h>
+
+#include <random>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    void startGame(Model& model){
+        model.init();
+        model.load("default", Color::RED);
+        model.load("test", Color::BLUE);
+        model.setup("max", "alex");
+        model.nextPlayer();
+    }
+
+    void play(Model& model, const Position& start, const Position& end){
+        model.moveAttack(start, end);
+        model.nextTurn();
+        model.history().clear();
+        if(model.currentState() != StateGraph::GAME_OVER)
+            model.nextPlayer();
+    }
+
+    /*
+     * Vérifie l'observation incrémentale contre une reconstruction complète depuis le plateau.
+     */
+    void checkAgainstBoard(const Model& model, Color viewer){
+        const Observation& obs {model.observation(viewer)};
+        const Board& board {model.board()};
+        for(int y = 0; y < board.size(); y++){
+            for(int x = 0; x < board.size(); x++){
+                const Piece* piece {board.getPiece(x, y)};
+                int square {Observation::toSquare({x, y})};
+                if(!piece){
+                    REQUIRE(obs.ranks[square] == Observation::EMPTY);
+                    REQUIRE(obs.flags[square] == 0);
+                    continue;
+                }
+
+                bool own {piece -> color() == viewer};
+                REQUIRE(obs.ranks[square] == (piece -> knownBy(viewer) ? piece -> rank() : Observation::UNKNOWN));
+                REQUIRE(obs.has({x, y}, Observation::OWN) == own);
+                REQUIRE(obs.has({x, y}, Observation::ENEMY) == !own);
+                REQUIRE(obs.has({x, y}, Observation::REVEALED) == piece -> hasBeenInCombat());
+            }
+        }
+    }
+}
+
+TEST_CASE("model observations", "[observation]"){
+
+    Stratego model {};
+
+    SECTION("hidden ranks are never observed"){
+        startGame(model);
+        const Observation& red {model.observation(Color::RED)};
+        const Observation& blue {model.observation(Color::BLUE)};
+
+        REQUIRE(red.viewer == Color::RED);
+        REQUIRE(red.rankAt({5, 7}) == Config::PIECE_MARSHAL_INFO.rank);
+        REQUIRE(red.has({5, 7}, Observation::OWN));
+        REQUIRE(red.rankAt({5, 4}) == Observation::UNKNOWN);
+        REQUIRE(red.has({5, 4}, Observation::ENEMY));
+        REQUIRE(blue.rankAt({5, 7}) == Observation::UNKNOWN);
+        REQUIRE(red.rankAt({5, 5}) == Observation::EMPTY);
+        REQUIRE(red.plies == 0);
+        model.board().clear();
+    }
+
+    SECTION("moves and combats are applied incrementally"){
+        startGame(model);
+        play(model, {5, 7}, {5, 6});
+        const Observation& blue {model.observation(Color::BLUE)};
+        REQUIRE(blue.has({5, 6}, Observation::MOVED));
+        REQUIRE(blue.rankAt({5, 6}) == Observation::UNKNOWN);
+        REQUIRE(blue.rankAt({5, 7}) == Observation::EMPTY);
+        REQUIRE(blue.plies == 1);
+
+        play(model, {6, 4}, {6, 6});
+        play(model, {5, 6}, {6, 6}); // le maréchal rouge bat l'éclaireur bleu
+        REQUIRE(blue.rankAt({6, 6}) == Config::PIECE_MARSHAL_INFO.rank);
+        REQUIRE(blue.has({6, 6}, Observation::REVEALED));
+        REQUIRE(blue.captured[1][Config::PIECE_SCOUT_INFO.rank] == 1);
+        REQUIRE(model.observation(Color::RED).captured[1][Config::PIECE_SCOUT_INFO.rank] == 1);
+        REQUIRE(blue.lastTo == Observation::toSquare({6, 6}));
+        checkAgainstBoard(model, Color::RED);
+        checkAgainstBoard(model, Color::BLUE);
+        model.board().clear();
+    }
+
+    SECTION("random games match a full rebuild"){
+        std::mt19937 rng {2021};
+        startGame(model);
+        for(int ply = 0; ply < 150 && model.currentState() != StateGraph::GAME_OVER; ply++){
+            std::vector<BotMove> moves {Bot::legalMoves(model)};
+            if(moves.empty())
+                break;
+
+            const BotMove& move {moves[rng() % moves.size()]};
+            play(model, move.start, move.end);
+            checkAgainstBoard(model, Color::RED);
+            checkAgainstBoard(model, Color::BLUE);
+        }
+
+        model.board().clear();
+    }
+}
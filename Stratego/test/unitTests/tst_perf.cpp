@@ -0,0 +1,71 @@
+#include <catch2/catch.hpp>
+#include <thread>
+#include <bot.h>
+#include <model.h>
+#include <perf.h>
+#include <setupGen.h>
+
+using namespace stratego::model;
+using namespace stratego;
+
+TEST_CASE("Performance counters", "[perf]"){
+    perf::Counters counters {};
+
+    SECTION("add() and reset()"){
+        counters.add(perf::MOVES);
+        counters.add(perf::MOVES, 2);
+        perf::Snapshot snapshot {counters.snapshot()};
+        REQUIRE(snapshot.values[perf::MOVES] == 3);
+        REQUIRE(snapshot.values[perf::ATTACKS] == 0);
+        REQUIRE(snapshot.elapsed >= 0);
+
+        counters.reset();
+        REQUIRE(counters.snapshot().values[perf::MOVES] == 0);
+        counters.add(perf::MOVES);
+        REQUIRE(counters.snapshot().values[perf::MOVES] == 1);
+    }
+
+    SECTION("Counters are read from another thread"){
+        counters.add(perf::RENDERS, 5);
+        std::uint64_t renders {};
+        std::thread reader {[&](){ renders = counters.snapshot().values[perf::RENDERS]; }};
+        reader.join();
+        REQUIRE(renders == 5);
+    }
+
+    SECTION("RenderTimer"){
+        { perf::RenderTimer timer {counters}; }
+        perf::Snapshot snapshot {counters.snapshot()};
+        REQUIRE(snapshot.values[perf::RENDERS] == 1);
+    }
+}
+
+TEST_CASE("Model performance counters", "[perf]"){
+    SetupGenerator generator {1};
+    Stratego model {}, other {};
+    model.init();
+    model.load(generator.next(), Color::RED);
+    model.load(generator.next(), Color::BLUE);
+    model.setup("red", "blue");
+    model.nextPlayer();
+
+    SECTION("Model operations are counted"){
+        model.counters().reset();
+        model.moveAttack({1, 7}, {1, 6});
+        perf::Snapshot snapshot {model.counters().snapshot()};
+        REQUIRE(snapshot.values[perf::MOVES] + snapshot.values[perf::ATTACKS] == 1);
+        REQUIRE(snapshot.values[perf::LEGALITY_CHECKS] > 0);
+        REQUIRE(snapshot.values[perf::NOTIFICATIONS] > 0);
+        REQUIRE(snapshot.values[perf::HISTORY_ENTRIES] > 0);
+
+        // les compteurs appartiennent au modèle
+        REQUIRE(other.counters().snapshot().values[perf::MOVES] == 0);
+    }
+
+    SECTION("Legality checks of a move generation are counted"){
+        model.counters().reset();
+        std::vector<BotMove> moves {Bot::legalMoves(model)};
+        REQUIRE_FALSE(moves.empty());
+        REQUIRE(model.counters().snapshot().values[perf::LEGALITY_CHECKS] >= moves.size());
+    }
+}
@@ -424,3 +424,56 @@ TEST_CASE("piece attack", "[piece][attack]"){
         board.getCell(7,6).piece = nullptr;
      }
 }
+
+namespace{
+
+    struct ShortScoutRules : ClassicRules{
+        static constexpr int SCOUT_RANGE = 2;
+    };
+
+    struct SingleReturnRules : ClassicRules{
+        static constexpr int MAX_BNF = 1;
+    };
+}
+
+TEST_CASE("piece rules", "[piece][rules]"){
+    Board board {};
+    History hist {50};
+    StateGraph graph {};
+    PieceFactory pfactory {};
+
+    SECTION("default rules"){
+        Piece* piece {pfactory.createPiece(Config::PIECE_SCOUT_INFO.rank, {1, 1}, Color::BLUE, board, graph, hist)};
+        board.getCell(1, 1).piece = piece;
+        REQUIRE(piece -> canMove({9, 1}));
+        REQUIRE(piece -> canMove<ClassicRules>({9, 1}));
+
+        board.getCell(1, 1).piece = nullptr;
+        delete piece;
+    }
+
+    SECTION("scout range"){
+        Piece* piece {pfactory.createPiece(Config::PIECE_SCOUT_INFO.rank, {1, 1}, Color::BLUE, board, graph, hist)};
+        board.getCell(1, 1).piece = piece;
+        REQUIRE(piece -> canMove<ShortScoutRules>({3, 1}));
+        REQUIRE_FALSE(piece -> canMove<ShortScoutRules>({4, 1}));
+        REQUIRE(piece -> canReach({4, 1}));
+
+        board.getCell(1, 1).piece = nullptr;
+        delete piece;
+    }
+
+    SECTION("back and forth limit"){
+        Piece* piece {pfactory.createPiece(Config::PIECE_SERGENT_INFO.rank, {1, 1}, Color::BLUE, board, graph, hist)};
+        board.getCell(1, 1).piece = piece;
+        piece -> move<SingleReturnRules>({2, 1});
+        piece -> move<SingleReturnRules>({1, 1});
+        piece -> move<SingleReturnRules>({2, 1});
+        REQUIRE_FALSE(piece -> canMove<SingleReturnRules>({1, 1}));
+        REQUIRE(piece -> canMove<SingleReturnRules>({3, 1}));
+        REQUIRE(piece -> canMove({1, 1}));
+
+        board.getCell(2, 1).piece = nullptr;
+        delete piece;
+    }
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch.hpp>
+#include <arena.h>
+#include <pluginBot.h>
+#include <setupGen.h>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    /*
+     * Plugin de test compilé dans l'exécutable: joue le dernier coup légal et enregistre les appels.
+     */
+    struct Calls{
+        int created, destroyed, setups, plays, results;
+        int32_t color, outcome;
+        int8_t firstRank;
+        bool ownPieces;
+    };
+
+    Calls calls {};
+
+    void* create(uint64_t seed){
+        calls.created++;
+        return seed == 13 ? nullptr : &calls;
+    }
+
+    void destroy(void*){
+        calls.destroyed++;
+    }
+
+    void setup(void*, int32_t color, const int8_t layout[STRATEGO_ARMY_SIZE]){
+        calls.setups++;
+        calls.color = color;
+        calls.firstRank = layout[0];
+    }
+
+    int32_t play(void*, const StrategoObservation* obs, const StrategoMove* moves, int32_t count, int64_t budget){
+        calls.plays++;
+        calls.ownPieces = (obs -> flags[moves[count - 1].from] & STRATEGO_OWN) && obs -> viewer == calls.color && budget == -1;
+        return count - 1;
+    }
+
+    int32_t playNothing(void*, const StrategoObservation*, const StrategoMove*, int32_t count, int64_t){
+        return count;
+    }
+
+    void result(void*, int32_t outcome){
+        calls.results++;
+        calls.outcome = outcome;
+    }
+
+    const StrategoBotApi API {STRATEGO_PLUGIN_ABI, "test-plugin", create, destroy, setup, play, result};
+}
+
+TEST_CASE("bot plugins", "[plugin]"){
+
+    calls = {};
+
+    SECTION("a plugin plays a whole game through the C ABI"){
+        SetupGenerator generator {5};
+        Layout red {generator.next()}, blue {generator.next()};
+        {
+            PluginBot plugin {API, 1};
+            RandomBot random {2};
+            REQUIRE(plugin.name() == "test-plugin");
+
+            GameOutcome outcome {Arena{200}.play(red, blue, random, plugin)};
+            REQUIRE(calls.setups == 1);
+            REQUIRE(calls.color == STRATEGO_BLUE);
+            REQUIRE(calls.firstRank == blue[0]);
+            REQUIRE(calls.plays > 0);
+            REQUIRE(calls.ownPieces);
+            REQUIRE(calls.results == 1);
+            REQUIRE(calls.outcome == (outcome == GameOutcome::DRAW ? STRATEGO_DRAW :
+                                      outcome == GameOutcome::BLUE_WIN ? STRATEGO_WIN : STRATEGO_LOSS));
+        }
+
+        REQUIRE(calls.created == 1);
+        REQUIRE(calls.destroyed == 1);
+    }
+
+    SECTION("plugins breaking the ABI are refused"){
+        StrategoBotApi outdated {API};
+        outdated.abiVersion = STRATEGO_PLUGIN_ABI + 1;
+        REQUIRE_THROWS_AS(PluginBot(outdated, 1), std::invalid_argument);
+
+        StrategoBotApi incomplete {API};
+        incomplete.play = nullptr;
+        REQUIRE_THROWS_AS(PluginBot(incomplete, 1), std::invalid_argument);
+        REQUIRE_THROWS_AS(PluginBot(API, 13), std::runtime_error);
+        REQUIRE(calls.destroyed == 0);
+
+        REQUIRE_THROWS_AS(PluginBot::load("/nonexistent/libnothing.so", 1), std::runtime_error);
+        REQUIRE_THROWS_AS(Bot::create("plugin:/nonexistent/libnothing.so", 1), std::runtime_error);
+    }
+
+    SECTION("a move outside the legal moves is refused"){
+        StrategoBotApi confused {API};
+        confused.play = playNothing;
+        PluginBot plugin {confused, 1};
+
+        Stratego model {};
+        model.init();
+        model.load("default", Color::RED);
+        model.load("test", Color::BLUE);
+        model.setup("max", "alex");
+        model.nextPlayer();
+        REQUIRE_THROWS_AS(plugin.play(model), std::runtime_error);
+        model.board().clear();
+    }
+}
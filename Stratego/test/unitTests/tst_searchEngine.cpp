@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+#include <bot.h>
+#include <searchEngine.h>
+
+using namespace stratego;
+using namespace stratego::model;
+
+namespace{
+
+    void startSearchGame(Model& model){
+        model.init();
+        model.load("default", Color::RED);
+        model.load("test", Color::BLUE);
+        model.setup("max", "alex");
+        model.nextPlayer();
+    }
+}
+
+TEST_CASE("search engine", "[search]"){
+
+    Stratego model {};
+    std::atomic<bool> stop {false};
+    SearchEngine engine {stop};
+
+    SECTION("every completed depth is reported"){
+        startSearchGame(model);
+        std::vector<Hint> reported {};
+        std::optional<Hint> best {engine.search(SearchEngine::position(model.observation(Color::RED)), 3,
+                                                [&](const Hint& hint){ reported.push_back(hint); })};
+        REQUIRE(best);
+        REQUIRE(reported.size() == 3);
+        for(int depth = 1; depth <= 3; depth++)
+            REQUIRE(reported[depth - 1].depth == depth);
+        REQUIRE(reported.back().start == best -> start);
+        REQUIRE(reported.back().end == best -> end);
+
+        std::vector<BotMove> moves {Bot::legalMoves(model)};
+        REQUIRE(std::any_of(moves.begin(), moves.end(), [&](const BotMove& move){
+            return move.start == best -> start && move.end == best -> end;
+        }));
+        model.board().clear();
+    }
+
+    SECTION("the position hides nothing the player cannot see"){
+        startSearchGame(model);
+        MoveGen gen {SearchEngine::position(model.observation(Color::RED))};
+        REQUIRE(gen.turn() == Color::RED);
+        for(const Piece* piece : model.board().pieces(Color::RED))
+            REQUIRE(gen.rankAt(Observation::toSquare(piece -> position())) == piece -> rank());
+        for(const Piece* piece : model.board().pieces(Color::BLUE))
+            REQUIRE(gen.colorAt(Observation::toSquare(piece -> position())) == Color::BLUE);
+        model.board().clear();
+    }
+
+    SECTION("only the model's legal moves are searched at the root"){
+        startSearchGame(model);
+        std::vector<BotMove> legal {Bot::legalMoves(model).back()};
+        std::optional<Hint> best {engine.search(SearchEngine::position(model.observation(Color::RED)), 2, {}, &legal)};
+        REQUIRE(best);
+        REQUIRE(best -> start == legal.front().start);
+        REQUIRE(best -> end == legal.front().end);
+
+        legal.clear();
+        REQUIRE_FALSE(engine.search(SearchEngine::position(model.observation(Color::RED)), 2, {}, &legal));
+        model.board().clear();
+    }
+
+    SECTION("a raised stop flag interrupts the search"){
+        startSearchGame(model);
+        stop = true;
+        REQUIRE_FALSE(engine.search(SearchEngine::position(model.observation(Color::RED)), 4));
+        model.board().clear();
+    }
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch.hpp>
+#include <setupGen.h>
+
+using namespace stratego::model;
+using namespace stratego;
+
+TEST_CASE("SetupGenerator generation", "[setupGen][generation]"){
+
+    SECTION("next() valid armies"){
+        SetupGenerator generator {1};
+        for(int i = 0; i < 1000; i++){
+            Layout layout {generator.next()};
+            REQUIRE(LayoutParser::isArmy(layout));
+            REQUIRE(SetupGenerator::canMove(layout));
+        }
+    }
+
+    SECTION("next() reproducible"){
+        SetupGenerator gen1 {42}, gen2 {42}, gen3 {43};
+        Layout layout {gen1.next()};
+        REQUIRE(layout == gen2.next());
+        REQUIRE_FALSE(layout == gen3.next());
+
+        gen3.seed(42);
+        REQUIRE(layout == gen3.next());
+    }
+
+    SECTION("next() with constraints"){
+        SetupConstraints constraints {true, true};
+        SetupGenerator generator {7, constraints};
+        for(int i = 0; i < 1000; i++){
+            Layout layout {generator.next()};
+            REQUIRE(LayoutParser::isArmy(layout));
+            REQUIRE(SetupGenerator::canMove(layout));
+            REQUIRE(SetupGenerator::satisfies(layout, constraints));
+        }
+    }
+}
+
+TEST_CASE("SetupGenerator rules", "[setupGen][rules]"){
+
+    Layout layout {};
+    REQUIRE(ConfigFileParser::decode("2 9 D 6 6 7 7 7 8 8\n5 5 4 4 6 6 4 4 5 5\n2 2 2 3 3 3 3 2 2 2\nB B B 3 10 2 1 B B B\n", layout));
+
+    SECTION("canMove()"){
+        REQUIRE(SetupGenerator::canMove(layout));
+
+        // only the columns facing the lakes hold movable pieces
+        Layout blocked {};
+        REQUIRE(ConfigFileParser::decode("2 9 10 6 6 7 7 7 8 8\n5 5 4 4 6 6 4 4 5 5\n2 2 2 3 3 3 3 2 2 2\nB B 3 2 B B 1 D B B\n", blocked));
+        REQUIRE_FALSE(SetupGenerator::canMove(blocked));
+    }
+
+    SECTION("satisfies()"){
+        REQUIRE(SetupGenerator::satisfies(layout, {}));
+        REQUIRE(SetupGenerator::satisfies(layout, {true, false}));
+        REQUIRE_FALSE(SetupGenerator::satisfies(layout, {false, true}));
+
+        std::swap(layout[2], layout[38]); // D <-> B
+        REQUIRE_FALSE(SetupGenerator::satisfies(layout, {true, false}));
+    }
+}
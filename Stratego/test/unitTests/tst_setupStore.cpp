@@ -0,0 +1,115 @@
+#include <catch2/catch.hpp>
+#include <setupStore.h>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+
+using namespace stratego::model;
+using namespace stratego;
+
+namespace{
+
+    Layout defaultLayout(){
+        Layout layout {};
+        ConfigFileParser::decode("2 9 D 6 6 7 7 7 8 8\n5 5 4 4 6 6 4 4 5 5\n2 2 2 3 3 3 3 2 2 2\nB B B 3 10 2 1 B B B\n", layout);
+        return layout;
+    }
+}
+
+TEST_CASE("PackedSetup packing", "[setupStore][packing]"){
+
+    Layout layout {defaultLayout()};
+
+    SECTION("PackedSetup(Layout) round trip"){
+        PackedSetup setup {layout};
+        REQUIRE(sizeof(setup.bytes()) == 20);
+        REQUIRE(setup.layout() == layout);
+        for(int i = 0; i < Config::ARMY_SIZE; i++)
+            REQUIRE(setup.rankAt(i) == layout[i]);
+    }
+
+    SECTION("PackedSetup(Layout) invalid rank"){
+        layout[3] = Config::PIECE_MAX_RANK + 1;
+        REQUIRE_THROWS_AS(PackedSetup{layout}, std::invalid_argument);
+    }
+
+    SECTION("mirror() and canonical()"){
+        PackedSetup setup {layout};
+        PackedSetup mirrored {setup.mirror()};
+        REQUIRE(mirrored.rankAt(0) == layout[9]);
+        REQUIRE(mirrored.rankAt(7) == layout[2]);
+        REQUIRE(mirrored.mirror() == setup);
+        REQUIRE(setup.canonical() == mirrored.canonical());
+        REQUIRE(setup.canonical().hash() == mirrored.canonical().hash());
+    }
+}
+
+TEST_CASE("SetupStore content", "[setupStore][content]"){
+
+    SetupStore store {};
+    Layout layout {defaultLayout()};
+
+    SECTION("add() deduplicates mirror images"){
+        REQUIRE(store.add(layout));
+        REQUIRE_FALSE(store.add(layout));
+        REQUIRE_FALSE(store.add(PackedSetup{layout}.mirror().layout()));
+        REQUIRE(store.size() == 1);
+        REQUIRE(store.contains(layout));
+        REQUIRE(store.at(0) == PackedSetup{layout}.canonical().layout());
+        REQUIRE_THROWS_AS(store.at(1), std::out_of_range);
+    }
+
+    SECTION("add() invalid army"){
+        layout[0] = Config::PIECE_FLAG_INFO.rank;
+        REQUIRE_THROWS_AS(store.add(layout), std::invalid_argument);
+        REQUIRE(store.size() == 0);
+    }
+
+    SECTION("draw()"){
+        std::mt19937 gen {42};
+        REQUIRE_THROWS_AS(store.draw(gen), std::out_of_range);
+        store.add(layout);
+        for(int i = 0; i < 10; i++){
+            Layout drawn {store.draw(gen)};
+            REQUIRE((drawn == layout || drawn == PackedSetup{layout}.mirror().layout()));
+        }
+    }
+
+    SECTION("toText()"){
+        Layout decoded {};
+        REQUIRE(ConfigFileParser::decode(SetupStore::toText(layout), decoded));
+        REQUIRE(decoded == layout);
+    }
+}
+
+TEST_CASE("SetupStore files", "[setupStore][files]"){
+
+    SetupStore store {};
+    Layout layout {defaultLayout()};
+    std::string dbpath {(std::filesystem::temp_directory_path() / "stratego-tst_setupStore.db").string()};
+
+    SECTION("save() and load()"){
+        store.add(layout);
+        std::swap(layout[0], layout[1]);
+        store.add(layout);
+        store.save(dbpath);
+
+        SetupStore loaded {SetupStore::load(dbpath)};
+        REQUIRE(loaded.size() == 2);
+        REQUIRE(loaded.at(0) == store.at(0));
+        REQUIRE(loaded.at(1) == store.at(1));
+    }
+
+    SECTION("load() invalid"){
+        REQUIRE_THROWS_AS(SetupStore::load(Config::BOARD_CONFIG_PATH + "default"), std::invalid_argument);
+        REQUIRE_THROWS_AS(SetupStore::load(Config::BOARD_CONFIG_PATH + "doesNotExist"), std::invalid_argument);
+    }
+
+    SECTION("importFile()"){
+        REQUIRE(store.importFile(Config::BOARD_CONFIG_PATH + "default"));
+        REQUIRE(store.contains(layout));
+        REQUIRE_THROWS_AS(store.importFile(Config::BOARD_CONFIG_PATH + "wrong"), std::invalid_argument);
+    }
+
+    std::remove(dbpath.c_str());
+}
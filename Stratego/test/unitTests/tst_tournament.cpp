@@ -0,0 +1,239 @@
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <tournament.h>
+
+using namespace stratego::model;
+using namespace stratego;
+
+namespace{
+
+    std::string readFile(const std::string& path){
+        std::ifstream ifs {path, std::ios::binary};
+        return {std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+    }
+
+    TournamentSettings quickSettings(){
+        TournamentSettings settings {};
+        settings.maxTurns = 100;
+        settings.seed = 7;
+        return settings;
+    }
+}
+
+TEST_CASE("Tournament pairings", "[tournament][pairing]"){
+
+    SECTION("roundRobin() even"){
+        std::set<std::pair<int, int>> met {};
+        for(int round = 0; round < 5; round++){
+            std::vector<Encounter> encounters {Tournament::roundRobin(6, round)};
+            REQUIRE(encounters.size() == 3);
+
+            std::set<int> busy {};
+            for(const Encounter& encounter : encounters){
+                REQUIRE(busy.insert(encounter.first).second);
+                REQUIRE(busy.insert(encounter.second).second);
+                REQUIRE(met.insert(std::minmax(encounter.first, encounter.second)).second);
+            }
+        }
+
+        REQUIRE(met.size() == 15);
+    }
+
+    SECTION("roundRobin() odd"){
+        std::set<std::pair<int, int>> met {};
+        std::set<int> byes {};
+        for(int round = 0; round < 5; round++){
+            for(const Encounter& encounter : Tournament::roundRobin(5, round)){
+                if(encounter.second == Encounter::BYE)
+                    REQUIRE(byes.insert(encounter.first).second);
+                else
+                    REQUIRE(met.insert(std::minmax(encounter.first, encounter.second)).second);
+            }
+        }
+
+        REQUIRE(met.size() == 10);
+        REQUIRE(byes.size() == 5);
+    }
+
+    SECTION("swiss rounds avoid rematches"){
+        TournamentSettings settings {quickSettings()};
+        settings.pairing = Pairing::SWISS;
+        settings.rounds = 3;
+        Tournament tournament {{"random", "random", "random", "random", "random"}, settings};
+        tournament.run(2);
+
+        REQUIRE(tournament.rounds().size() == 3);
+        REQUIRE(static_cast<int>(tournament.games().size()) == tournament.gameCount());
+
+        std::set<std::pair<int, int>> met {};
+        std::set<int> byes {};
+        for(const auto& round : tournament.rounds()){
+            REQUIRE(round.size() == 3);
+            for(const Encounter& encounter : round){
+                if(encounter.second == Encounter::BYE)
+                    REQUIRE(byes.insert(encounter.first).second);
+                else
+                    REQUIRE(met.insert(std::minmax(encounter.first, encounter.second)).second);
+            }
+        }
+
+        double points {};
+        for(int bot = 0; bot < 5; bot++)
+            points += tournament.points(bot);
+        REQUIRE(points == tournament.games().size() + 2.0 * byes.size());
+    }
+}
+
+TEST_CASE("Tournament games", "[tournament][play]"){
+
+    SECTION("run() round robin"){
+        TournamentSettings settings {quickSettings()};
+        settings.rounds = 2;
+        Tournament tournament {{"random", "search", "random"}, settings};
+        REQUIRE(tournament.roundCount() == 6);
+        REQUIRE(tournament.gameCount() == 12);
+
+        int calls {};
+        tournament.run(3, [&](const GameRecord& game){
+            calls++;
+            REQUIRE_FALSE(game.forfeit);
+            REQUIRE(tournament.games().back().round == game.round);
+        });
+        REQUIRE(calls == 12);
+
+        for(int bot = 0; bot < 3; bot++){
+            REQUIRE(tournament.score(bot).games() == 8);
+            REQUIRE(tournament.results()[bot][bot].games() == 0);
+        }
+
+        // chaque confrontation se joue sur les mêmes dispositions, les couleurs inversées
+        for(const GameRecord& game : tournament.games()){
+            const Encounter& encounter {tournament.rounds()[game.round][game.encounter]};
+            REQUIRE(game.red == (game.leg ? encounter.second : encounter.first));
+            REQUIRE(game.blue == (game.leg ? encounter.first : encounter.second));
+        }
+    }
+
+    SECTION("run() reproducible"){
+        Tournament first {{"random", "random"}, quickSettings()}, second {{"random", "random"}, quickSettings()};
+        first.run(1);
+        second.run(2);
+        REQUIRE(first.results()[0][1].wins == second.results()[0][1].wins);
+        REQUIRE(first.results()[0][1].draws == second.results()[0][1].draws);
+    }
+
+    SECTION("run() forfeit"){
+        Tournament tournament {{"random", "engine:exit 1"}, quickSettings()};
+        tournament.run(1);
+        REQUIRE(tournament.games().size() == 2);
+        for(const GameRecord& game : tournament.games())
+            REQUIRE(game.forfeit);
+        REQUIRE(tournament.score(0).wins == 2);
+    }
+
+    SECTION("Tournament() invalid"){
+        REQUIRE_THROWS_AS(Tournament({"random"}, quickSettings()), std::invalid_argument);
+
+        TournamentSettings settings {quickSettings()};
+        settings.rounds = 0;
+        REQUIRE_THROWS_AS(Tournament({"random", "random"}, settings), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Tournament checkpoints", "[tournament][checkpoint]"){
+
+    std::string path {(std::filesystem::temp_directory_path() / "tst_tournament.ckpt").string()};
+    std::remove(path.c_str());
+    TournamentSettings settings {quickSettings()};
+    settings.pairing = Pairing::SWISS;
+    settings.rounds = 2;
+    std::vector<std::string> bots {"random", "random", "random", "random"};
+
+    Tournament complete {bots, settings};
+    complete.resume(path);
+    complete.run(2);
+    std::string journal {readFile(path)};
+
+    SECTION("resume() finished tournament"){
+        Tournament resumed {bots, settings};
+        resumed.resume(path);
+        REQUIRE(resumed.games().size() == 8);
+
+        int calls {};
+        resumed.run(2, [&](const GameRecord&){ calls++; });
+        REQUIRE(calls == 0);
+        for(int bot = 0; bot < 4; bot++)
+            REQUIRE(resumed.points(bot) == complete.points(bot));
+    }
+
+    SECTION("resume() interrupted tournament"){
+        // les trois dernières parties sont perdues, la dernière ligne est tronquée
+        size_t end {journal.size() - 1};
+        for(int i = 0; i < 3; i++)
+            end = journal.rfind('\n', end - 1);
+
+        std::ofstream {path, std::ios::binary | std::ios::trunc} << journal.substr(0, end + 1) << "game 1 1";
+        Tournament resumed {bots, settings};
+        resumed.resume(path);
+        REQUIRE(resumed.games().size() == 5);
+
+        resumed.run(1);
+        REQUIRE(resumed.games().size() == 8);
+        for(int bot = 0; bot < 4; bot++)
+            REQUIRE(resumed.points(bot) == complete.points(bot));
+        REQUIRE(readFile(path).size() == journal.size());
+    }
+
+    SECTION("resume() another tournament"){
+        settings.seed++;
+        Tournament other {bots, settings};
+        REQUIRE_THROWS_AS(other.resume(path), std::invalid_argument);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Elo ratings", "[tournament][elo]"){
+
+    std::vector<std::vector<Score>> results(3, std::vector<Score>(3, Score{}));
+
+    SECTION("eloRatings() no games"){
+        for(const Rating& rating : eloRatings(results)){
+            REQUIRE(rating.elo == Approx(0).margin(1e-6));
+            REQUIRE(rating.margin > 0);
+        }
+    }
+
+    SECTION("eloRatings() ordered"){
+        results[0][1] = {30, 10, 10};
+        results[1][0] = {10, 10, 30};
+        results[1][2] = {30, 10, 10};
+        results[2][1] = {10, 10, 30};
+        std::vector<Rating> ratings {eloRatings(results)};
+        REQUIRE(ratings[0].elo > ratings[1].elo);
+        REQUIRE(ratings[1].elo > ratings[2].elo);
+        REQUIRE(ratings[0].elo + ratings[1].elo + ratings[2].elo == Approx(0).margin(1e-6));
+        REQUIRE(ratings[0].elo - ratings[1].elo == Approx(ratings[1].elo - ratings[2].elo).epsilon(0.05));
+    }
+
+    SECTION("eloRatings() perfect score"){
+        results[0][1] = {20, 0, 0};
+        results[1][0] = {0, 0, 20};
+        std::vector<Rating> ratings {eloRatings(results)};
+        REQUIRE(std::isfinite(ratings[0].elo));
+        REQUIRE(ratings[0].elo > ratings[1].elo);
+
+        results[0][1] = {200, 0, 0};
+        results[1][0] = {0, 0, 200};
+        REQUIRE(eloRatings(results)[0].elo > ratings[0].elo);
+    }
+
+    SECTION("eloRatings() margins shrink"){
+        results[0][1] = results[1][0] = {5, 5, 5};
+        double few {eloRatings(results)[0].margin};
+        results[0][1] = results[1][0] = {50, 50, 50};
+        REQUIRE(eloRatings(results)[0].margin < few);
+    }
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch.hpp>
+#include <sstream>
+#include <thread>
+#include <trace.h>
+
+using namespace stratego;
+
+TEST_CASE("Trace spans", "[trace]"){
+    trace::clear();
+
+    SECTION("Span records on destruction"){
+        {
+            trace::Span outer {"outer"};
+            REQUIRE(trace::recorded() == 0);
+            trace::Span inner {"inner"};
+        }
+
+        REQUIRE(trace::recorded() == 2);
+        REQUIRE(trace::dropped() == 0);
+    }
+
+    SECTION("Spans of every thread are exported"){
+        std::thread worker {[](){ trace::Span span {"worker"}; }};
+        worker.join();
+        { trace::Span span {"main \"thread\""}; }
+
+        std::ostringstream out {};
+        trace::writeChrome(out);
+        std::string json {out.str()};
+        REQUIRE(trace::recorded() == 2);
+        REQUIRE(json.find("\"traceEvents\"") != std::string::npos);
+        REQUIRE(json.find("\"name\":\"worker\",\"ph\":\"X\"") != std::string::npos);
+        REQUIRE(json.find("\"name\":\"main \\\"thread\\\"\"") != std::string::npos);
+    }
+
+    SECTION("Full buffer drops spans"){
+        for(std::size_t i = 0; i < trace::BUFFER_CAPACITY + 10; i++)
+            trace::Span span {"span"};
+
+        REQUIRE(trace::recorded() == trace::BUFFER_CAPACITY);
+        REQUIRE(trace::dropped() == 10);
+
+        trace::clear();
+        REQUIRE(trace::recorded() == 0);
+        REQUIRE(trace::dropped() == 0);
+    }
+
+    SECTION("Scope macro"){
+        STRATEGO_TRACE_SCOPE("macro");
+        STRATEGO_TRACE_SCOPE("macro");
+#ifndef STRATEGO_TRACE
+        REQUIRE(trace::recorded() == 0);
+#endif
+    }
+
+    trace::clear();
+}
@@ -0,0 +1,123 @@
+#include <catch2/catch.hpp>
+#include <moveGen.h>
+#include <variant.h>
+
+#include <random>
+
+using namespace stratego::model;
+using namespace stratego;
+
+namespace{
+
+    struct CornerLakesVariant{
+        static constexpr std::string_view NAME {"corners"};
+        static constexpr int SIZE {10};
+        static constexpr int ROWS {4};
+        static constexpr std::array<Position, 2> LAKES {{{1, 5}, {10, 6}}};
+        static constexpr std::array<int, Config::PIECE_MAX_RANK + 1> ARMY {ClassicVariant::ARMY};
+    };
+
+    template<class Variant>
+    int waterCount(){
+        int count {};
+        for(bool water : Topology<Variant>::WATER)
+            count += water;
+        return count;
+    }
+}
+
+TEST_CASE("Variant topologies", "[variant][topology]"){
+
+    static_assert(Topology<ClassicVariant>::ARMY_SIZE == 40);
+    static_assert(Topology<BarrageVariant>::ARMY_SIZE == 8);
+    static_assert(Topology<DuelVariant>::ARMY_SIZE == 24);
+    static_assert(Topology<DuelVariant>::SQUARES == 100);
+    static_assert(Topology<ClassicVariant>::NEIGHBOURS[Topology<ClassicVariant>::toSquare({1, 1})][2] == -1);
+
+    SECTION("Water masks"){
+        REQUIRE(waterCount<ClassicVariant>() == 8);
+        REQUIRE(waterCount<BarrageVariant>() == 8);
+        REQUIRE(waterCount<DuelVariant>() == 4);
+        REQUIRE(waterCount<CornerLakesVariant>() == 2);
+        REQUIRE(Topology<CornerLakesVariant>::WATER[Topology<CornerLakesVariant>::toSquare({10, 6})]);
+    }
+
+    SECTION("Classic variant matches the board"){
+        Board board {};
+        using Classic = Topology<ClassicVariant>;
+        for(int square = 0; square < Classic::SQUARES; square++){
+            const Cell& cell {board.getCell(Classic::toPosition(square))};
+            REQUIRE(Classic::WATER[square] == (cell.type == Cell::WATER));
+            REQUIRE(Classic::WALKABLE[square] == (cell.type == Cell::NORMAL));
+        }
+    }
+
+    SECTION("Neighbours skip walls and water"){
+        using Duel = Topology<DuelVariant>;
+        auto neighbours {Duel::NEIGHBOURS[Duel::toSquare({3, 3})]};
+        REQUIRE(neighbours[0] == Duel::toSquare({3, 2}));
+        REQUIRE(neighbours[1] == Duel::toSquare({4, 3}));
+        REQUIRE(neighbours[2] == Duel::toSquare({2, 3}));
+        REQUIRE(neighbours[3] == -1);
+    }
+
+    SECTION("Armies"){
+        using Barrage = Topology<BarrageVariant>;
+        Barrage::Layout layout {};
+        layout.fill(Barrage::EMPTY_SLOT);
+        REQUIRE_FALSE(Barrage::isArmy(layout));
+
+        std::mt19937 rng {2021};
+        layout = Barrage::randomLayout(rng);
+        REQUIRE(Barrage::isArmy(layout));
+        REQUIRE(std::count(layout.begin(), layout.end(), Barrage::EMPTY_SLOT) == Barrage::SLOTS - 8);
+        REQUIRE(Topology<DuelVariant>::isArmy(Topology<DuelVariant>::randomLayout(rng)));
+    }
+}
+
+TEST_CASE("MoveGen variants", "[variant][moveGen]"){
+
+    SECTION("Barrage"){
+        using Barrage = BasicMoveGen<BarrageVariant>;
+        Barrage::Layout layout {};
+        layout.fill(Barrage::Topology::EMPTY_SLOT);
+        std::array<int, 8> back {0, 11, 1, 2, 2, 3, 9, 10};
+        std::copy(back.begin(), back.end(), layout.begin());
+
+        Barrage gen {layout, layout};
+        REQUIRE(gen.perft(1) == 17);
+        REQUIRE(Barrage::toSquare({5, 10}) == 5 + 10 * Config::BOARD_SIZE);
+
+        layout[0] = Barrage::Topology::EMPTY_SLOT;
+        REQUIRE_THROWS_AS((Barrage{layout, layout}), std::invalid_argument);
+    }
+
+    SECTION("Duel"){
+        using Duel = BasicMoveGen<DuelVariant>;
+        std::mt19937 rng {7};
+        Duel gen {Duel::Topology::randomLayout(rng), Duel::Topology::randomLayout(rng)};
+        std::uint64_t nodes {gen.perft(3)};
+
+        Duel::MoveList moves;
+        int played {};
+        for(; played < 40 && !gen.gameOver(); played++){
+            int count {gen.generate(moves)};
+            for(int i = 0; i < count; i++){
+                Position to {Duel::toPosition(moves[i].to)};
+                REQUIRE(to.x >= 1);
+                REQUIRE(to.x <= DuelVariant::SIZE);
+                REQUIRE(to.y >= 1);
+                REQUIRE(to.y <= DuelVariant::SIZE);
+                REQUIRE(Duel::Topology::WALKABLE[moves[i].to]);
+            }
+
+            gen.make(moves[rng() % count]);
+        }
+
+        while(played--)
+            gen.unmake();
+
+        REQUIRE(gen.turn() == Color::RED);
+        REQUIRE(gen.perft(3) == nodes);
+    }
+}
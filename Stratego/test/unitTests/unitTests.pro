@@ -9,11 +9,31 @@ INCLUDEPATH += ../../libs/
 
 SOURCES += \
     main.cpp \
+    tst_allocTracker.cpp \
+    tst_arena.cpp \
+    tst_beliefTracker.cpp \
     tst_board.cpp \
+    tst_boardSnapshot.cpp \
+    tst_clock.cpp \
+    tst_engineBot.cpp \
+    tst_eventLoop.cpp \
     tst_eventMgr.cpp \
+    tst_gameServer.cpp \
     tst_fileParser.cpp \
+    tst_gameStruct.cpp \
+    tst_hintService.cpp \
     tst_history.cpp \
+    tst_moveGen.cpp \
+    tst_observation.cpp \
     tst_player.cpp \
+    tst_pluginBot.cpp \
     tst_model.cpp \
+    tst_perf.cpp \
     tst_piece.cpp \
-    tst_properties.cpp
+    tst_properties.cpp \
+    tst_searchEngine.cpp \
+    tst_setupGen.cpp \
+    tst_setupStore.cpp \
+    tst_tournament.cpp \
+    tst_trace.cpp \
+    tst_variant.cpp